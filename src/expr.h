@@ -8,10 +8,13 @@ extern "C" {
 #include <ctype.h> /* for isspace */
 #include <limits.h>
 #include <math.h> /* for pow */
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "simd.h"
+
 /*
  * Simple expandable vector implementation
  */
@@ -28,6 +31,18 @@ static int vec_expand(char **buf, int *length, int *cap, int memsz) {
   }
   return 0;
 }
+static int vec_reserve_(char **buf, int *length, int *cap, int memsz, int n) {
+  (void)length;
+  if (n > *cap) {
+    void *ptr = realloc(*buf, n * memsz);
+    if (ptr == NULL) {
+      return -1; /* allocation failed */
+    }
+    *buf = (char *)ptr;
+    *cap = n;
+  }
+  return 0;
+}
 #define vec(T)                                                                 \
   struct {                                                                     \
     T *buf;                                                                    \
@@ -39,6 +54,7 @@ static int vec_expand(char **buf, int *length, int *cap, int memsz) {
 #define vec_len(v) ((v)->len)
 #define vec_unpack(v)                                                          \
   (char **)&(v)->buf, &(v)->len, &(v)->cap, sizeof(*(v)->buf)
+#define vec_reserve(v, n) vec_reserve_(vec_unpack(v), (n))
 #define vec_push(v, val)                                                       \
   vec_expand(vec_unpack(v)) ? -1 : ((v)->buf[(v)->len++] = (val), 0)
 #define vec_nth(v, i) (v)->buf[i]
@@ -101,9 +117,25 @@ static int prec[] = {0, 1, 1, 1, 2, 2, 2, 2, 3,  3,  4,  4, 5, 5,
 typedef vec(struct expr) vec_expr_t;
 typedef void (*exprfn_cleanup_t)(struct expr_func *f, void *context);
 typedef float (*exprfn_t)(struct expr_func *f, vec_expr_t args, void *context);
+typedef void (*exprfn_block_t)(struct expr_func *f, float **argv, int argc,
+                               void *context, float *out, int n);
+typedef vec_expr_t *(*exprfn_trees_t)(struct expr_func *f, void *context);
+
+/* Result of identical subtrees, see expr_block_share() */
+struct expr_shared {
+  const uint64_t *frames; /* advanced whenever variables change */
+  uint64_t frame;         /* frames when value was computed */
+  uint64_t block;         /* block that buf holds */
+  float value;
+  float *buf;
+};
 
 struct expr {
   enum expr_type type;
+  unsigned char rate;  /* enum expr_rate, set by expr_block_create() */
+  unsigned char bits;  /* width of int32 results, 0 if computed in floats */
+  unsigned short slot; /* smoothed block-rate value, 0 if none */
+  struct expr_shared *shared; /* set by expr_block_create(), NULL if none */
   union {
     struct {
       float value;
@@ -124,7 +156,7 @@ struct expr {
 
 #define expr_init()                                                            \
   {                                                                            \
-    (enum expr_type)0, {                                                       \
+    (enum expr_type)0, 0, 0, 0, NULL, {                                        \
       { 0 }                                                                    \
     }                                                                          \
   }
@@ -158,11 +190,47 @@ static int expr_prec(enum expr_type a, enum expr_type b) {
   return (left && prec[a] >= prec[b]) || (prec[a] > prec[b]);
 }
 
-#define isfirstvarchr(c)                                                       \
-  (((unsigned char)c >= '@' && c != '^' && c != '|') || c == '$')
-#define isvarchr(c)                                                            \
-  (((unsigned char)c >= '@' && c != '^' && c != '|') || c == '$' ||            \
-   c == '#' || (c >= '0' && c <= '9'))
+/*
+ * Character classes used by the lexer, one table lookup per character
+ */
+#define EXPR_CSPACE (1 << 0)
+#define EXPR_CDIGIT (1 << 1)
+#define EXPR_CWORD (1 << 2) /* starts a variable or function name */
+#define EXPR_CVAR (1 << 3)  /* continues a variable or function name */
+#define EXPR_COP (1 << 4)
+
+#define S EXPR_CSPACE
+#define D (EXPR_CDIGIT | EXPR_CVAR)
+#define W (EXPR_CWORD | EXPR_CVAR)
+#define V EXPR_CVAR
+#define O EXPR_COP
+static const unsigned char expr_chr[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, S, S, S, S, S, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    S, O, 0, V, W, O, O, 0, 0, 0, O, O, O, O, 0, O,
+    D, D, D, D, D, D, D, D, D, D, 0, 0, O, O, O, 0,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, O, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, O, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+    W, W, W, W, W, W, W, W, W, W, W, W, W, W, W, W,
+};
+#undef S
+#undef D
+#undef W
+#undef V
+#undef O
+
+#define expr_chrclass(c, cls) (expr_chr[(unsigned char)(c)] & (cls))
+#define isfirstvarchr(c) expr_chrclass(c, EXPR_CWORD)
+#define isvarchr(c) expr_chrclass(c, EXPR_CVAR)
 
 static struct {
   const char *s;
@@ -201,8 +269,14 @@ static struct {
 };
 
 static enum expr_type expr_op(const char *s, size_t len, int unary) {
+  if (len == 0 || len > 2 || !expr_chrclass(*s, EXPR_COP)) {
+    return OP_UNKNOWN;
+  }
   for (unsigned int i = 0; i < sizeof(OPS) / sizeof(OPS[0]); i++) {
-    if (strlen(OPS[i].s) == len && strncmp(OPS[i].s, s, len) == 0 &&
+    const char *op = OPS[i].s;
+    if (op[0] == s[0] &&
+        (len == 1 ? op[1] == '\0'
+                  : (op[1] != '\0' && op[1] == s[1] && op[2] == '\0')) &&
         (unary == -1 || expr_is_unary(OPS[i].op) == unary)) {
       return OPS[i].op;
     }
@@ -244,165 +318,2323 @@ struct expr_func {
   exprfn_t f;
   exprfn_cleanup_t cleanup;
   size_t ctxsz;
+  exprfn_block_t block; /* optional, renders n frames from evaluated args */
+  int flags;
+  exprfn_trees_t trees; /* optional, trees evaluated besides the arguments */
 };
 
-static struct expr_func *expr_func(struct expr_func *funcs, const char *s,
+#define EXPR_FUNC_PURE (1 << 0)    /* result depends only on the arguments */
+#define EXPR_FUNC_ASSIGNS (1 << 1) /* writes variables passed as arguments */
+
+static unsigned int expr_hash(const char *s, size_t len) {
+  unsigned int h = 2166136261u; /* FNV-1a */
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ (unsigned char)s[i]) * 16777619u;
+  }
+  return h;
+}
+
+/*
+ * Function registry, an open addressing hash table of functions by name. The
+ * functions themselves are owned by the caller and must outlive the list.
+ */
+struct expr_func_list {
+  struct expr_func **table; /* power of two size, at most half full */
+  size_t *lens;
+  int cap;
+  int len;
+};
+
+static int expr_func_probe(struct expr_func_list *funcs, const char *s,
+                           size_t len) {
+  unsigned int i = expr_hash(s, len) & (funcs->cap - 1);
+  for (;; i = (i + 1) & (funcs->cap - 1)) {
+    struct expr_func *f = funcs->table[i];
+    if (f == NULL ||
+        (funcs->lens[i] == len && memcmp(f->name, s, len) == 0)) {
+      return (int)i;
+    }
+  }
+}
+
+static struct expr_func *expr_func(struct expr_func_list *funcs, const char *s,
                                    size_t len) {
-  for (struct expr_func *f = funcs; f->name; f++) {
-    if (strlen(f->name) == len && strncmp(f->name, s, len) == 0) {
-      return f;
+  if (funcs->len == 0) {
+    return NULL;
+  }
+  return funcs->table[expr_func_probe(funcs, s, len)];
+}
+
+/* Registers a function, the first one added under a name wins */
+static int expr_func_add(struct expr_func_list *funcs, struct expr_func *f) {
+  if ((funcs->len + 1) * 2 > funcs->cap) {
+    struct expr_func_list grown = {NULL, NULL, funcs->cap ? funcs->cap * 2 : 64,
+                                   funcs->len};
+    grown.table =
+        (struct expr_func **)calloc(grown.cap, sizeof(struct expr_func *));
+    grown.lens = (size_t *)calloc(grown.cap, sizeof(size_t));
+    if (grown.table == NULL || grown.lens == NULL) {
+      free(grown.table);
+      free(grown.lens);
+      return -1;
+    }
+    for (int i = 0; i < funcs->cap; i++) {
+      if (funcs->table[i] != NULL) {
+        int j = expr_func_probe(&grown, funcs->table[i]->name, funcs->lens[i]);
+        grown.table[j] = funcs->table[i];
+        grown.lens[j] = funcs->lens[i];
+      }
     }
+    free(funcs->table);
+    free(funcs->lens);
+    *funcs = grown;
   }
-  return NULL;
+  size_t len = strlen(f->name);
+  int i = expr_func_probe(funcs, f->name, len);
+  if (funcs->table[i] == NULL) {
+    funcs->table[i] = f;
+    funcs->lens[i] = len;
+    funcs->len++;
+  }
+  return 0;
+}
+
+/* Registers a NULL-terminated array of functions */
+static int expr_func_add_all(struct expr_func_list *funcs,
+                             struct expr_func *f) {
+  for (; f->name; f++) {
+    if (expr_func_add(funcs, f) == -1) {
+      return -1;
+    }
+  }
+  return 0;
 }
 
 /*
  * Variables
+ *
+ * Names are interned in an open addressing hash table. Values are stored in
+ * cache-aligned pages of EXPR_VAR_PAGE consecutive floats. Pages never move,
+ * so expressions keep plain pointers to values.
  */
+#define EXPR_VAR_PAGE 1024
+#define EXPR_VAR_ALIGN 64
+
 struct expr_var {
-  float value;
-  struct expr_var *next;
+  float *value;
+  int constant; /* set by the host, cleared once an expression assigns it */
+  int pinned;   /* set by the host, expr_var_gc() never reclaims it */
+  int slot;
+  size_t len;
   char name[];
 };
 
+struct expr_var_page {
+  void *mem;
+  float *values;
+};
+
 struct expr_var_list {
-  struct expr_var *head;
+  struct expr_var **table; /* power of two size, at most half full */
+  int cap;
+  int len;
+  vec(struct expr_var *) slots; /* owners of the values, NULL if free */
+  vec(int) free;
+  vec(struct expr_var_page) pages;
 };
 
+static struct expr_var **expr_var_probe(struct expr_var_list *vars,
+                                        const char *s, size_t len) {
+  unsigned int i = expr_hash(s, len) & (vars->cap - 1);
+  for (;; i = (i + 1) & (vars->cap - 1)) {
+    struct expr_var *v = vars->table[i];
+    if (v == NULL || (v->len == len && memcmp(v->name, s, len) == 0)) {
+      return &vars->table[i];
+    }
+  }
+}
+
+static int expr_var_rehash(struct expr_var_list *vars, int cap) {
+  struct expr_var **table =
+      (struct expr_var **)calloc(cap, sizeof(struct expr_var *));
+  if (table == NULL) {
+    return -1;
+  }
+  free(vars->table);
+  vars->table = table;
+  vars->cap = cap;
+  for (int i = 0; i < vec_len(&vars->slots); i++) {
+    struct expr_var *v = vec_nth(&vars->slots, i);
+    if (v != NULL) {
+      *expr_var_probe(vars, v->name, v->len) = v;
+    }
+  }
+  return 0;
+}
+
+static float *expr_var_value(struct expr_var_list *vars, int slot) {
+  return vec_nth(&vars->pages, slot / EXPR_VAR_PAGE).values +
+         slot % EXPR_VAR_PAGE;
+}
+
+/* Returns a free value slot, -1 if allocation failed */
+static int expr_var_slot(struct expr_var_list *vars) {
+  if (vec_len(&vars->free) > 0) {
+    return vec_pop(&vars->free);
+  }
+  int slot = vec_len(&vars->slots);
+  if (slot % EXPR_VAR_PAGE == 0) {
+    struct expr_var_page page;
+    page.mem = malloc(EXPR_VAR_PAGE * sizeof(float) + EXPR_VAR_ALIGN);
+    if (page.mem == NULL) {
+      return -1;
+    }
+    page.values = (float *)(((size_t)page.mem + EXPR_VAR_ALIGN - 1) &
+                            ~(size_t)(EXPR_VAR_ALIGN - 1));
+    if (vec_push(&vars->pages, page) < 0) {
+      free(page.mem);
+      return -1;
+    }
+  }
+  if (vec_push(&vars->slots, NULL) < 0) {
+    return -1;
+  }
+  return slot;
+}
+
 static struct expr_var *expr_var(struct expr_var_list *vars, const char *s,
                                  size_t len) {
   struct expr_var *v = NULL;
   if (len == 0 || !isfirstvarchr(*s)) {
     return NULL;
   }
-  for (v = vars->head; v; v = v->next) {
-    if (strlen(v->name) == len && strncmp(v->name, s, len) == 0) {
-      return v;
+  if ((vars->len + 1) * 2 > vars->cap &&
+      expr_var_rehash(vars, vars->cap ? vars->cap * 2 : 256) < 0) {
+    return NULL;
+  }
+  struct expr_var **p = expr_var_probe(vars, s, len);
+  if (*p != NULL) {
+    return *p;
+  }
+  v = (struct expr_var *)calloc(1, sizeof(struct expr_var) + len + 1);
+  if (v == NULL) {
+    return NULL; /* allocation failed */
+  }
+  if ((v->slot = expr_var_slot(vars)) < 0) {
+    free(v);
+    return NULL;
+  }
+  vec_nth(&vars->slots, v->slot) = v;
+  v->value = expr_var_value(vars, v->slot);
+  *v->value = 0;
+  v->len = len;
+  memcpy(v->name, s, len);
+  v->name[len] = '\0';
+  *p = v;
+  vars->len++;
+  return v;
+}
+
+/* Finds a variable by the address of its value */
+static struct expr_var *expr_var_find(struct expr_var_list *vars,
+                                      float *value) {
+  for (int i = 0; i < vec_len(&vars->pages); i++) {
+    float *values = vec_nth(&vars->pages, i).values;
+    if (value >= values && value < values + EXPR_VAR_PAGE) {
+      return vec_nth(&vars->slots, i * EXPR_VAR_PAGE + (int)(value - values));
+    }
+  }
+  return NULL;
+}
+
+static void expr_var_mark(struct expr_var_list *vars, struct expr *e,
+                          char *marks) {
+  int i;
+  struct expr arg;
+  if (e->type == OP_VAR) {
+    struct expr_var *v = expr_var_find(vars, e->param.var.value);
+    if (v != NULL) {
+      marks[v->slot] = 1;
+    }
+  } else if (e->type == OP_FUNC) {
+    vec_foreach(&e->param.func.args, arg, i) {
+      expr_var_mark(vars, &arg, marks);
+    }
+  } else if (e->type != OP_CONST) {
+    vec_foreach(&e->param.op.args, arg, i) {
+      expr_var_mark(vars, &arg, marks);
+    }
+  }
+}
+
+/* Reclaims variables that are neither pinned nor used by the given live
+ * expressions (NULL entries are skipped). Returns the number of reclaimed
+ * variables, -1 on allocation failure */
+static int expr_var_gc(struct expr_var_list *vars, struct expr **live, int n) {
+  int reclaimed = 0;
+  char *marks = (char *)calloc(vec_len(&vars->slots) + 1, 1);
+  if (marks == NULL) {
+    return -1;
+  }
+  for (int i = 0; i < n; i++) {
+    if (live[i] != NULL) {
+      expr_var_mark(vars, live[i], marks);
+    }
+  }
+  for (int i = 0; i < vec_len(&vars->slots); i++) {
+    struct expr_var *v = vec_nth(&vars->slots, i);
+    if (v != NULL && !v->pinned && !marks[i] &&
+        (vec_push(&vars->free, i)) == 0) {
+      vec_nth(&vars->slots, i) = NULL;
+      free(v);
+      reclaimed++;
+    }
+  }
+  free(marks);
+  if (reclaimed > 0) {
+    vars->len -= reclaimed;
+    /* Rebuilding the table is simpler than deleting with tombstones */
+    memset(vars->table, 0, vars->cap * sizeof(struct expr_var *));
+    for (int i = 0; i < vec_len(&vars->slots); i++) {
+      struct expr_var *v = vec_nth(&vars->slots, i);
+      if (v != NULL) {
+        *expr_var_probe(vars, v->name, v->len) = v;
+      }
+    }
+  }
+  return reclaimed;
+}
+
+static void expr_var_free(struct expr_var_list *vars) {
+  for (int i = 0; i < vec_len(&vars->slots); i++) {
+    free(vec_nth(&vars->slots, i));
+  }
+  for (int i = 0; i < vec_len(&vars->pages); i++) {
+    free(vec_nth(&vars->pages, i).mem);
+  }
+  vec_free(&vars->slots);
+  vec_free(&vars->free);
+  vec_free(&vars->pages);
+  free(vars->table);
+  vars->table = NULL;
+  vars->cap = vars->len = 0;
+}
+
+static int to_int(float x) {
+  if (isnan(x)) {
+    return 0;
+  } else if (isinf(x) != 0) {
+    return INT_MAX * isinf(x);
+  } else {
+    return (int)x;
+  }
+}
+
+static float expr_eval_node(struct expr *e);
+
+/* Shared values are computed once per frame */
+static float expr_eval(struct expr *e) {
+  struct expr_shared *s = e->shared;
+  if (s == NULL) {
+    return expr_eval_node(e);
+  } else if (s->frame != *s->frames) {
+    s->value = expr_eval_node(e);
+    s->frame = *s->frames;
+  }
+  return s->value;
+}
+
+static float expr_eval_node(struct expr *e) {
+  float n;
+  switch (e->type) {
+  case OP_UNARY_MINUS:
+    return -(expr_eval(&e->param.op.args.buf[0]));
+  case OP_UNARY_LOGICAL_NOT:
+    return !(expr_eval(&e->param.op.args.buf[0]));
+  case OP_UNARY_BITWISE_NOT:
+    return ~(to_int(expr_eval(&e->param.op.args.buf[0])));
+  case OP_POWER:
+    return powf(expr_eval(&e->param.op.args.buf[0]),
+                expr_eval(&e->param.op.args.buf[1]));
+  case OP_MULTIPLY:
+    return expr_eval(&e->param.op.args.buf[0]) *
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_DIVIDE:
+    return expr_eval(&e->param.op.args.buf[0]) /
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_REMAINDER:
+    return fmodf(expr_eval(&e->param.op.args.buf[0]),
+                 expr_eval(&e->param.op.args.buf[1]));
+  case OP_PLUS:
+    return expr_eval(&e->param.op.args.buf[0]) +
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_MINUS:
+    return expr_eval(&e->param.op.args.buf[0]) -
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_SHL:
+    return to_int(expr_eval(&e->param.op.args.buf[0]))
+           << to_int(expr_eval(&e->param.op.args.buf[1]));
+  case OP_SHR:
+    return to_int(expr_eval(&e->param.op.args.buf[0])) >>
+           to_int(expr_eval(&e->param.op.args.buf[1]));
+  case OP_LT:
+    return expr_eval(&e->param.op.args.buf[0]) <
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_LE:
+    return expr_eval(&e->param.op.args.buf[0]) <=
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_GT:
+    return expr_eval(&e->param.op.args.buf[0]) >
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_GE:
+    return expr_eval(&e->param.op.args.buf[0]) >=
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_EQ:
+    return expr_eval(&e->param.op.args.buf[0]) ==
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_NE:
+    return expr_eval(&e->param.op.args.buf[0]) !=
+           expr_eval(&e->param.op.args.buf[1]);
+  case OP_BITWISE_AND:
+    return to_int(expr_eval(&e->param.op.args.buf[0])) &
+           to_int(expr_eval(&e->param.op.args.buf[1]));
+  case OP_BITWISE_OR:
+    return to_int(expr_eval(&e->param.op.args.buf[0])) |
+           to_int(expr_eval(&e->param.op.args.buf[1]));
+  case OP_BITWISE_XOR:
+    return to_int(expr_eval(&e->param.op.args.buf[0])) ^
+           to_int(expr_eval(&e->param.op.args.buf[1]));
+  case OP_LOGICAL_AND:
+    n = expr_eval(&e->param.op.args.buf[0]);
+    if (n != 0) {
+      n = expr_eval(&e->param.op.args.buf[1]);
+      if (n != 0) {
+        return n;
+      }
+    }
+    return 0;
+  case OP_LOGICAL_OR:
+    n = expr_eval(&e->param.op.args.buf[0]);
+    if (n != 0 && !isnan(n)) {
+      return n;
+    } else {
+      n = expr_eval(&e->param.op.args.buf[1]);
+      if (n != 0) {
+        return n;
+      }
+    }
+    return 0;
+  case OP_ASSIGN:
+    n = expr_eval(&e->param.op.args.buf[1]);
+    if (vec_nth(&e->param.op.args, 0).type == OP_VAR) {
+      *e->param.op.args.buf[0].param.var.value = n;
+    }
+    return n;
+  case OP_COMMA:
+    expr_eval(&e->param.op.args.buf[0]);
+    return expr_eval(&e->param.op.args.buf[1]);
+  case OP_CONST:
+    return e->param.num.value;
+  case OP_VAR:
+    return *e->param.var.value;
+  case OP_FUNC:
+    return e->param.func.f->f(e->param.func.f, e->param.func.args,
+                              e->param.func.context);
+  default:
+    return NAN;
+  }
+}
+
+/*
+ * Block evaluation
+ *
+ * Renders up to EXPR_BLOCK_SIZE frames at once: operators are loops over
+ * arrays, functions with a block variant get all their arguments evaluated
+ * in advance. Variables that change from frame to frame (assigned by the
+ * expression itself or driven by the host, like time) are kept as "ramps" of
+ * per-frame values. Nodes that can't be rendered as a block are evaluated
+ * frame by frame with the ramps applied, so the result is the same as calling
+ * expr_eval() n times.
+ *
+ * Every node is tagged with the rate its value may change at. Nodes that only
+ * depend on constants, variables the host changes between blocks and pure
+ * functions of those are block-rate: they are evaluated once per block. Pure
+ * functions of audio-rate values are called once too when all their
+ * arguments happen to hold still for the whole block, like the notes of a
+ * sequence. With smoothing enabled, block-rate values feeding audio-rate
+ * nodes glide linearly from their previous value across the block instead of
+ * stepping, which is no longer sample-exact.
+ *
+ * Identical subtrees that occur more than once share their result, see
+ * expr_block_share().
+ */
+#define EXPR_BLOCK_SIZE 128
+#define EXPR_BLOCK_MAX_ARGS 8
+#define EXPR_BLOCK_MAX_SLOTS 65535
+
+/* Ordered so that a node runs at the highest rate of its inputs */
+enum expr_rate { EXPR_RATE_CONST, EXPR_RATE_BLOCK, EXPR_RATE_AUDIO };
+
+typedef vec(float *) vec_ref_t;
+
+struct expr_ramp {
+  float *value;
+  float *buf;
+};
+
+struct expr_block {
+  int n; /* number of frames in the current block */
+  int nramps;
+  int ndriven;
+  struct expr_ramp *ramps;
+  int smooth; /* glide block-rate values, off by default */
+  int nslots;
+  float *prev; /* smoothed values from the previous block, by slot */
+  uint64_t frames; /* advanced by the host whenever it changes variables */
+  uint64_t blocks; /* advanced by expr_block_finish() */
+  int nshared;
+  struct expr_shared *shared;
+};
+
+static int expr_ref_find(vec_ref_t *refs, float *value) {
+  for (int i = 0; i < vec_len(refs); i++) {
+    if (vec_nth(refs, i) == value) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* Collects variables that are referenced and assigned in the expression */
+static void expr_block_vars(struct expr *e, vec_ref_t *used,
+                            vec_ref_t *assigned) {
+  int i;
+  struct expr arg;
+  if (e->type == OP_VAR) {
+    if (expr_ref_find(used, e->param.var.value) == -1) {
+      vec_push(used, e->param.var.value);
+    }
+  } else if (e->type == OP_FUNC) {
+    vec_foreach(&e->param.func.args, arg, i) {
+      expr_block_vars(&arg, used, assigned);
+    }
+  } else if (e->type != OP_CONST) {
+    if (e->type == OP_ASSIGN) {
+      float *value = vec_nth(&e->param.op.args, 0).param.var.value;
+      if (expr_ref_find(assigned, value) == -1) {
+        vec_push(assigned, value);
+      }
+    }
+    vec_foreach(&e->param.op.args, arg, i) {
+      expr_block_vars(&arg, used, assigned);
+    }
+  }
+}
+
+/* Walks the expression in evaluation order. Assigned variables may only be
+ * read after they have been assigned in the same frame, and assignments must
+ * happen on every frame (not in function arguments or short-circuit
+ * operands), otherwise the expression depends on the previous frame */
+static int expr_block_check(struct expr *e, vec_ref_t *assigned,
+                            vec_ref_t *done, int cond) {
+  int i;
+  struct expr arg;
+  switch (e->type) {
+  case OP_CONST:
+    return 0;
+  case OP_VAR:
+    if (expr_ref_find(assigned, e->param.var.value) != -1 &&
+        expr_ref_find(done, e->param.var.value) == -1) {
+      return -1;
+    }
+    return 0;
+  case OP_FUNC:
+    vec_foreach(&e->param.func.args, arg, i) {
+      if (expr_block_check(&arg, assigned, done, 1) < 0) {
+        return -1;
+      }
+    }
+    return 0;
+  case OP_ASSIGN:
+    if (cond ||
+        expr_block_check(&vec_nth(&e->param.op.args, 1), assigned, done, 0)) {
+      return -1;
+    }
+    vec_push(done, vec_nth(&e->param.op.args, 0).param.var.value);
+    return 0;
+  case OP_LOGICAL_AND:
+  case OP_LOGICAL_OR:
+    if (expr_block_check(&vec_nth(&e->param.op.args, 0), assigned, done,
+                         cond) < 0) {
+      return -1;
+    }
+    return expr_block_check(&vec_nth(&e->param.op.args, 1), assigned, done, 1);
+  default:
+    vec_foreach(&e->param.op.args, arg, i) {
+      if (expr_block_check(&arg, assigned, done, cond) < 0) {
+        return -1;
+      }
+    }
+    return 0;
+  }
+}
+
+/* Variables read per frame or assigned audio-rate values, and assigned
+ * variables that only got block-rate values so far */
+struct expr_rates {
+  vec_ref_t audio;
+  vec_ref_t block;
+  vec_ref_t *assigned;
+  int changed;
+  int error;
+};
+
+static void expr_rate_raise(struct expr_rates *r, float *value,
+                            enum expr_rate rate) {
+  if (rate == EXPR_RATE_CONST || expr_ref_find(&r->audio, value) != -1) {
+    return;
+  }
+  if (rate == EXPR_RATE_AUDIO) {
+    r->error = r->error || (vec_push(&r->audio, value)) == -1;
+    r->changed = 1;
+  } else if (expr_ref_find(&r->block, value) == -1) {
+    r->error = r->error || (vec_push(&r->block, value)) == -1;
+    r->changed = 1;
+  }
+}
+
+/* Tags the node and its arguments with their rates. Assigned variables are
+ * read after their assignment within the frame (see expr_block_check()), so
+ * they take the highest rate of the values assigned to them. Assignments
+ * themselves are audio-rate, they must update the ramps on every block */
+static enum expr_rate expr_block_rate(struct expr *e, struct expr_rates *r) {
+  enum expr_rate rate = EXPR_RATE_CONST;
+  enum expr_rate a;
+  switch (e->type) {
+  case OP_CONST:
+    break;
+  case OP_VAR:
+    if (expr_ref_find(&r->audio, e->param.var.value) != -1) {
+      rate = EXPR_RATE_AUDIO;
+    } else if (expr_ref_find(r->assigned, e->param.var.value) == -1 ||
+               expr_ref_find(&r->block, e->param.var.value) != -1) {
+      rate = EXPR_RATE_BLOCK;
+    }
+    break;
+  case OP_ASSIGN:
+    rate = expr_block_rate(&vec_nth(&e->param.op.args, 1), r);
+    expr_rate_raise(r, vec_nth(&e->param.op.args, 0).param.var.value, rate);
+    vec_nth(&e->param.op.args, 0).rate = EXPR_RATE_AUDIO;
+    rate = EXPR_RATE_AUDIO;
+    break;
+  case OP_FUNC:
+    for (int i = 0; i < vec_len(&e->param.func.args); i++) {
+      struct expr *arg = &vec_nth(&e->param.func.args, i);
+      a = expr_block_rate(arg, r);
+      rate = (a > rate ? a : rate);
+      /* Variables written by the function change within the frame */
+      if ((e->param.func.f->flags & EXPR_FUNC_ASSIGNS) &&
+          arg->type == OP_VAR) {
+        expr_rate_raise(r, arg->param.var.value, EXPR_RATE_AUDIO);
+      }
+    }
+    if (!(e->param.func.f->flags & EXPR_FUNC_PURE) ||
+        (e->param.func.f->flags & EXPR_FUNC_ASSIGNS)) {
+      rate = EXPR_RATE_AUDIO;
+    }
+    break;
+  default:
+    for (int i = 0; i < vec_len(&e->param.op.args); i++) {
+      a = expr_block_rate(&vec_nth(&e->param.op.args, i), r);
+      rate = (a > rate ? a : rate);
+    }
+  }
+  e->rate = (unsigned char)rate;
+  return rate;
+}
+
+/* Numbers block-rate nodes that feed audio-rate ones, to keep their previous
+ * values for smoothing */
+static void expr_block_slots(struct expr *e, int audio, int *nslots) {
+  vec_expr_t *args = (e->type == OP_FUNC ? &e->param.func.args
+                                         : &e->param.op.args);
+  e->slot = 0;
+  if (e->rate == EXPR_RATE_BLOCK && audio &&
+      *nslots < EXPR_BLOCK_MAX_SLOTS) {
+    e->slot = (unsigned short)++*nslots;
+  }
+  if (e->type == OP_CONST || e->type == OP_VAR) {
+    return;
+  }
+  for (int i = 0; i < vec_len(args); i++) {
+    expr_block_slots(&vec_nth(args, i), e->rate == EXPR_RATE_AUDIO, nslots);
+  }
+}
+
+/* Bits needed to hold the number in two's complement */
+static int expr_int_width(int32_t v) {
+  int w = 1;
+  for (uint32_t u = (uint32_t)(v < 0 ? ~v : v); u != 0; u = u >> 1) {
+    w++;
+  }
+  return w;
+}
+
+/* Width of the int that an integer operator reads from the node, i.e. of
+ * to_int() of its float value. Sets exact if the float value is a whole
+ * number that the int holds exactly */
+static int expr_int_operand(struct expr *e, vec_ref_t *whole, int *exact) {
+  *exact = 0;
+  if (e->bits > 0) {
+    /* Wide results get rounded to a float on the way, possibly up */
+    *exact = e->bits < 32;
+    return (e->bits > 25 && e->bits < 32 ? e->bits + 1 : e->bits);
+  } else if (e->type == OP_CONST) {
+    int32_t v = to_int(e->param.num.value);
+    *exact = ((float)v == e->param.num.value);
+    return expr_int_width(v);
+  } else if (e->type == OP_VAR) {
+    *exact = (expr_ref_find(whole, e->param.var.value) != -1);
+  }
+  return 32;
+}
+
+/* Tags bitwise operators, and remainders of whole numbers by small constant
+ * divisors, with the width of their results. These run on int32 lanes, and
+ * their float values are the ints converted once at the float boundary */
+static void expr_block_ints(struct expr *e, vec_ref_t *whole) {
+  vec_expr_t *args = (e->type == OP_FUNC ? &e->param.func.args
+                                         : &e->param.op.args);
+  int wa, wb, exact;
+  struct expr *rhs;
+  int32_t k;
+  e->bits = 0;
+  if (e->type == OP_CONST || e->type == OP_VAR) {
+    return;
+  }
+  for (int i = 0; i < vec_len(args); i++) {
+    expr_block_ints(&vec_nth(args, i), whole);
+  }
+  if (e->type == OP_FUNC || vec_len(args) == 0) {
+    return;
+  }
+  wa = expr_int_operand(&vec_nth(args, 0), whole, &exact);
+  rhs = &vec_nth(args, vec_len(args) - 1);
+  wb = expr_int_operand(rhs, whole, &exact);
+  k = (rhs->type == OP_CONST ? to_int(rhs->param.num.value) : -1);
+  switch (e->type) {
+  case OP_UNARY_BITWISE_NOT:
+    e->bits = (unsigned char)wa;
+    break;
+  case OP_BITWISE_AND:
+    /* A non-negative mask bounds the result */
+    if (rhs->type == OP_CONST && k >= 0) {
+      e->bits = (unsigned char)wb;
+    } else if (vec_nth(args, 0).type == OP_CONST &&
+               to_int(vec_nth(args, 0).param.num.value) >= 0) {
+      e->bits = (unsigned char)wa;
+    } else {
+      e->bits = (unsigned char)(wa > wb ? wa : wb);
+    }
+    break;
+  case OP_BITWISE_OR:
+  case OP_BITWISE_XOR:
+    e->bits = (unsigned char)(wa > wb ? wa : wb);
+    break;
+  case OP_SHL:
+    wa = (rhs->type == OP_CONST ? wa + (k & 31) : 32);
+    e->bits = (unsigned char)(wa < 32 ? wa : 32);
+    break;
+  case OP_SHR:
+    wa = (rhs->type == OP_CONST ? wa - (k & 31) : wa);
+    e->bits = (unsigned char)(wa > 1 ? wa : 1);
+    break;
+  case OP_REMAINDER:
+    /* fmodf() is exact for whole numbers, and keeps the sign of the dividend
+     * like the integer remainder does */
+    expr_int_operand(&vec_nth(args, 0), whole, &exact);
+    if (exact && rhs->type == OP_CONST && (float)k == rhs->param.num.value &&
+        k != INT32_MIN && (k < 0 ? -k : k) >= 2 &&
+        (k < 0 ? -k : k) <= (1 << 24)) {
+      e->bits = (unsigned char)expr_int_width((k < 0 ? -k : k) - 1);
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/*
+ * Value numbering walks the expression in evaluation order and gives the same
+ * number to constants that are equal, to reads of a variable that isn't
+ * written in between, and to operators and pure functions without state whose
+ * operands have the same numbers. Nodes that occur more than once share a
+ * result: expr_eval_block() computes it once per block and expr_eval() once
+ * per frame, the first occurrence to run computes it and the others copy it.
+ * Trees that functions evaluate themselves, like the clones of each(), are
+ * numbered too.
+ */
+struct expr_number {
+  enum expr_type type; /* OP_UNKNOWN once a variable read is invalidated */
+  const void *p;       /* variable or function */
+  float value;
+  int argc;
+  int argv[EXPR_BLOCK_MAX_ARGS];
+  int count;
+  int first; /* first use */
+  int slot;  /* shared result, -1 if none */
+};
+
+/* A node and its number, -1 if it can't be shared, in evaluation order. The
+ * uses of its subtree start at from */
+struct expr_use {
+  struct expr *e;
+  int num;
+  int from;
+};
+
+struct expr_numbering {
+  vec(struct expr_number) nums;
+  vec(struct expr_use) uses;
+  int error;
+};
+
+static int expr_number_value(struct expr_numbering *n, struct expr_number *v) {
+  for (int i = vec_len(&n->nums) - 1; i >= 0; i--) {
+    struct expr_number *u = &vec_nth(&n->nums, i);
+    if (u->type == v->type && u->p == v->p && u->argc == v->argc &&
+        memcmp(&u->value, &v->value, sizeof(v->value)) == 0 &&
+        memcmp(u->argv, v->argv, v->argc * sizeof(int)) == 0) {
+      return i;
+    }
+  }
+  v->count = 0;
+  v->first = -1;
+  v->slot = -1;
+  if (vec_push(&n->nums, *v) < 0) {
+    n->error = 1;
+    return -1;
+  }
+  return vec_len(&n->nums) - 1;
+}
+
+/* Forgets reads of the variables in a list that a function writes */
+static int expr_number_written(struct expr_numbering *n, struct expr *e) {
+  if (e->type == OP_VAR) {
+    for (int i = 0; i < vec_len(&n->nums); i++) {
+      struct expr_number *v = &vec_nth(&n->nums, i);
+      if (v->type == OP_VAR && v->p == e->param.var.value) {
+        v->type = OP_UNKNOWN;
+      }
+    }
+    return 1;
+  }
+  return e->type == OP_COMMA &&
+         expr_number_written(n, &vec_nth(&e->param.op.args, 0)) &&
+         expr_number_written(n, &vec_nth(&e->param.op.args, 1));
+}
+
+static void expr_number_assigns(struct expr_numbering *n, vec_expr_t *args) {
+  for (int i = 0; i < vec_len(args); i++) {
+    expr_number_written(n, &vec_nth(args, i));
+  }
+}
+
+static int expr_number_node(struct expr_numbering *n, struct expr *e) {
+  struct expr_number v;
+  struct expr_use use;
+  vec_expr_t *args = &e->param.op.args;
+  int shared = 1;
+  memset(&v, 0, sizeof(v));
+  v.type = e->type;
+  use.e = e;
+  use.from = vec_len(&n->uses);
+  if (e->type == OP_CONST) {
+    v.value = e->param.num.value;
+  } else if (e->type == OP_VAR) {
+    v.p = e->param.var.value;
+  } else if (e->type == OP_ASSIGN) {
+    expr_number_node(n, &vec_nth(args, 1));
+    expr_number_written(n, &vec_nth(args, 0));
+    shared = 0;
+  } else if (e->type == OP_FUNC) {
+    struct expr_func *f = e->param.func.f;
+    int assigns = (f->flags & EXPR_FUNC_ASSIGNS);
+    args = &e->param.func.args;
+    shared = (f->flags & EXPR_FUNC_PURE) && !assigns && f->ctxsz == 0 &&
+             vec_len(args) <= EXPR_BLOCK_MAX_ARGS;
+    for (int i = 0; i < vec_len(args); i++) {
+      /* Variables the function writes may change before any argument */
+      if (assigns) {
+        expr_number_assigns(n, args);
+        if (expr_number_written(n, &vec_nth(args, i))) {
+          continue;
+        }
+      }
+      int a = expr_number_node(n, &vec_nth(args, i));
+      shared = shared && a >= 0;
+      if (i < EXPR_BLOCK_MAX_ARGS) {
+        v.argv[i] = a;
+      }
+    }
+    if (f->trees != NULL) {
+      vec_expr_t *trees = f->trees(f, e->param.func.context);
+      for (int i = 0; i < vec_len(trees); i++) {
+        expr_number_assigns(n, args);
+        expr_number_node(n, &vec_nth(trees, i));
+      }
+    }
+    if (assigns) {
+      expr_number_assigns(n, args);
+    }
+    v.p = f;
+    v.argc = vec_len(args);
+  } else if (expr_is_unary(e->type) || expr_is_binary(e->type)) {
+    for (int i = 0; i < vec_len(args); i++) {
+      v.argv[i] = expr_number_node(n, &vec_nth(args, i));
+      shared = shared && v.argv[i] >= 0;
+    }
+    v.argc = vec_len(args);
+  } else {
+    shared = 0;
+  }
+  use.num = (shared ? expr_number_value(n, &v) : -1);
+  if (vec_push(&n->uses, use) < 0) {
+    n->error = 1;
+  }
+  return use.num;
+}
+
+/* Numbers the values, returns the number of shared results */
+static int expr_number(struct expr_numbering *n, struct expr *e) {
+  int nshared = 0;
+  expr_number_node(n, e);
+  if (n->error) {
+    return 0;
+  }
+  for (int i = 0; i < vec_len(&n->uses); i++) {
+    struct expr_number *v;
+    if (vec_nth(&n->uses, i).num >= 0) {
+      v = &vec_nth(&n->nums, vec_nth(&n->uses, i).num);
+      v->first = (v->first < 0 ? i : v->first);
+      v->count++;
+    }
+  }
+  /* Subtrees of later occurrences never run, outer ones are seen first */
+  for (int i = vec_len(&n->uses) - 1; i >= 0; i--) {
+    struct expr_use *use = &vec_nth(&n->uses, i);
+    if (use->num >= 0 && vec_nth(&n->nums, use->num).count > 1 &&
+        vec_nth(&n->nums, use->num).first != i) {
+      for (int j = use->from; j < i; j++) {
+        vec_nth(&n->uses, j).num = -1;
+      }
+    }
+  }
+  for (int i = 0; i < vec_len(&n->nums); i++) {
+    vec_nth(&n->nums, i).count = 0;
+  }
+  for (int i = 0; i < vec_len(&n->uses); i++) {
+    if (vec_nth(&n->uses, i).num >= 0) {
+      vec_nth(&n->nums, vec_nth(&n->uses, i).num).count++;
+    }
+  }
+  /* Constants and variables are read as cheaply as a shared result */
+  for (int i = 0; i < vec_len(&n->nums); i++) {
+    struct expr_number *v = &vec_nth(&n->nums, i);
+    if (v->count > 1 && v->type != OP_CONST && v->type != OP_VAR &&
+        v->type != OP_UNKNOWN) {
+      v->slot = nshared++;
+    }
+  }
+  return nshared;
+}
+
+/* Points the nodes to their shared results in the block */
+static void expr_block_share(struct expr_block *b, struct expr_numbering *n) {
+  for (int i = 0; i < b->nshared; i++) {
+    b->shared[i].frames = &b->frames;
+  }
+  for (int i = 0; i < vec_len(&n->uses); i++) {
+    struct expr_use *use = &vec_nth(&n->uses, i);
+    if (use->num >= 0 && vec_nth(&n->nums, use->num).slot >= 0) {
+      use->e->shared = &b->shared[vec_nth(&n->nums, use->num).slot];
+    }
+  }
+}
+
+/* Returns NULL if the expression can only be evaluated frame by frame.
+ * Driven variables are changed by the host on every frame, the first ndriven
+ * ramps belong to those of them that the expression uses. The host must fill
+ * them before every expr_eval_block() call. The first nwhole driven
+ * variables only ever hold whole numbers within the int32 range */
+static struct expr_block *expr_block_create(struct expr *e, float **driven,
+                                            int ndriven, int nwhole) {
+  struct expr_block *b = NULL;
+  vec_ref_t used = vec_init();
+  vec_ref_t assigned = vec_init();
+  vec_ref_t done = vec_init();
+  vec_ref_t ramps = vec_init();
+  vec_ref_t whole = vec_init();
+  struct expr_rates rates = {vec_init(), vec_init(), NULL, 0, 0};
+  struct expr_numbering numbering = {vec_init(), vec_init(), 0};
+  int nramps;
+  int nslots = 0;
+  int nshared;
+  float *buf;
+
+  expr_block_vars(e, &used, &assigned);
+  for (int i = 0; i < ndriven; i++) {
+    if (expr_ref_find(&assigned, driven[i]) != -1) {
+      goto cleanup; /* driven variables can't be assigned */
+    }
+    if (expr_ref_find(&used, driven[i]) != -1) {
+      vec_push(&ramps, driven[i]);
+    }
+    if (i < nwhole) {
+      vec_push(&whole, driven[i]);
+    }
+  }
+  ndriven = vec_len(&ramps);
+  if (expr_block_check(e, &assigned, &done, 0) < 0) {
+    goto cleanup;
+  }
+  for (int i = 0; i < vec_len(&assigned); i++) {
+    vec_push(&ramps, vec_nth(&assigned, i));
+  }
+
+  /* Assigned variables only ever get raised, repeat until they settle */
+  rates.assigned = &assigned;
+  for (int i = 0; i < ndriven; i++) {
+    if ((vec_push(&rates.audio, vec_nth(&ramps, i))) == -1) {
+      goto cleanup;
+    }
+  }
+  do {
+    rates.changed = 0;
+    expr_block_rate(e, &rates);
+  } while (rates.changed && !rates.error);
+  if (rates.error) {
+    goto cleanup;
+  }
+  expr_block_slots(e, 1, &nslots);
+  expr_block_ints(e, &whole);
+  nshared = expr_number(&numbering, e);
+
+  nramps = vec_len(&ramps);
+  b = (struct expr_block *)calloc(
+      1, sizeof(struct expr_block) +
+             nramps * (sizeof(struct expr_ramp) +
+                       EXPR_BLOCK_SIZE * sizeof(float)) +
+             nshared * (sizeof(struct expr_shared) +
+                        EXPR_BLOCK_SIZE * sizeof(float)) +
+             nslots * sizeof(float));
+  if (b == NULL) {
+    goto cleanup;
+  }
+  b->nramps = nramps;
+  b->ndriven = ndriven;
+  b->ramps = (struct expr_ramp *)(b + 1);
+  b->nshared = nshared;
+  b->shared = (struct expr_shared *)(b->ramps + nramps);
+  buf = (float *)(b->shared + nshared);
+  for (int i = 0; i < nramps; i++) {
+    b->ramps[i].value = vec_nth(&ramps, i);
+    b->ramps[i].buf = buf + i * EXPR_BLOCK_SIZE;
+  }
+  buf = buf + nramps * EXPR_BLOCK_SIZE;
+  for (int i = 0; i < nshared; i++) {
+    b->shared[i].buf = buf + i * EXPR_BLOCK_SIZE;
+  }
+  b->nslots = nslots;
+  b->prev = buf + nshared * EXPR_BLOCK_SIZE;
+  for (int i = 0; i < nslots; i++) {
+    b->prev[i] = NAN;
+  }
+  /* Nothing has been computed yet */
+  b->frames = b->blocks = 1;
+  expr_block_share(b, &numbering);
+cleanup:
+  vec_free(&used);
+  vec_free(&assigned);
+  vec_free(&done);
+  vec_free(&ramps);
+  vec_free(&whole);
+  vec_free(&rates.audio);
+  vec_free(&rates.block);
+  vec_free(&numbering.nums);
+  vec_free(&numbering.uses);
+  return b;
+}
+
+static void expr_block_destroy(struct expr_block *b) { free(b); }
+
+static float *expr_block_ramp(struct expr_block *b, float *value) {
+  for (int i = 0; i < b->nramps; i++) {
+    if (b->ramps[i].value == value) {
+      return b->ramps[i].buf;
+    }
+  }
+  return NULL;
+}
+
+/* Sets variables to their values at the given frame of the block */
+static void expr_block_frame(struct expr_block *b, int frame) {
+  for (int i = 0; i < b->nramps; i++) {
+    *b->ramps[i].value = b->ramps[i].buf[frame];
+  }
+  b->frames++;
+}
+
+/* Fills the block with a value computed once, gliding from the previous one
+ * if smoothing is enabled */
+static void expr_block_fill(struct expr_block *b, struct expr *e, float v,
+                            float *out) {
+  int n = b->n;
+  float from = v;
+  if (b->smooth && e->slot > 0) {
+    float *prev = &b->prev[e->slot - 1];
+    if (!isnan(*prev) && !isnan(v)) {
+      from = *prev;
+    }
+    *prev = v;
+  }
+  if (from == v) {
+    for (int i = 0; i < n; i++) {
+      out[i] = v;
+    }
+  } else {
+    for (int i = 0; i < n; i++) {
+      out[i] = from + (v - from) * (i + 1) / n;
+    }
+  }
+}
+
+/* All frames hold the same value */
+static int expr_block_uniform(const float *buf, int n) {
+  return n < 2 || memcmp(buf, buf + 1, (n - 1) * sizeof(float)) == 0;
+}
+
+/*
+ * Integer lanes
+ *
+ * Operators tagged by expr_block_ints() compute int32 results for the whole
+ * block, reading their operands like to_int() does. Results wider than a
+ * float mantissa are rounded through a float before another operator reads
+ * them, as their float values would be.
+ */
+#ifdef SIMD_LANES
+#define EXPR_INT_LOOP(i, n, vector, scalar)                                    \
+  do {                                                                         \
+    int i = 0;                                                                 \
+    for (; i + SIMD_LANES <= (n); i += SIMD_LANES) {                           \
+      vector;                                                                  \
+    }                                                                          \
+    for (; i < (n); i++) {                                                     \
+      scalar;                                                                  \
+    }                                                                          \
+  } while (0)
+#else
+#define EXPR_INT_LOOP(i, n, vector, scalar)                                    \
+  do {                                                                         \
+    for (int i = 0; i < (n); i++) {                                            \
+      scalar;                                                                  \
+    }                                                                          \
+  } while (0)
+#endif
+
+static void expr_int_from_float(const float *x, int32_t *out, int n) {
+  int i = 0;
+#ifdef SIMD_LANES
+  simd_i pinf = simd_set1i(to_int(INFINITY));
+  simd_i ninf = simd_set1i(to_int(-INFINITY));
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_f v = simd_loadf(x + i);
+    simd_i r = simd_andi(simd_ftoit(v), simd_castfi(simd_ordf(v)));
+    r = simd_selecti(simd_castfi(simd_eqf(v, simd_set1f(INFINITY))), pinf, r);
+    r = simd_selecti(simd_castfi(simd_eqf(v, simd_set1f(-INFINITY))), ninf,
+                     r);
+    simd_storei(out + i, r);
+  }
+#endif
+  for (; i < n; i++) {
+    out[i] = to_int(x[i]);
+  }
+}
+
+/* Float values of the results. A zero remainder of a negative dividend is
+ * negative zero, like fmodf() returns */
+static void expr_int_to_float(const int32_t *r, const int32_t *dividend,
+                              float *out, int n) {
+  if (dividend == NULL) {
+    EXPR_INT_LOOP(i, n, simd_storef(out + i, simd_itof(simd_loadi(r + i))),
+                  out[i] = (float)r[i]);
+    return;
+  }
+  EXPR_INT_LOOP(
+      i, n,
+      simd_storef(out + i, simd_orf(simd_itof(simd_loadi(r + i)),
+                                    simd_castif(simd_andi(
+                                        simd_loadi(dividend + i),
+                                        simd_set1i(INT32_MIN))))),
+      out[i] = (dividend[i] < 0 && r[i] == 0 ? -0.f : (float)r[i]));
+}
+
+static void expr_int_round(int32_t *r, int n) {
+  EXPR_INT_LOOP(i, n,
+                simd_storei(r + i, simd_ftoit(simd_itof(simd_loadi(r + i)))),
+                r[i] = to_int((float)r[i]));
+}
+
+/* Shift counts wrap around like they do on x86 */
+static void expr_int_shift(int32_t *a, const int32_t *k, int left, int n) {
+  if (memcmp(k, k + 1, (n - 1) * sizeof(int32_t)) != 0) {
+    for (int i = 0; i < n; i++) {
+      a[i] = (left ? (int32_t)((uint32_t)a[i] << (k[i] & 31))
+                   : a[i] >> (k[i] & 31));
+    }
+    return;
+  }
+  int c = k[0] & 31;
+  if (left) {
+    EXPR_INT_LOOP(i, n, simd_storei(a + i, simd_sllci(simd_loadi(a + i), c)),
+                  a[i] = (int32_t)((uint32_t)a[i] << c));
+  } else {
+    EXPR_INT_LOOP(i, n, simd_storei(a + i, simd_sraci(simd_loadi(a + i), c)),
+                  a[i] = a[i] >> c);
+  }
+}
+
+/* Remainder by a constant, a power of two is masked with the result moved
+ * below zero for negative dividends */
+static void expr_int_rem(const int32_t *a, int32_t *r, int32_t c, int n) {
+  int32_t m = (c < 0 ? -c : c);
+  if ((m & (m - 1)) != 0) {
+    for (int i = 0; i < n; i++) {
+      r[i] = a[i] % c;
+    }
+    return;
+  }
+  int i = 0;
+#ifdef SIMD_LANES
+  simd_i zero = simd_set1i(0);
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_i x = simd_loadi(a + i);
+    simd_i y = simd_andi(x, simd_set1i(m - 1));
+    simd_i neg = simd_andnoti(simd_eqi(y, zero), simd_gti(zero, x));
+    simd_storei(r + i, simd_subi(y, simd_andi(neg, simd_set1i(m))));
+  }
+#endif
+  for (; i < n; i++) {
+    int32_t y = a[i] & (m - 1);
+    r[i] = (a[i] < 0 && y != 0 ? y - m : y);
+  }
+}
+
+static void expr_eval_block(struct expr *e, float *out, struct expr_block *b);
+static void expr_eval_block_int(struct expr *e, int32_t *out,
+                                struct expr_block *b);
+
+/* Reads the node as an integer operand, i.e. to_int() of its float value */
+static void expr_block_operand(struct expr *e, int32_t *out,
+                               struct expr_block *b) {
+  if (e->bits > 0 && e->rate == EXPR_RATE_AUDIO && e->shared == NULL) {
+    expr_eval_block_int(e, out, b);
+    if (e->bits > 25) {
+      expr_int_round(out, b->n);
+    }
+  } else if (e->type == OP_CONST) {
+    int32_t v = to_int(e->param.num.value);
+    for (int i = 0; i < b->n; i++) {
+      out[i] = v;
+    }
+  } else {
+    float tmp[EXPR_BLOCK_SIZE];
+    expr_eval_block(e, tmp, b);
+    expr_int_from_float(tmp, out, b->n);
+  }
+}
+
+static void expr_eval_block_int(struct expr *e, int32_t *out,
+                                struct expr_block *b) {
+  int32_t tmp[EXPR_BLOCK_SIZE];
+  vec_expr_t *args = &e->param.op.args;
+  struct expr *rhs = &vec_nth(args, vec_len(args) - 1);
+  int n = b->n;
+  expr_block_operand(&vec_nth(args, 0), out, b);
+  switch (e->type) {
+  case OP_UNARY_BITWISE_NOT:
+    EXPR_INT_LOOP(i, n,
+                  simd_storei(out + i, simd_xori(simd_loadi(out + i),
+                                                 simd_set1i(-1))),
+                  out[i] = ~out[i]);
+    return;
+  case OP_REMAINDER:
+    expr_int_rem(out, out, to_int(rhs->param.num.value), n);
+    return;
+  default:
+    break;
+  }
+  expr_block_operand(rhs, tmp, b);
+  switch (e->type) {
+  case OP_SHL:
+  case OP_SHR:
+    expr_int_shift(out, tmp, e->type == OP_SHL, n);
+    break;
+  case OP_BITWISE_AND:
+    EXPR_INT_LOOP(i, n,
+                  simd_storei(out + i, simd_andi(simd_loadi(out + i),
+                                                 simd_loadi(tmp + i))),
+                  out[i] = out[i] & tmp[i]);
+    break;
+  case OP_BITWISE_OR:
+    EXPR_INT_LOOP(i, n,
+                  simd_storei(out + i, simd_ori(simd_loadi(out + i),
+                                                simd_loadi(tmp + i))),
+                  out[i] = out[i] | tmp[i]);
+    break;
+  case OP_BITWISE_XOR:
+    EXPR_INT_LOOP(i, n,
+                  simd_storei(out + i, simd_xori(simd_loadi(out + i),
+                                                 simd_loadi(tmp + i))),
+                  out[i] = out[i] ^ tmp[i]);
+    break;
+  default:
+    break;
+  }
+}
+
+static void expr_eval_frames(struct expr *e, float *out, struct expr_block *b) {
+  for (int i = 0; i < b->n; i++) {
+    expr_block_frame(b, i);
+    out[i] = expr_eval(e);
+  }
+}
+
+#define EXPR_BLOCK_UNARY(e, out, b, x, result)                                 \
+  do {                                                                         \
+    expr_eval_block(&vec_nth(&(e)->param.op.args, 0), (out), (b));             \
+    for (int i = 0; i < (b)->n; i++) {                                         \
+      float x = (out)[i];                                                      \
+      (out)[i] = (result);                                                     \
+    }                                                                          \
+  } while (0)
+
+#define EXPR_BLOCK_BINARY(e, out, b, x, y, result)                             \
+  do {                                                                         \
+    float tmp[EXPR_BLOCK_SIZE];                                                \
+    expr_eval_block(&vec_nth(&(e)->param.op.args, 0), (out), (b));             \
+    expr_eval_block(&vec_nth(&(e)->param.op.args, 1), tmp, (b));               \
+    for (int i = 0; i < (b)->n; i++) {                                         \
+      float x = (out)[i];                                                      \
+      float y = tmp[i];                                                        \
+      (out)[i] = (result);                                                     \
+    }                                                                          \
+  } while (0)
+
+static void expr_eval_block_node(struct expr *e, float *out,
+                                 struct expr_block *b);
+
+/* Shared values are computed once per block */
+static void expr_eval_block(struct expr *e, float *out, struct expr_block *b) {
+  struct expr_shared *s = e->shared;
+  if (s == NULL) {
+    expr_eval_block_node(e, out, b);
+    return;
+  } else if (s->block != b->blocks) {
+    expr_eval_block_node(e, s->buf, b);
+    s->block = b->blocks;
+  }
+  memcpy(out, s->buf, b->n * sizeof(float));
+}
+
+static void expr_eval_block_node(struct expr *e, float *out,
+                                 struct expr_block *b) {
+  int n = b->n;
+  struct expr *rhs;
+  float *buf;
+  if (e->rate != EXPR_RATE_AUDIO && e->type != OP_CONST) {
+    expr_block_fill(b, e, expr_eval(e), out);
+    return;
+  }
+  if (e->bits > 0) {
+    int32_t r[EXPR_BLOCK_SIZE];
+    int32_t lhs[EXPR_BLOCK_SIZE];
+    if (e->type == OP_REMAINDER) {
+      rhs = &vec_nth(&e->param.op.args, 1);
+      expr_block_operand(&vec_nth(&e->param.op.args, 0), lhs, b);
+      expr_int_rem(lhs, r, to_int(rhs->param.num.value), n);
+      expr_int_to_float(r, lhs, out, n);
+    } else {
+      expr_eval_block_int(e, r, b);
+      expr_int_to_float(r, NULL, out, n);
+    }
+    return;
+  }
+  switch (e->type) {
+  case OP_UNARY_MINUS:
+    EXPR_BLOCK_UNARY(e, out, b, x, -x);
+    break;
+  case OP_UNARY_LOGICAL_NOT:
+    EXPR_BLOCK_UNARY(e, out, b, x, !x);
+    break;
+  case OP_POWER:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, powf(x, y));
+    break;
+  case OP_MULTIPLY:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x * y);
+    break;
+  case OP_DIVIDE:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x / y);
+    break;
+  case OP_REMAINDER:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, fmodf(x, y));
+    break;
+  case OP_PLUS:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x + y);
+    break;
+  case OP_MINUS:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x - y);
+    break;
+  case OP_LT:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x < y);
+    break;
+  case OP_LE:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x <= y);
+    break;
+  case OP_GT:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x > y);
+    break;
+  case OP_GE:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x >= y);
+    break;
+  case OP_EQ:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x == y);
+    break;
+  case OP_NE:
+    EXPR_BLOCK_BINARY(e, out, b, x, y, x != y);
+    break;
+  case OP_LOGICAL_AND:
+  case OP_LOGICAL_OR:
+    /* Right operand is evaluated conditionally, only constants and variables
+     * are safe to evaluate for the whole block */
+    rhs = &vec_nth(&e->param.op.args, 1);
+    if (rhs->type != OP_CONST && rhs->type != OP_VAR) {
+      expr_eval_frames(e, out, b);
+    } else if (e->type == OP_LOGICAL_AND) {
+      EXPR_BLOCK_BINARY(e, out, b, x, y, (x != 0 && y != 0 ? y : 0));
+    } else {
+      EXPR_BLOCK_BINARY(e, out, b, x, y,
+                        (x != 0 && !isnan(x) ? x : (y != 0 ? y : 0)));
+    }
+    break;
+  case OP_ASSIGN:
+    expr_eval_block(&vec_nth(&e->param.op.args, 1), out, b);
+    if (vec_nth(&e->param.op.args, 0).type == OP_VAR) {
+      float *value = vec_nth(&e->param.op.args, 0).param.var.value;
+      if ((buf = expr_block_ramp(b, value)) != NULL) {
+        memcpy(buf, out, n * sizeof(float));
+      }
+      *value = out[n - 1];
+    }
+    break;
+  case OP_COMMA: {
+    float tmp[EXPR_BLOCK_SIZE];
+    expr_eval_block(&vec_nth(&e->param.op.args, 0), tmp, b);
+    expr_eval_block(&vec_nth(&e->param.op.args, 1), out, b);
+    break;
+  }
+  case OP_CONST:
+    for (int i = 0; i < n; i++) {
+      out[i] = e->param.num.value;
+    }
+    break;
+  case OP_VAR:
+    if ((buf = expr_block_ramp(b, e->param.var.value)) != NULL) {
+      memcpy(out, buf, n * sizeof(float));
+    } else {
+      for (int i = 0; i < n; i++) {
+        out[i] = *e->param.var.value;
+      }
+    }
+    break;
+  case OP_FUNC: {
+    struct expr_func *f = e->param.func.f;
+    vec_expr_t *args = &e->param.func.args;
+    if (f->block == NULL || vec_len(args) > EXPR_BLOCK_MAX_ARGS) {
+      expr_eval_frames(e, out, b);
+      break;
+    }
+    float argbuf[EXPR_BLOCK_MAX_ARGS][EXPR_BLOCK_SIZE];
+    float *argv[EXPR_BLOCK_MAX_ARGS];
+    int uniform = (f->flags & EXPR_FUNC_PURE);
+    for (int i = 0; i < vec_len(args); i++) {
+      argv[i] = argbuf[i];
+      expr_eval_block(&vec_nth(args, i), argv[i], b);
+      uniform = uniform && expr_block_uniform(argv[i], n);
+    }
+    if (uniform) {
+      f->block(f, argv, vec_len(args), e->param.func.context, out, 1);
+      for (int i = 1; i < n; i++) {
+        out[i] = out[0];
+      }
+      break;
+    }
+    f->block(f, argv, vec_len(args), e->param.func.context, out, n);
+    break;
+  }
+  default:
+    for (int i = 0; i < n; i++) {
+      out[i] = NAN;
+    }
+  }
+}
+
+/* Leaves assigned variables with their values from the last frame */
+static void expr_block_finish(struct expr_block *b) {
+  for (int i = b->ndriven; i < b->nramps; i++) {
+    *b->ramps[i].value = b->ramps[i].buf[b->n - 1];
+  }
+  b->frames++;
+  b->blocks++;
+}
+
+/*
+ * Bytecode
+ *
+ * expr_compile() lowers the expression tree into a flat program of
+ * instructions over numbered float registers, expr_run() executes it. Every
+ * node gets its own register, constants are preloaded. Functions with a block
+ * variant get their arguments evaluated into registers and render a single
+ * frame, other functions receive their argument trees and evaluate them with
+ * expr_eval(). The tree walker remains the reference implementation.
+ *
+ * Identical constants share a register, and local value numbering computes
+ * repeated operators, variable reads and pure function calls once. A value
+ * is reused only where it's been computed on every path, so values from the
+ * right-hand side of && and || are forgotten after it. Assignments and
+ * functions that evaluate argument trees invalidate variable reads.
+ */
+/* Operator opcodes follow the order of enum expr_type */
+#define EXPR_OPCODE(type) ((enum expr_opcode)((type)-OP_UNARY_MINUS))
+enum expr_opcode {
+  EXPR_OP_NEG,
+  EXPR_OP_NOT,
+  EXPR_OP_BITNOT,
+  EXPR_OP_POW,
+  EXPR_OP_DIV,
+  EXPR_OP_MUL,
+  EXPR_OP_MOD,
+  EXPR_OP_ADD,
+  EXPR_OP_SUB,
+  EXPR_OP_SHL,
+  EXPR_OP_SHR,
+  EXPR_OP_LT,
+  EXPR_OP_LE,
+  EXPR_OP_GT,
+  EXPR_OP_GE,
+  EXPR_OP_EQ,
+  EXPR_OP_NE,
+  EXPR_OP_AND,
+  EXPR_OP_OR,
+  EXPR_OP_XOR,
+  EXPR_OP_MOVE,  /* r[dst] = r[a] */
+  EXPR_OP_TRUTH, /* r[dst] = r[a] != 0 ? r[a] : 0 */
+  EXPR_OP_LOAD,  /* r[dst] = *var */
+  EXPR_OP_STORE, /* *var = r[a] */
+  EXPR_OP_JZ,    /* if r[dst] == 0, r[dst] = 0 and jump to b */
+  EXPR_OP_JNZ,   /* if r[dst] != 0 and not NaN, jump to b */
+  EXPR_OP_CALL,  /* r[dst] = f(args) */
+  EXPR_OP_CALLB, /* r[dst] = f(r[argv[0]]...r[argv[a-1]]) */
+  EXPR_OP_RET,   /* return r[a] */
+};
+
+struct expr_insn {
+  enum expr_opcode op;
+  int dst;
+  int a;
+  int b;
+  union {
+    float *var;
+    struct expr *e;
+  } p;
+  float **argv;
+};
+
+struct expr_prog {
+  int len;
+  int nregs;
+  struct expr_insn *code;
+  float *regs;
+  float (*native)(void); /* set by expr_jit() */
+  void *native_mem;
+  size_t native_size;
+};
+
+/* A value computed by an instruction, invalidated ones have op set to -1 */
+struct expr_value {
+  int op;
+  int a;
+  int b;
+  const void *p;
+  int reg;
+};
+
+struct expr_compiler {
+  vec(struct expr_insn) code;
+  vec(float) regs;  /* initial register values */
+  vec(int) argregs; /* argument registers of CALLB instructions */
+  vec(int) consts;  /* registers holding constants */
+  vec(struct expr_value) values;
+};
+
+static int expr_compile_reg(struct expr_compiler *c, float value) {
+  return vec_push(&c->regs, value) ? -1 : vec_len(&c->regs) - 1;
+}
+
+static int expr_compile_const(struct expr_compiler *c, float value) {
+  int reg;
+  for (int i = 0; i < vec_len(&c->consts); i++) {
+    reg = vec_nth(&c->consts, i);
+    if (memcmp(&vec_nth(&c->regs, reg), &value, sizeof(value)) == 0) {
+      return reg;
+    }
+  }
+  if ((reg = expr_compile_reg(c, value)) < 0 ||
+      vec_push(&c->consts, reg) < 0) {
+    return -1;
+  }
+  return reg;
+}
+
+/* Returns the register already holding the value, -1 if there is none. Pure
+ * calls are looked up by their argument registers in argv */
+static int expr_compile_lookup(struct expr_compiler *c, int op, int a, int b,
+                               const void *p, int *argv) {
+  for (int i = vec_len(&c->values) - 1; i >= 0; i--) {
+    struct expr_value *v = &vec_nth(&c->values, i);
+    if (v->op != op || v->a != a || v->p != p) {
+      continue;
+    }
+    if (argv == NULL ? v->b == b
+                     : memcmp(&vec_nth(&c->argregs, v->b), argv,
+                              a * sizeof(int)) == 0) {
+      return v->reg;
+    }
+  }
+  return -1;
+}
+
+static int expr_compile_value(struct expr_compiler *c, int op, int a, int b,
+                              const void *p, int reg) {
+  struct expr_value v;
+  v.op = op;
+  v.a = a;
+  v.b = b;
+  v.p = p;
+  v.reg = reg;
+  return vec_push(&c->values, v);
+}
+
+/* Forgets reads of the variable, or of all variables if it's NULL */
+static void expr_compile_invalidate(struct expr_compiler *c, float *var) {
+  for (int i = 0; i < vec_len(&c->values); i++) {
+    struct expr_value *v = &vec_nth(&c->values, i);
+    if (v->op == EXPR_OP_LOAD && (var == NULL || v->p == var)) {
+      v->op = -1;
+    }
+  }
+}
+
+static int expr_compile_emit(struct expr_compiler *c, enum expr_opcode op,
+                             int dst, int a, int b) {
+  struct expr_insn insn;
+  memset(&insn, 0, sizeof(insn));
+  insn.op = op;
+  insn.dst = dst;
+  insn.a = a;
+  insn.b = b;
+  return vec_push(&c->code, insn) ? -1 : vec_len(&c->code) - 1;
+}
+
+/* Returns the register holding the result of the node, -1 on error */
+static int expr_compile_node(struct expr_compiler *c, struct expr *e) {
+  int dst, a, b, jump, known;
+  vec_expr_t *args = &e->param.op.args;
+  switch (e->type) {
+  case OP_CONST:
+    return expr_compile_const(c, e->param.num.value);
+  case OP_VAR:
+    if ((dst = expr_compile_lookup(c, EXPR_OP_LOAD, 0, 0, e->param.var.value,
+                                   NULL)) >= 0) {
+      return dst;
+    }
+    if ((dst = expr_compile_reg(c, 0)) < 0 ||
+        (a = expr_compile_emit(c, EXPR_OP_LOAD, dst, 0, 0)) < 0 ||
+        expr_compile_value(c, EXPR_OP_LOAD, 0, 0, e->param.var.value, dst) <
+            0) {
+      return -1;
+    }
+    vec_nth(&c->code, a).p.var = e->param.var.value;
+    return dst;
+  case OP_UNARY_MINUS:
+  case OP_UNARY_LOGICAL_NOT:
+  case OP_UNARY_BITWISE_NOT:
+    if ((a = expr_compile_node(c, &vec_nth(args, 0))) < 0) {
+      return -1;
+    }
+    if ((dst = expr_compile_lookup(c, EXPR_OPCODE(e->type), a, 0, NULL,
+                                   NULL)) >= 0) {
+      return dst;
+    }
+    if ((dst = expr_compile_reg(c, 0)) < 0 ||
+        expr_compile_emit(c, EXPR_OPCODE(e->type), dst, a, 0) < 0 ||
+        expr_compile_value(c, EXPR_OPCODE(e->type), a, 0, NULL, dst) < 0) {
+      return -1;
+    }
+    return dst;
+  case OP_LOGICAL_AND:
+  case OP_LOGICAL_OR:
+    if ((a = expr_compile_node(c, &vec_nth(args, 0))) < 0 ||
+        (dst = expr_compile_reg(c, 0)) < 0 ||
+        expr_compile_emit(c, EXPR_OP_MOVE, dst, a, 0) < 0 ||
+        (jump = expr_compile_emit(
+             c, e->type == OP_LOGICAL_AND ? EXPR_OP_JZ : EXPR_OP_JNZ, dst, 0,
+             0)) < 0) {
+      return -1;
+    }
+    known = vec_len(&c->values);
+    if ((b = expr_compile_node(c, &vec_nth(args, 1))) < 0 ||
+        expr_compile_emit(c, EXPR_OP_TRUTH, dst, b, 0) < 0) {
+      return -1;
+    }
+    c->values.len = known;
+    vec_nth(&c->code, jump).b = vec_len(&c->code);
+    return dst;
+  case OP_ASSIGN:
+    if ((b = expr_compile_node(c, &vec_nth(args, 1))) < 0) {
+      return -1;
+    }
+    if (vec_nth(args, 0).type == OP_VAR) {
+      float *var = vec_nth(args, 0).param.var.value;
+      if ((a = expr_compile_emit(c, EXPR_OP_STORE, 0, b, 0)) < 0) {
+        return -1;
+      }
+      vec_nth(&c->code, a).p.var = var;
+      /* Later reads get the assigned value */
+      expr_compile_invalidate(c, var);
+      if (expr_compile_value(c, EXPR_OP_LOAD, 0, 0, var, b) < 0) {
+        return -1;
+      }
+    }
+    return b;
+  case OP_COMMA:
+    if (expr_compile_node(c, &vec_nth(args, 0)) < 0) {
+      return -1;
+    }
+    return expr_compile_node(c, &vec_nth(args, 1));
+  case OP_FUNC: {
+    struct expr_func *f = e->param.func.f;
+    int argc = vec_len(&e->param.func.args);
+    int call;
+    if (f->block == NULL || argc > EXPR_BLOCK_MAX_ARGS) {
+      if ((dst = expr_compile_reg(c, 0)) < 0 ||
+          (call = expr_compile_emit(c, EXPR_OP_CALL, dst, 0, 0)) < 0) {
+        return -1;
+      }
+      vec_nth(&c->code, call).p.e = e;
+      /* Argument trees may assign variables */
+      expr_compile_invalidate(c, NULL);
+      return dst;
+    }
+    int argv[EXPR_BLOCK_MAX_ARGS];
+    for (int i = 0; i < argc; i++) {
+      if ((argv[i] = expr_compile_node(c, &vec_nth(&e->param.func.args, i))) <
+          0) {
+        return -1;
+      }
+    }
+    /* Functions with state are called every time */
+    int pure = (f->flags & EXPR_FUNC_PURE);
+    if (pure && (dst = expr_compile_lookup(c, EXPR_OP_CALLB, argc, 0, f,
+                                           argv)) >= 0) {
+      return dst;
+    }
+    if ((dst = expr_compile_reg(c, 0)) < 0 ||
+        (call = expr_compile_emit(c, EXPR_OP_CALLB, dst, argc,
+                                  vec_len(&c->argregs))) < 0 ||
+        (pure && expr_compile_value(c, EXPR_OP_CALLB, argc,
+                                    vec_len(&c->argregs), f, dst) < 0)) {
+      return -1;
+    }
+    vec_nth(&c->code, call).p.e = e;
+    for (int i = 0; i < argc; i++) {
+      if (vec_push(&c->argregs, argv[i]) < 0) {
+        return -1;
+      }
+    }
+    return dst;
+  }
+  default:
+    if (!expr_is_binary(e->type)) {
+      return expr_compile_reg(c, NAN);
+    }
+    if ((a = expr_compile_node(c, &vec_nth(args, 0))) < 0 ||
+        (b = expr_compile_node(c, &vec_nth(args, 1))) < 0) {
+      return -1;
+    }
+    if ((dst = expr_compile_lookup(c, EXPR_OPCODE(e->type), a, b, NULL,
+                                   NULL)) >= 0) {
+      return dst;
+    }
+    if ((dst = expr_compile_reg(c, 0)) < 0 ||
+        expr_compile_emit(c, EXPR_OPCODE(e->type), dst, a, b) < 0 ||
+        expr_compile_value(c, EXPR_OPCODE(e->type), a, b, NULL, dst) < 0) {
+      return -1;
+    }
+    return dst;
+  }
+}
+
+/* Returns NULL if the program can't be allocated */
+static struct expr_prog *expr_compile(struct expr *e) {
+  struct expr_compiler c = {vec_init(), vec_init(), vec_init(), vec_init(),
+                            vec_init()};
+  struct expr_prog *p = NULL;
+  float **argv;
+  int result = expr_compile_node(&c, e);
+  if (result < 0 || expr_compile_emit(&c, EXPR_OP_RET, 0, result, 0) < 0) {
+    goto cleanup;
+  }
+
+  /* Instructions, argument pointers and registers share one allocation */
+  p = (struct expr_prog *)calloc(
+      1, sizeof(struct expr_prog) +
+             vec_len(&c.code) * sizeof(struct expr_insn) +
+             vec_len(&c.argregs) * sizeof(float *) +
+             vec_len(&c.regs) * sizeof(float));
+  if (p == NULL) {
+    goto cleanup;
+  }
+  p->len = vec_len(&c.code);
+  p->nregs = vec_len(&c.regs);
+  p->code = (struct expr_insn *)(p + 1);
+  argv = (float **)(p->code + p->len);
+  p->regs = (float *)(argv + vec_len(&c.argregs));
+  memcpy(p->code, c.code.buf, p->len * sizeof(struct expr_insn));
+  memcpy(p->regs, c.regs.buf, p->nregs * sizeof(float));
+  for (int i = 0; i < vec_len(&c.argregs); i++) {
+    argv[i] = p->regs + vec_nth(&c.argregs, i);
+  }
+  for (int i = 0; i < p->len; i++) {
+    if (p->code[i].op == EXPR_OP_CALLB) {
+      p->code[i].argv = argv + p->code[i].b;
+    }
+  }
+cleanup:
+  vec_free(&c.code);
+  vec_free(&c.regs);
+  vec_free(&c.argregs);
+  vec_free(&c.consts);
+  vec_free(&c.values);
+  return p;
+}
+
+/*
+ * JIT
+ *
+ * On x86-64 System V platforms expr_jit() translates the bytecode into native
+ * code: operators become inline SSE instructions on the register file,
+ * functions become direct calls with their arguments and contexts baked in.
+ * expr_run() uses native code when it's available. Define EXPR_NO_JIT to
+ * disable it, the program is then interpreted.
+ */
+#if defined(__x86_64__) && !defined(_WIN32) && !defined(EXPR_NO_JIT)
+#define EXPR_JIT
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+struct expr_jit_buf {
+  unsigned char *code;
+  size_t len;
+};
+
+static void expr_jit_bytes(struct expr_jit_buf *b, const char *s, int n) {
+  memcpy(b->code + b->len, s, n);
+  b->len += n;
+}
+
+static void expr_jit_u32(struct expr_jit_buf *b, unsigned int x) {
+  memcpy(b->code + b->len, &x, 4);
+  b->len += 4;
+}
+
+static void expr_jit_u64(struct expr_jit_buf *b, const void *p) {
+  memcpy(b->code + b->len, &p, 8);
+  b->len += 8;
+}
+
+/* Emits an instruction addressing r[reg] as [rbx+disp32] */
+static void expr_jit_reg(struct expr_jit_buf *b, const char *op, int n,
+                         int modrm, int reg) {
+  expr_jit_bytes(b, op, n);
+  b->code[b->len++] = (unsigned char)(0x83 | (modrm << 3));
+  expr_jit_u32(b, reg * sizeof(float));
+}
+
+#define EXPR_JIT_EMIT(b, s) expr_jit_bytes(b, s, sizeof(s) - 1)
+#define EXPR_JIT_MOVSS_LOAD(b, xmm, reg)                                       \
+  expr_jit_reg(b, "\xf3\x0f\x10", 3, xmm, reg)
+#define EXPR_JIT_MOVSS_STORE(b, xmm, reg)                                      \
+  expr_jit_reg(b, "\xf3\x0f\x11", 3, xmm, reg)
+#define EXPR_JIT_MOV_LOAD(b, reg) expr_jit_reg(b, "\x8b", 1, 0, reg)
+#define EXPR_JIT_MOV_STORE(b, reg) expr_jit_reg(b, "\x89", 1, 0, reg)
+
+/* Function pointers are stored as data, C doesn't convert them to void * */
+static void expr_jit_call(struct expr_jit_buf *b, const void *fn) {
+  EXPR_JIT_EMIT(b, "\x48\xb8"); /* mov rax, fn */
+  memcpy(b->code + b->len, fn, 8);
+  b->len += 8;
+  EXPR_JIT_EMIT(b, "\xff\xd0"); /* call rax */
+}
+
+/* Converts r[reg] into eax like to_int() does. Truncation covers the common
+ * case, the "integer indefinite" result is resolved by calling to_int() */
+static void expr_jit_to_int(struct expr_jit_buf *b, int reg) {
+  int (*fn)(float) = to_int;
+  EXPR_JIT_MOVSS_LOAD(b, 0, reg);
+  EXPR_JIT_EMIT(b, "\xf3\x0f\x2c\xc0");     /* cvttss2si eax, xmm0 */
+  EXPR_JIT_EMIT(b, "\x3d\x00\x00\x00\x80"); /* cmp eax, INT_MIN */
+  EXPR_JIT_EMIT(b, "\x75\x0c");             /* jne +12 */
+  expr_jit_call(b, &fn);
+}
+
+/* Stores eax converted to float into r[reg] */
+static void expr_jit_from_int(struct expr_jit_buf *b, int reg) {
+  EXPR_JIT_EMIT(b, "\xf3\x0f\x2a\xc0"); /* cvtsi2ss xmm0, eax */
+  EXPR_JIT_MOVSS_STORE(b, 0, reg);
+}
+
+/* Stores 1.0 or 0.0 into r[reg] depending on the comparison mask in xmm0 */
+static void expr_jit_mask(struct expr_jit_buf *b, int reg) {
+  EXPR_JIT_EMIT(b, "\x66\x0f\x7e\xc0");     /* movd eax, xmm0 */
+  EXPR_JIT_EMIT(b, "\x25\x00\x00\x80\x3f"); /* and eax, 1.0f */
+  EXPR_JIT_MOV_STORE(b, reg);
+}
+
+/* Compares r[a] with r[b] using cmpss predicate */
+static void expr_jit_cmp(struct expr_jit_buf *b, struct expr_insn *insn,
+                         int swap, char pred) {
+  EXPR_JIT_MOVSS_LOAD(b, 0, swap ? insn->b : insn->a);
+  EXPR_JIT_MOVSS_LOAD(b, 1, swap ? insn->a : insn->b);
+  EXPR_JIT_EMIT(b, "\xf3\x0f\xc2\xc1"); /* cmpss xmm0, xmm1, pred */
+  b->code[b->len++] = pred;
+  expr_jit_mask(b, insn->dst);
+}
+
+static void expr_jit_release(struct expr_prog *p) {
+  if (p->native_mem != NULL) {
+    munmap(p->native_mem, p->native_size);
+    p->native_mem = NULL;
+    p->native = NULL;
+  }
+}
+
+/* Returns -1 if executable memory can't be allocated, the program remains
+ * interpreted then */
+static int expr_jit(struct expr_prog *p) {
+  struct expr_jit_buf b;
+  int *offsets = (int *)calloc(p->len, sizeof(int));
+  int *fixups = (int *)calloc(p->len, sizeof(int));
+  int nfixups = 0;
+  if (offsets == NULL || fixups == NULL) {
+    free(offsets);
+    free(fixups);
+    return -1;
+  }
+  /* No instruction takes more than 128 bytes */
+  size_t size = (p->len * 128 + 64 + 4095) & ~(size_t)4095;
+#ifdef MAP_ANONYMOUS
+  void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#else
+  /* Strict ISO C modes hide MAP_ANONYMOUS, a private mapping of /dev/zero is
+   * the portable equivalent */
+  void *mem = MAP_FAILED;
+  int fd = open("/dev/zero", O_RDWR);
+  if (fd >= 0) {
+    mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+  }
+#endif
+  if (mem == MAP_FAILED) {
+    free(offsets);
+    free(fixups);
+    return -1;
+  }
+  b.code = (unsigned char *)mem;
+  b.len = 0;
+
+  /* Callee-saved rbx points to registers, r12 holds integer operands, r13 is
+   * only pushed to keep the stack aligned for calls */
+  EXPR_JIT_EMIT(&b, "\x53\x41\x54\x41\x55"); /* push rbx; push r12; push r13 */
+  EXPR_JIT_EMIT(&b, "\x48\xbb");             /* mov rbx, regs */
+  expr_jit_u64(&b, p->regs);
+
+  for (int i = 0; i < p->len; i++) {
+    struct expr_insn *insn = &p->code[i];
+    offsets[i] = (int)b.len;
+    switch (insn->op) {
+    case EXPR_OP_NEG:
+      EXPR_JIT_MOV_LOAD(&b, insn->a);
+      EXPR_JIT_EMIT(&b, "\x35\x00\x00\x00\x80"); /* xor eax, sign bit */
+      EXPR_JIT_MOV_STORE(&b, insn->dst);
+      break;
+    case EXPR_OP_NOT:
+      EXPR_JIT_MOVSS_LOAD(&b, 0, insn->a);
+      EXPR_JIT_EMIT(&b, "\x0f\x57\xc9");         /* xorps xmm1, xmm1 */
+      EXPR_JIT_EMIT(&b, "\xf3\x0f\xc2\xc1\x00"); /* cmpeqss xmm0, xmm1 */
+      expr_jit_mask(&b, insn->dst);
+      break;
+    case EXPR_OP_BITNOT:
+      expr_jit_to_int(&b, insn->a);
+      EXPR_JIT_EMIT(&b, "\xf7\xd0"); /* not eax */
+      expr_jit_from_int(&b, insn->dst);
+      break;
+    case EXPR_OP_POW:
+    case EXPR_OP_MOD: {
+      float (*fn)(float, float) = (insn->op == EXPR_OP_POW ? powf : fmodf);
+      EXPR_JIT_MOVSS_LOAD(&b, 0, insn->a);
+      EXPR_JIT_MOVSS_LOAD(&b, 1, insn->b);
+      expr_jit_call(&b, &fn);
+      EXPR_JIT_MOVSS_STORE(&b, 0, insn->dst);
+      break;
+    }
+    case EXPR_OP_ADD:
+    case EXPR_OP_SUB:
+    case EXPR_OP_MUL:
+    case EXPR_OP_DIV:
+      EXPR_JIT_MOVSS_LOAD(&b, 0, insn->a);
+      expr_jit_reg(&b,
+                   insn->op == EXPR_OP_ADD   ? "\xf3\x0f\x58"
+                   : insn->op == EXPR_OP_SUB ? "\xf3\x0f\x5c"
+                   : insn->op == EXPR_OP_MUL ? "\xf3\x0f\x59"
+                                             : "\xf3\x0f\x5e",
+                   3, 0, insn->b);
+      EXPR_JIT_MOVSS_STORE(&b, 0, insn->dst);
+      break;
+    case EXPR_OP_SHL:
+    case EXPR_OP_SHR:
+    case EXPR_OP_AND:
+    case EXPR_OP_OR:
+    case EXPR_OP_XOR:
+      expr_jit_to_int(&b, insn->a);
+      EXPR_JIT_EMIT(&b, "\x41\x89\xc4"); /* mov r12d, eax */
+      expr_jit_to_int(&b, insn->b);
+      if (insn->op == EXPR_OP_SHL || insn->op == EXPR_OP_SHR) {
+        EXPR_JIT_EMIT(&b, "\x89\xc1");     /* mov ecx, eax */
+        EXPR_JIT_EMIT(&b, "\x44\x89\xe0"); /* mov eax, r12d */
+        if (insn->op == EXPR_OP_SHL) {
+          EXPR_JIT_EMIT(&b, "\xd3\xe0"); /* shl eax, cl */
+        } else {
+          EXPR_JIT_EMIT(&b, "\xd3\xf8"); /* sar eax, cl */
+        }
+      } else if (insn->op == EXPR_OP_AND) {
+        EXPR_JIT_EMIT(&b, "\x44\x21\xe0"); /* and eax, r12d */
+      } else if (insn->op == EXPR_OP_OR) {
+        EXPR_JIT_EMIT(&b, "\x44\x09\xe0"); /* or eax, r12d */
+      } else {
+        EXPR_JIT_EMIT(&b, "\x44\x31\xe0"); /* xor eax, r12d */
+      }
+      expr_jit_from_int(&b, insn->dst);
+      break;
+    case EXPR_OP_LT:
+      expr_jit_cmp(&b, insn, 0, 1);
+      break;
+    case EXPR_OP_LE:
+      expr_jit_cmp(&b, insn, 0, 2);
+      break;
+    case EXPR_OP_GT:
+      expr_jit_cmp(&b, insn, 1, 1);
+      break;
+    case EXPR_OP_GE:
+      expr_jit_cmp(&b, insn, 1, 2);
+      break;
+    case EXPR_OP_EQ:
+      expr_jit_cmp(&b, insn, 0, 0);
+      break;
+    case EXPR_OP_NE:
+      expr_jit_cmp(&b, insn, 0, 4);
+      break;
+    case EXPR_OP_MOVE:
+      EXPR_JIT_MOV_LOAD(&b, insn->a);
+      EXPR_JIT_MOV_STORE(&b, insn->dst);
+      break;
+    case EXPR_OP_TRUTH:
+      EXPR_JIT_MOVSS_LOAD(&b, 0, insn->a);
+      EXPR_JIT_EMIT(&b, "\x0f\x57\xc9");         /* xorps xmm1, xmm1 */
+      EXPR_JIT_EMIT(&b, "\xf3\x0f\xc2\xc8\x04"); /* cmpneqss xmm1, xmm0 */
+      EXPR_JIT_EMIT(&b, "\x0f\x54\xc8");         /* andps xmm1, xmm0 */
+      EXPR_JIT_MOVSS_STORE(&b, 1, insn->dst);
+      break;
+    case EXPR_OP_LOAD:
+      EXPR_JIT_EMIT(&b, "\x48\xb8"); /* mov rax, var */
+      expr_jit_u64(&b, insn->p.var);
+      EXPR_JIT_EMIT(&b, "\x8b\x00"); /* mov eax, [rax] */
+      EXPR_JIT_MOV_STORE(&b, insn->dst);
+      break;
+    case EXPR_OP_STORE:
+      EXPR_JIT_MOV_LOAD(&b, insn->a);
+      EXPR_JIT_EMIT(&b, "\x48\xb9"); /* mov rcx, var */
+      expr_jit_u64(&b, insn->p.var);
+      EXPR_JIT_EMIT(&b, "\x89\x01"); /* mov [rcx], eax */
+      break;
+    case EXPR_OP_JZ:
+    case EXPR_OP_JNZ:
+      EXPR_JIT_MOVSS_LOAD(&b, 0, insn->dst);
+      EXPR_JIT_EMIT(&b, "\x0f\x57\xc9"); /* xorps xmm1, xmm1 */
+      EXPR_JIT_EMIT(&b, "\x0f\x2e\xc1"); /* ucomiss xmm0, xmm1 */
+      if (insn->op == EXPR_OP_JZ) {
+        EXPR_JIT_EMIT(&b, "\x7a\x11\x75\x0f"); /* jp +17; jne +15 */
+        expr_jit_reg(&b, "\xc7", 1, 0, insn->dst);
+        expr_jit_u32(&b, 0); /* mov r[dst], 0 */
+      } else {
+        EXPR_JIT_EMIT(&b, "\x7a\x07\x74\x05"); /* jp +7; je +5 */
+      }
+      EXPR_JIT_EMIT(&b, "\xe9"); /* jmp target */
+      fixups[nfixups++] = (int)b.len;
+      expr_jit_u32(&b, insn->b);
+      break;
+    case EXPR_OP_CALL: {
+      struct expr *e = insn->p.e;
+      /* The argument vector is a 16-byte struct passed in rsi:rdx */
+      unsigned long long packed[2];
+      memcpy(packed, &e->param.func.args, sizeof(packed));
+      EXPR_JIT_EMIT(&b, "\x48\xbf"); /* mov rdi, f */
+      expr_jit_u64(&b, e->param.func.f);
+      EXPR_JIT_EMIT(&b, "\x48\xbe"); /* mov rsi, args */
+      expr_jit_u64(&b, (void *)(size_t)packed[0]);
+      EXPR_JIT_EMIT(&b, "\x48\xba");
+      expr_jit_u64(&b, (void *)(size_t)packed[1]);
+      EXPR_JIT_EMIT(&b, "\x48\xb9"); /* mov rcx, context */
+      expr_jit_u64(&b, e->param.func.context);
+      expr_jit_call(&b, &e->param.func.f->f);
+      EXPR_JIT_MOVSS_STORE(&b, 0, insn->dst);
+      break;
+    }
+    case EXPR_OP_CALLB: {
+      struct expr *e = insn->p.e;
+      EXPR_JIT_EMIT(&b, "\x48\xbf"); /* mov rdi, f */
+      expr_jit_u64(&b, e->param.func.f);
+      EXPR_JIT_EMIT(&b, "\x48\xbe"); /* mov rsi, argv */
+      expr_jit_u64(&b, insn->argv);
+      EXPR_JIT_EMIT(&b, "\xba"); /* mov edx, argc */
+      expr_jit_u32(&b, insn->a);
+      EXPR_JIT_EMIT(&b, "\x48\xb9"); /* mov rcx, context */
+      expr_jit_u64(&b, e->param.func.context);
+      EXPR_JIT_EMIT(&b, "\x49\xb8"); /* mov r8, &r[dst] */
+      expr_jit_u64(&b, p->regs + insn->dst);
+      EXPR_JIT_EMIT(&b, "\x41\xb9\x01\x00\x00\x00"); /* mov r9d, 1 */
+      expr_jit_call(&b, &e->param.func.f->block);
+      break;
+    }
+    case EXPR_OP_RET:
+      EXPR_JIT_MOVSS_LOAD(&b, 0, insn->a);
+      EXPR_JIT_EMIT(&b, "\x41\x5d\x41\x5c\x5b\xc3"); /* pop r13; pop r12; pop rbx */
+      break;
     }
   }
-  v = (struct expr_var *)calloc(1, sizeof(struct expr_var) + len + 1);
-  if (v == NULL) {
-    return NULL; /* allocation failed */
+
+  /* Jump targets are instruction indices until all offsets are known */
+  for (int i = 0; i < nfixups; i++) {
+    unsigned int target;
+    memcpy(&target, b.code + fixups[i], 4);
+    target = offsets[target] - (fixups[i] + 4);
+    memcpy(b.code + fixups[i], &target, 4);
   }
-  v->next = vars->head;
-  v->value = 0;
-  strncpy(v->name, s, len);
-  v->name[len] = '\0';
-  vars->head = v;
-  return v;
+  free(offsets);
+  free(fixups);
+
+  if (mprotect(mem, size, PROT_READ | PROT_EXEC) != 0) {
+    munmap(mem, size);
+    return -1;
+  }
+  memcpy(&p->native, &mem, sizeof(mem));
+  p->native_mem = mem;
+  p->native_size = size;
+  return 0;
 }
 
-static int to_int(float x) {
-  if (isnan(x)) {
-    return 0;
-  } else if (isinf(x) != 0) {
-    return INT_MAX * isinf(x);
-  } else {
-    return (int)x;
+#undef EXPR_JIT_EMIT
+#undef EXPR_JIT_MOVSS_LOAD
+#undef EXPR_JIT_MOVSS_STORE
+#undef EXPR_JIT_MOV_LOAD
+#undef EXPR_JIT_MOV_STORE
+#else
+static void expr_jit_release(struct expr_prog *p) { (void)p; }
+static int expr_jit(struct expr_prog *p) {
+  (void)p;
+  return -1;
+}
+#endif
+
+static void expr_prog_destroy(struct expr_prog *p) {
+  if (p != NULL) {
+    expr_jit_release(p);
   }
+  free(p);
 }
 
-static float expr_eval(struct expr *e) {
-  float n;
-  switch (e->type) {
-  case OP_UNARY_MINUS:
-    return -(expr_eval(&e->param.op.args.buf[0]));
-  case OP_UNARY_LOGICAL_NOT:
-    return !(expr_eval(&e->param.op.args.buf[0]));
-  case OP_UNARY_BITWISE_NOT:
-    return ~(to_int(expr_eval(&e->param.op.args.buf[0])));
-  case OP_POWER:
-    return powf(expr_eval(&e->param.op.args.buf[0]),
-                expr_eval(&e->param.op.args.buf[1]));
-  case OP_MULTIPLY:
-    return expr_eval(&e->param.op.args.buf[0]) *
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_DIVIDE:
-    return expr_eval(&e->param.op.args.buf[0]) /
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_REMAINDER:
-    return fmodf(expr_eval(&e->param.op.args.buf[0]),
-                 expr_eval(&e->param.op.args.buf[1]));
-  case OP_PLUS:
-    return expr_eval(&e->param.op.args.buf[0]) +
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_MINUS:
-    return expr_eval(&e->param.op.args.buf[0]) -
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_SHL:
-    return to_int(expr_eval(&e->param.op.args.buf[0]))
-           << to_int(expr_eval(&e->param.op.args.buf[1]));
-  case OP_SHR:
-    return to_int(expr_eval(&e->param.op.args.buf[0])) >>
-           to_int(expr_eval(&e->param.op.args.buf[1]));
-  case OP_LT:
-    return expr_eval(&e->param.op.args.buf[0]) <
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_LE:
-    return expr_eval(&e->param.op.args.buf[0]) <=
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_GT:
-    return expr_eval(&e->param.op.args.buf[0]) >
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_GE:
-    return expr_eval(&e->param.op.args.buf[0]) >=
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_EQ:
-    return expr_eval(&e->param.op.args.buf[0]) ==
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_NE:
-    return expr_eval(&e->param.op.args.buf[0]) !=
-           expr_eval(&e->param.op.args.buf[1]);
-  case OP_BITWISE_AND:
-    return to_int(expr_eval(&e->param.op.args.buf[0])) &
-           to_int(expr_eval(&e->param.op.args.buf[1]));
-  case OP_BITWISE_OR:
-    return to_int(expr_eval(&e->param.op.args.buf[0])) |
-           to_int(expr_eval(&e->param.op.args.buf[1]));
-  case OP_BITWISE_XOR:
-    return to_int(expr_eval(&e->param.op.args.buf[0])) ^
-           to_int(expr_eval(&e->param.op.args.buf[1]));
-  case OP_LOGICAL_AND:
-    n = expr_eval(&e->param.op.args.buf[0]);
-    if (n != 0) {
-      n = expr_eval(&e->param.op.args.buf[1]);
-      if (n != 0) {
-        return n;
+/* Threaded dispatch jumps straight to the next handler where the compiler
+ * supports label addresses, otherwise it's a switch in a loop */
+#if defined(__GNUC__) && !defined(EXPR_NO_COMPUTED_GOTO)
+#define EXPR_DISPATCH() __extension__({ goto *labels[pc->op]; })
+#define EXPR_SWITCH() EXPR_DISPATCH();
+#define EXPR_CASE(op) L_##op
+#else
+#define EXPR_DISPATCH() continue
+#define EXPR_SWITCH() switch (pc->op)
+#define EXPR_CASE(op) case op
+#endif
+/* Not a do-while block, continue must reach the interpreter loop */
+#define EXPR_NEXT()                                                            \
+  {                                                                            \
+    pc++;                                                                      \
+    EXPR_DISPATCH();                                                           \
+  }
+
+static float expr_run(struct expr_prog *p) {
+  if (p->native != NULL) {
+    return p->native();
+  }
+  float *r = p->regs;
+  struct expr_insn *pc = p->code;
+#if defined(__GNUC__) && !defined(EXPR_NO_COMPUTED_GOTO)
+  static const void *labels[] = {
+      __extension__ &&L_EXPR_OP_NEG,   __extension__ &&L_EXPR_OP_NOT,
+      __extension__ &&L_EXPR_OP_BITNOT, __extension__ &&L_EXPR_OP_POW,
+      __extension__ &&L_EXPR_OP_DIV,   __extension__ &&L_EXPR_OP_MUL,
+      __extension__ &&L_EXPR_OP_MOD,   __extension__ &&L_EXPR_OP_ADD,
+      __extension__ &&L_EXPR_OP_SUB,   __extension__ &&L_EXPR_OP_SHL,
+      __extension__ &&L_EXPR_OP_SHR,   __extension__ &&L_EXPR_OP_LT,
+      __extension__ &&L_EXPR_OP_LE,    __extension__ &&L_EXPR_OP_GT,
+      __extension__ &&L_EXPR_OP_GE,    __extension__ &&L_EXPR_OP_EQ,
+      __extension__ &&L_EXPR_OP_NE,    __extension__ &&L_EXPR_OP_AND,
+      __extension__ &&L_EXPR_OP_OR,    __extension__ &&L_EXPR_OP_XOR,
+      __extension__ &&L_EXPR_OP_MOVE,  __extension__ &&L_EXPR_OP_TRUTH,
+      __extension__ &&L_EXPR_OP_LOAD,  __extension__ &&L_EXPR_OP_STORE,
+      __extension__ &&L_EXPR_OP_JZ,    __extension__ &&L_EXPR_OP_JNZ,
+      __extension__ &&L_EXPR_OP_CALL,  __extension__ &&L_EXPR_OP_CALLB,
+      __extension__ &&L_EXPR_OP_RET,
+  };
+#endif
+  for (;;) {
+    EXPR_SWITCH() {
+    EXPR_CASE(EXPR_OP_NEG):
+      r[pc->dst] = -r[pc->a];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_NOT):
+      r[pc->dst] = !r[pc->a];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_BITNOT):
+      r[pc->dst] = ~to_int(r[pc->a]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_POW):
+      r[pc->dst] = powf(r[pc->a], r[pc->b]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_DIV):
+      r[pc->dst] = r[pc->a] / r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_MUL):
+      r[pc->dst] = r[pc->a] * r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_MOD):
+      r[pc->dst] = fmodf(r[pc->a], r[pc->b]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_ADD):
+      r[pc->dst] = r[pc->a] + r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_SUB):
+      r[pc->dst] = r[pc->a] - r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_SHL):
+      r[pc->dst] = to_int(r[pc->a]) << to_int(r[pc->b]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_SHR):
+      r[pc->dst] = to_int(r[pc->a]) >> to_int(r[pc->b]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_LT):
+      r[pc->dst] = r[pc->a] < r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_LE):
+      r[pc->dst] = r[pc->a] <= r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_GT):
+      r[pc->dst] = r[pc->a] > r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_GE):
+      r[pc->dst] = r[pc->a] >= r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_EQ):
+      r[pc->dst] = r[pc->a] == r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_NE):
+      r[pc->dst] = r[pc->a] != r[pc->b];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_AND):
+      r[pc->dst] = to_int(r[pc->a]) & to_int(r[pc->b]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_OR):
+      r[pc->dst] = to_int(r[pc->a]) | to_int(r[pc->b]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_XOR):
+      r[pc->dst] = to_int(r[pc->a]) ^ to_int(r[pc->b]);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_MOVE):
+      r[pc->dst] = r[pc->a];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_TRUTH):
+      r[pc->dst] = (r[pc->a] != 0 ? r[pc->a] : 0);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_LOAD):
+      r[pc->dst] = *pc->p.var;
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_STORE):
+      *pc->p.var = r[pc->a];
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_JZ):
+      if (r[pc->dst] == 0) {
+        r[pc->dst] = 0;
+        pc = p->code + pc->b;
+        EXPR_DISPATCH();
       }
-    }
-    return 0;
-  case OP_LOGICAL_OR:
-    n = expr_eval(&e->param.op.args.buf[0]);
-    if (n != 0 && !isnan(n)) {
-      return n;
-    } else {
-      n = expr_eval(&e->param.op.args.buf[1]);
-      if (n != 0) {
-        return n;
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_JNZ):
+      if (r[pc->dst] != 0 && !isnan(r[pc->dst])) {
+        pc = p->code + pc->b;
+        EXPR_DISPATCH();
       }
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_CALL):
+      r[pc->dst] = pc->p.e->param.func.f->f(
+          pc->p.e->param.func.f, pc->p.e->param.func.args,
+          pc->p.e->param.func.context);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_CALLB):
+      pc->p.e->param.func.f->block(pc->p.e->param.func.f, pc->argv, pc->a,
+                                   pc->p.e->param.func.context, &r[pc->dst], 1);
+      EXPR_NEXT();
+    EXPR_CASE(EXPR_OP_RET):
+      return r[pc->a];
     }
-    return 0;
-  case OP_ASSIGN:
-    n = expr_eval(&e->param.op.args.buf[1]);
-    if (vec_nth(&e->param.op.args, 0).type == OP_VAR) {
-      *e->param.op.args.buf[0].param.var.value = n;
-    }
-    return n;
-  case OP_COMMA:
-    expr_eval(&e->param.op.args.buf[0]);
-    return expr_eval(&e->param.op.args.buf[1]);
-  case OP_CONST:
-    return e->param.num.value;
-  case OP_VAR:
-    return *e->param.var.value;
-  case OP_FUNC:
-    return e->param.func.f->f(e->param.func.f, e->param.func.args,
-                              e->param.func.context);
-  default:
-    return NAN;
   }
 }
 
+#undef EXPR_DISPATCH
+#undef EXPR_SWITCH
+#undef EXPR_CASE
+#undef EXPR_NEXT
+
 #define EXPR_TOP (1 << 0)
 #define EXPR_TOPEN (1 << 1)
 #define EXPR_TCLOSE (1 << 2)
@@ -413,18 +2645,22 @@ static float expr_eval(struct expr *e) {
 #define EXPR_UNARY (1 << 5)
 #define EXPR_COMMA (1 << 6)
 
+/*
+ * Single pass lexer, each character is looked at once and classified with the
+ * expr_chr table. Returns the length of the next token, 0 at the end of input
+ * or a negative number on syntax errors.
+ */
 static int expr_next_token(const char *s, size_t len, int *flags) {
-  unsigned int i = 0;
+  size_t i = 0;
   if (len == 0) {
     return 0;
   }
   char c = s[0];
   if (c == '#') {
-    for (; i < len && s[i] != '\n'; i++)
-      ;
-    return i;
+    const char *nl = (const char *)memchr(s, '\n', len);
+    return (int)(nl != NULL ? (size_t)(nl - s) : len);
   } else if (c == '\n') {
-    for (; i < len && isspace(s[i]); i++)
+    for (; i < len && expr_chrclass(s[i], EXPR_CSPACE); i++)
       ;
     if (*flags & EXPR_TOP) {
       if (i == len || s[i] == ')') {
@@ -433,32 +2669,30 @@ static int expr_next_token(const char *s, size_t len, int *flags) {
         *flags = EXPR_TNUMBER | EXPR_TWORD | EXPR_TOPEN | EXPR_COMMA;
       }
     }
-    return i;
-  } else if (isspace(c)) {
-    while (i < len && isspace(s[i]) && s[i] != '\n') {
+    return (int)i;
+  } else if (expr_chrclass(c, EXPR_CSPACE)) {
+    while (i < len && expr_chrclass(s[i], EXPR_CSPACE) && s[i] != '\n') {
       i++;
     }
-    return i;
-  } else if (isdigit(c)) {
+    return (int)i;
+  } else if (expr_chrclass(c, EXPR_CDIGIT)) {
     if ((*flags & EXPR_TNUMBER) == 0) {
       return -1; // unexpected number
     }
     *flags = EXPR_TOP | EXPR_TCLOSE;
-    while ((c == '.' || isdigit(c)) && i < len) {
+    while (i < len && (s[i] == '.' || expr_chrclass(s[i], EXPR_CDIGIT))) {
       i++;
-      c = s[i];
     }
-    return i;
-  } else if (isfirstvarchr(c)) {
+    return (int)i;
+  } else if (expr_chrclass(c, EXPR_CWORD)) {
     if ((*flags & EXPR_TWORD) == 0) {
       return -2; // unexpected word
     }
     *flags = EXPR_TOP | EXPR_TOPEN | EXPR_TCLOSE;
-    while ((isvarchr(c)) && i < len) {
+    while (i < len && expr_chrclass(s[i], EXPR_CVAR)) {
       i++;
-      c = s[i];
     }
-    return i;
+    return (int)i;
   } else if (c == '(' || c == ')') {
     if (c == '(' && (*flags & EXPR_TOPEN) != 0) {
       *flags = EXPR_TNUMBER | EXPR_TWORD | EXPR_TOPEN | EXPR_TCLOSE;
@@ -468,33 +2702,29 @@ static int expr_next_token(const char *s, size_t len, int *flags) {
       return -3; // unexpected parenthesis
     }
     return 1;
+  } else if ((*flags & EXPR_TOP) == 0) {
+    if (expr_op(&c, 1, 1) == OP_UNKNOWN) {
+      return -4; // missing expected operand
+    }
+    *flags = EXPR_TNUMBER | EXPR_TWORD | EXPR_TOPEN | EXPR_UNARY;
+    return 1;
   } else {
-    if ((*flags & EXPR_TOP) == 0) {
-      if (expr_op(&c, 1, 1) == OP_UNKNOWN) {
-        return -4; // missing expected operand
-      }
-      *flags = EXPR_TNUMBER | EXPR_TWORD | EXPR_TOPEN | EXPR_UNARY;
-      return 1;
+    /* Longest match, binary operators are at most two characters long */
+    if (len > 1 && expr_op(s, 2, 0) != OP_UNKNOWN) {
+      i = 2;
+    } else if (expr_op(s, 1, 0) != OP_UNKNOWN) {
+      i = 1;
     } else {
-      int found = 0;
-      while (!isvarchr(c) && !isspace(c) && c != '(' && c != ')' && i < len) {
-        if (expr_op(s, i + 1, 0) != OP_UNKNOWN) {
-          found = 1;
-        } else if (found) {
-          break;
-        }
-        i++;
-        c = s[i];
-      }
-      if (!found) {
-        return -5; // unknown operator
-      }
-      *flags = EXPR_TNUMBER | EXPR_TWORD | EXPR_TOPEN;
-      return i;
+      return -5; // unknown operator
     }
+    *flags = EXPR_TNUMBER | EXPR_TWORD | EXPR_TOPEN;
+    return (int)i;
   }
 }
 
+/* Upper bound for the parser stacks preallocated from the input size */
+#define EXPR_PARSE_STACK 256
+
 #define EXPR_PAREN_ALLOWED 0
 #define EXPR_PAREN_EXPECTED 1
 #define EXPR_PAREN_FORBIDDEN 2
@@ -512,6 +2742,7 @@ static int expr_bind(const char *s, size_t len, vec_expr_t *es) {
     struct expr arg = vec_pop(es);
     struct expr unary = expr_init();
     unary.type = op;
+    vec_reserve(&unary.param.op.args, 1);
     vec_push(&unary.param.op.args, arg);
     vec_push(es, unary);
   } else {
@@ -525,6 +2756,7 @@ static int expr_bind(const char *s, size_t len, vec_expr_t *es) {
     if (op == OP_ASSIGN && a.type != OP_VAR) {
       return -1; /* Bad assignment */
     }
+    vec_reserve(&binary.param.op.args, 2);
     vec_push(&binary.param.op.args, a);
     vec_push(&binary.param.op.args, b);
     vec_push(es, binary);
@@ -542,7 +2774,7 @@ static struct expr expr_const(float value) {
 static struct expr expr_varref(struct expr_var *v) {
   struct expr e = expr_init();
   e.type = OP_VAR;
-  e.param.var.value = &v->value;
+  e.param.var.value = v->value;
   return e;
 }
 
@@ -550,6 +2782,7 @@ static struct expr expr_binary(enum expr_type type, struct expr a,
                                struct expr b) {
   struct expr e = expr_init();
   e.type = type;
+  vec_reserve(&e.param.op.args, 2);
   vec_push(&e.param.op.args, a);
   vec_push(&e.param.op.args, b);
   return e;
@@ -584,10 +2817,73 @@ static inline void expr_copy(struct expr *dst, struct expr *src) {
 
 static void expr_destroy_args(struct expr *e);
 
+/*
+ * Macros defined with $() while parsing, hashed by name like functions
+ */
+struct expr_macro {
+  const char *name;
+  size_t len;
+  vec_expr_t body;
+};
+
+struct expr_macro_list {
+  vec(struct expr_macro) items;
+  int *table; /* index into items plus one, zero if empty */
+  int cap;
+};
+
+static int *expr_macro_probe(struct expr_macro_list *macros, const char *s,
+                             size_t len) {
+  unsigned int i = expr_hash(s, len) & (macros->cap - 1);
+  for (;; i = (i + 1) & (macros->cap - 1)) {
+    int k = macros->table[i];
+    if (k == 0 || (vec_nth(&macros->items, k - 1).len == len &&
+                   memcmp(vec_nth(&macros->items, k - 1).name, s, len) == 0)) {
+      return &macros->table[i];
+    }
+  }
+}
+
+static struct expr_macro *expr_macro_find(struct expr_macro_list *macros,
+                                          const char *s, size_t len) {
+  if (macros->cap == 0) {
+    return NULL;
+  }
+  int k = *expr_macro_probe(macros, s, len);
+  return k == 0 ? NULL : &vec_nth(&macros->items, k - 1);
+}
+
+/* Adds a macro, redefining a name hides the previous body */
+static int expr_macro_add(struct expr_macro_list *macros,
+                          struct expr_macro m) {
+  if (vec_push(&macros->items, m) == -1) {
+    return -1;
+  }
+  int n = vec_len(&macros->items);
+  if (n * 2 > macros->cap) {
+    int cap = macros->cap ? macros->cap * 2 : 16;
+    int *table = (int *)calloc(cap, sizeof(int));
+    if (table == NULL) {
+      (void)vec_pop(&macros->items);
+      return -1;
+    }
+    free(macros->table);
+    macros->table = table;
+    macros->cap = cap;
+    for (int k = 1; k < n; k++) {
+      struct expr_macro *prev = &vec_nth(&macros->items, k - 1);
+      *expr_macro_probe(macros, prev->name, prev->len) = k;
+    }
+  }
+  *expr_macro_probe(macros, m.name, m.len) = n;
+  return 0;
+}
+
 static struct expr *expr_create(const char *s, size_t len,
                                 struct expr_var_list *vars,
-                                struct expr_func *funcs) {
+                                struct expr_func_list *funcs) {
   float num;
+  enum expr_type op;
   struct expr_var *v;
   const char *id = NULL;
   size_t idn = 0;
@@ -598,11 +2894,15 @@ static struct expr *expr_create(const char *s, size_t len,
   vec_str_t os = vec_init();
   vec_arg_t as = vec_init();
 
-  struct macro {
-    char *name;
-    vec_expr_t body;
-  };
-  vec(struct macro) macros = vec_init();
+  struct expr_macro_list macros = {vec_init(), NULL, 0};
+
+  /* Stacks only grow past this for deeply nested or very long scripts, if
+     the reservation fails they grow on demand as usual */
+  int depth =
+      (int)(len < 4 * EXPR_PARSE_STACK ? len / 4 + 4 : EXPR_PARSE_STACK);
+  vec_reserve(&es, depth);
+  vec_reserve(&os, depth);
+  vec_reserve(&as, depth);
 
   int flags = EXPR_TDEFAULT;
   int paren = EXPR_PAREN_ALLOWED;
@@ -649,16 +2949,8 @@ static struct expr *expr_create(const char *s, size_t len,
 
     if (idn > 0) {
       if (n == 1 && *tok == '(') {
-        int i;
-        int has_macro = 0;
-        struct macro m;
-        vec_foreach(&macros, m, i) {
-          if (strlen(m.name) == idn && strncmp(m.name, id, idn) == 0) {
-            has_macro = 1;
-            break;
-          }
-        }
-        if ((idn == 1 && id[0] == '$') || has_macro ||
+        if ((idn == 1 && id[0] == '$') ||
+            expr_macro_find(&macros, id, idn) != NULL ||
             expr_func(funcs, id, idn) != NULL) {
           struct expr_string str = {id, (int)idn};
           vec_push(&os, str);
@@ -679,6 +2971,9 @@ static struct expr *expr_create(const char *s, size_t len,
         struct expr_string str = {"{", 1};
         vec_push(&os, str);
         struct expr_arg arg = {vec_len(&os), vec_len(&es), vec_init()};
+        if (vec_reserve(&arg.args, 4) == -1) {
+          goto cleanup;
+        }
         vec_push(&as, arg);
       } else if (paren == EXPR_PAREN_ALLOWED) {
         struct expr_string str = {"(", 1};
@@ -717,26 +3012,27 @@ static struct expr *expr_create(const char *s, size_t len,
             vec_free(&arg.args);
             goto cleanup; /* first argument is not a variable */
           }
-          for (struct expr_var *v = vars->head; v; v = v->next) {
-            if (&v->value == u->param.var.value) {
-              struct macro m = {v->name, arg.args};
-              vec_push(&macros, m);
-              break;
+          struct expr_var *v = expr_var_find(vars, u->param.var.value);
+          if (v != NULL) {
+            struct expr_macro m = {v->name, v->len, arg.args};
+            if (expr_macro_add(&macros, m) == -1) {
+              struct expr e;
+              int i;
+              vec_foreach(&arg.args, e, i) { expr_destroy_args(&e); }
+              vec_free(&arg.args);
+              goto cleanup;
             }
+          } else {
+            struct expr e;
+            int i;
+            vec_foreach(&arg.args, e, i) { expr_destroy_args(&e); }
+            vec_free(&arg.args);
           }
           vec_push(&es, expr_const(0));
         } else {
-          int i = 0;
-          int found = -1;
-          struct macro m;
-          vec_foreach(&macros, m, i) {
-            if (strlen(m.name) == (size_t)str.n &&
-                strncmp(m.name, str.s, str.n) == 0) {
-              found = i;
-            }
-          }
-          if (found != -1) {
-            m = vec_nth(&macros, found);
+          struct expr_macro *mp = expr_macro_find(&macros, str.s, str.n);
+          if (mp != NULL) {
+            struct expr_macro m = *mp;
             struct expr root = expr_const(0);
             struct expr *p = &root;
             /* Assign macro parameters */
@@ -783,8 +3079,7 @@ static struct expr *expr_create(const char *s, size_t len,
     } else if (!isnan(num = expr_parse_number(tok, n))) {
       vec_push(&es, expr_const(num));
       paren_next = EXPR_PAREN_FORBIDDEN;
-    } else if (expr_op(tok, n, -1) != OP_UNKNOWN) {
-      enum expr_type op = expr_op(tok, n, -1);
+    } else if ((op = expr_op(tok, n, -1)) != OP_UNKNOWN) {
       struct expr_string o2 = {NULL, 0};
       if (vec_len(&os) > 0) {
         o2 = vec_peek(&os);
@@ -851,16 +3146,17 @@ static struct expr *expr_create(const char *s, size_t len,
   }
 
   int i, j;
-  struct macro m;
+  struct expr_macro m;
   struct expr e;
   struct expr_arg a;
 cleanup:
-  vec_foreach(&macros, m, i) {
+  vec_foreach(&macros.items, m, i) {
     struct expr e;
     vec_foreach(&m.body, e, j) { expr_destroy_args(&e); }
     vec_free(&m.body);
   }
-  vec_free(&macros);
+  vec_free(&macros.items);
+  free(macros.table);
 
   vec_foreach(&es, e, i) { expr_destroy_args(&e); }
   vec_free(&es);
@@ -900,12 +3196,256 @@ static void expr_destroy(struct expr *e, struct expr_var_list *vars) {
     free(e);
   }
   if (vars != NULL) {
-    for (struct expr_var *v = vars->head; v;) {
-      struct expr_var *next = v->next;
-      free(v);
-      v = next;
+    expr_var_free(vars);
+  }
+}
+
+/*
+ * Arenas
+ *
+ * Once an expression is parsed and optimized, expr_arena_create() moves its
+ * nodes, argument vectors and function contexts into one allocation of the
+ * exact size. Such expression is released with expr_arena_destroy(), which
+ * only runs the function cleanups and frees the arena as a whole.
+ */
+#define EXPR_ARENA_ALIGN 16
+
+struct expr_arena {
+  char *mem;
+  size_t size;
+  size_t used;
+};
+
+static size_t expr_arena_round(size_t n) {
+  return (n + EXPR_ARENA_ALIGN - 1) & ~(size_t)(EXPR_ARENA_ALIGN - 1);
+}
+
+static void *expr_arena_alloc(struct expr_arena *a, size_t n) {
+  n = expr_arena_round(n);
+  if (a->used + n > a->size) {
+    return NULL;
+  }
+  void *p = a->mem + a->used;
+  a->used = a->used + n;
+  return p;
+}
+
+static vec_expr_t *expr_arena_args(struct expr *e) {
+  if (e->type == OP_FUNC) {
+    return &e->param.func.args;
+  } else if (e->type != OP_CONST && e->type != OP_VAR) {
+    return &e->param.op.args;
+  }
+  return NULL;
+}
+
+/* Size of everything below the node that has to be moved into an arena */
+static size_t expr_arena_size(struct expr *e) {
+  size_t n = 0;
+  vec_expr_t *args = expr_arena_args(e);
+  if (args != NULL) {
+    n = expr_arena_round(vec_len(args) * sizeof(struct expr));
+    for (int i = 0; i < vec_len(args); i++) {
+      n = n + expr_arena_size(&vec_nth(args, i));
+    }
+  }
+  if (e->type == OP_FUNC && e->param.func.context != NULL) {
+    n = n + expr_arena_round(e->param.func.f->ctxsz);
+  }
+  return n;
+}
+
+static void expr_arena_move(struct expr_arena *a, struct expr *e) {
+  vec_expr_t *args = expr_arena_args(e);
+  if (args != NULL) {
+    struct expr *buf = NULL;
+    if (vec_len(args) > 0) {
+      buf = (struct expr *)expr_arena_alloc(
+          a, vec_len(args) * sizeof(struct expr));
+      memcpy(buf, args->buf, vec_len(args) * sizeof(struct expr));
+    }
+    free(args->buf);
+    args->buf = buf;
+    args->cap = args->len;
+    for (int i = 0; i < vec_len(args); i++) {
+      expr_arena_move(a, &vec_nth(args, i));
+    }
+  }
+  if (e->type == OP_FUNC && e->param.func.context != NULL) {
+    void *context = expr_arena_alloc(a, e->param.func.f->ctxsz);
+    memcpy(context, e->param.func.context, e->param.func.f->ctxsz);
+    free(e->param.func.context);
+    e->param.func.context = context;
+  }
+}
+
+/* Moves the expression into a new arena, NULL if allocation failed */
+static struct expr *expr_arena_create(struct expr_arena *a, struct expr *e) {
+  size_t size = expr_arena_round(sizeof(struct expr)) + expr_arena_size(e);
+  a->mem = (char *)malloc(size);
+  a->size = size;
+  a->used = 0;
+  if (a->mem == NULL) {
+    return NULL;
+  }
+  struct expr *root = (struct expr *)expr_arena_alloc(a, sizeof(struct expr));
+  *root = *e;
+  free(e);
+  expr_arena_move(a, root);
+  return root;
+}
+
+static void expr_arena_cleanup(struct expr *e) {
+  vec_expr_t *args = expr_arena_args(e);
+  if (args != NULL) {
+    for (int i = 0; i < vec_len(args); i++) {
+      expr_arena_cleanup(&vec_nth(args, i));
+    }
+  }
+  if (e->type == OP_FUNC && e->param.func.context != NULL &&
+      e->param.func.f->cleanup != NULL) {
+    e->param.func.f->cleanup(e->param.func.f, e->param.func.context);
+  }
+}
+
+static void expr_arena_destroy(struct expr_arena *a, struct expr *e) {
+  if (e != NULL) {
+    expr_arena_cleanup(e);
+  }
+  free(a->mem);
+  a->mem = NULL;
+  a->size = a->used = 0;
+}
+
+/*
+ * Optimizer
+ *
+ * expr_optimize() rewrites a parsed expression in place. Constant subtrees,
+ * including pure functions with constant arguments, are replaced with their
+ * values, variables that the host marked as constant are folded unless the
+ * expression assigns them, and some operators are replaced with cheaper ones
+ * that give the same results.
+ */
+
+/* Replaces the node with one of its operands */
+static void expr_optimize_keep(struct expr *e, int keep) {
+  int i;
+  struct expr arg;
+  struct expr kept = vec_nth(&e->param.op.args, keep);
+  vec_foreach(&e->param.op.args, arg, i) {
+    if (i != keep) {
+      expr_destroy_args(&arg);
+    }
+  }
+  vec_free(&e->param.op.args);
+  *e = kept;
+}
+
+static void expr_optimize_fold(struct expr *e, float value) {
+  expr_destroy_args(e);
+  e->type = OP_CONST;
+  e->param.num.value = value;
+}
+
+static int expr_optimize_const(struct expr *e, float value) {
+  return e->type == OP_CONST && e->param.num.value == value;
+}
+
+/* Variables written by functions, like the loop variables of each() */
+static void expr_optimize_written(struct expr *e,
+                                  struct expr_var_list *vars) {
+  if (e->type == OP_VAR) {
+    struct expr_var *v = expr_var_find(vars, e->param.var.value);
+    if (v != NULL) {
+      v->constant = 0;
+    }
+  } else if (e->type == OP_COMMA) {
+    expr_optimize_written(&vec_nth(&e->param.op.args, 0), vars);
+    expr_optimize_written(&vec_nth(&e->param.op.args, 1), vars);
+  }
+}
+
+static void expr_optimize_assigned(struct expr *e,
+                                   struct expr_var_list *vars) {
+  int i;
+  struct expr arg;
+  if (e->type == OP_FUNC) {
+    vec_foreach(&e->param.func.args, arg, i) {
+      if (e->param.func.f->flags & EXPR_FUNC_ASSIGNS) {
+        expr_optimize_written(&arg, vars);
+      }
+      expr_optimize_assigned(&arg, vars);
+    }
+  } else if (e->type != OP_CONST && e->type != OP_VAR) {
+    if (e->type == OP_ASSIGN) {
+      expr_optimize_written(&vec_nth(&e->param.op.args, 0), vars);
+    }
+    vec_foreach(&e->param.op.args, arg, i) { expr_optimize_assigned(&arg, vars); }
+  }
+}
+
+static void expr_optimize_node(struct expr *e, struct expr_var_list *vars) {
+  int i, constant = 1;
+  if (e->type == OP_CONST) {
+    return;
+  } else if (e->type == OP_VAR) {
+    struct expr_var *v = expr_var_find(vars, e->param.var.value);
+    if (v != NULL && v->constant) {
+      expr_optimize_fold(e, *v->value);
+    }
+    return;
+  } else if (e->type == OP_FUNC) {
+    vec_expr_t *args = &e->param.func.args;
+    for (i = 0; i < vec_len(args); i++) {
+      expr_optimize_node(&vec_nth(args, i), vars);
+      constant = constant && vec_nth(args, i).type == OP_CONST;
     }
+    if (constant && (e->param.func.f->flags & EXPR_FUNC_PURE)) {
+      expr_optimize_fold(e, expr_eval(e));
+    }
+    return;
+  }
+
+  vec_expr_t *args = &e->param.op.args;
+  for (i = 0; i < vec_len(args); i++) {
+    if (e->type != OP_ASSIGN || i > 0) {
+      expr_optimize_node(&vec_nth(args, i), vars);
+    }
+    constant = constant && vec_nth(args, i).type == OP_CONST;
   }
+  struct expr *a = &vec_nth(args, 0);
+  struct expr *b = (vec_len(args) > 1 ? &vec_nth(args, 1) : NULL);
+  if (e->type == OP_ASSIGN || e->type == OP_COMMA) {
+    /* Functions like seq() or each() take tuples apart, keep them intact */
+    return;
+  } else if (constant) {
+    expr_optimize_fold(e, expr_eval(e));
+  } else if (e->type == OP_DIVIDE && b->type == OP_CONST) {
+    /* Division by a power of two is an exact multiplication */
+    int exp;
+    float m = frexpf(b->param.num.value, &exp);
+    if ((m == 0.5f || m == -0.5f) && isfinite(1 / b->param.num.value)) {
+      e->type = OP_MULTIPLY;
+      b->param.num.value = 1 / b->param.num.value;
+      expr_optimize_node(e, vars);
+    }
+  } else if (e->type == OP_POWER && expr_optimize_const(b, 2) &&
+             a->type == OP_VAR) {
+    e->type = OP_MULTIPLY;
+    *b = *a;
+  } else if (e->type == OP_MULTIPLY && expr_optimize_const(b, 1)) {
+    expr_optimize_keep(e, 0);
+  } else if (e->type == OP_MULTIPLY && expr_optimize_const(a, 1)) {
+    expr_optimize_keep(e, 1);
+  } else if (e->type == OP_MINUS && b->type == OP_CONST &&
+             b->param.num.value == 0 && !signbit(b->param.num.value)) {
+    expr_optimize_keep(e, 0);
+  }
+}
+
+static void expr_optimize(struct expr *e, struct expr_var_list *vars) {
+  expr_optimize_assigned(e, vars);
+  expr_optimize_node(e, vars);
 }
 
 #ifdef __cplusplus
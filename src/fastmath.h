@@ -0,0 +1,235 @@
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "simd.h"
+
+/*
+ * Polynomial approximations of the few transcendental functions glitch needs
+ * per sample. Every function has a scalar version and a block version. When
+ * SIMD_LANES is defined the block version renders whole vectors and falls
+ * back to the scalar code for the tail; both perform the same float
+ * operations in the same order, so they return identical results.
+ *
+ * Maximum errors over the full range of normal inputs:
+ *
+ *   fast_exp2(x)   2^x           relative error < 1.7e-7, exact for integer x,
+ *                                0 below 2^-125
+ *   fast_log2(x)   log2(x)       absolute error < 1.5e-7 for |log2(x)| <= 1,
+ *                                relative error < 1.1e-7 elsewhere,
+ *                                exact for powers of two
+ *   fast_sin(x)    sin(2*pi*x)   absolute error < 1.7e-7, exact at quarters
+ *   fast_sqrt(x)   sqrt(x)       correctly rounded (hardware instruction)
+ *
+ * NAN propagates, exp2(-inf) is 0, exp2(+inf) and log2(+inf) are +inf,
+ * log2(0) is -inf and log2 of a negative number is NAN.
+ */
+
+/* 2^f for f in [0, 1) is 1 + f*(C1 + f*(C2 + ...)), minimax relative error */
+#define FAST_EXP2_C1 0.69315131f
+#define FAST_EXP2_C2 0.24016445f
+#define FAST_EXP2_C3 0.055799913f
+#define FAST_EXP2_C4 0.0090170303f
+#define FAST_EXP2_C5 0.0018671301f
+
+/* log2((1+t)/(1-t)) = t * 2/ln(2) * (1 + t^2/3 + t^4/5 + ...) */
+#define FAST_LOG2_C1 2.8853900818f
+#define FAST_LOG2_C3 0.9617966939f
+#define FAST_LOG2_C5 0.5770780164f
+#define FAST_LOG2_C7 0.4121985831f
+
+/* sin(pi/2 * z) on [-1, 1], odd minimax polynomial with p(1) = 1 */
+#define FAST_SIN_C1 1.5707964f
+#define FAST_SIN_C3 -0.64596408f
+#define FAST_SIN_C5 0.079691904f
+#define FAST_SIN_C7 -0.0046775475f
+#define FAST_SIN_C9 0.00015340045f
+
+static inline float fast_bits_float(uint32_t i) {
+  float f;
+  memcpy(&f, &i, sizeof(f));
+  return f;
+}
+
+static inline uint32_t fast_float_bits(float f) {
+  uint32_t i;
+  memcpy(&i, &f, sizeof(i));
+  return i;
+}
+
+/* Quarter of a sine period, z in [-1, 1] maps to sin(pi/2 * z) */
+static inline float fast_sin_poly(float z) {
+  float z2 = z * z;
+  return z * (FAST_SIN_C1 +
+              z2 * (FAST_SIN_C3 +
+                    z2 * (FAST_SIN_C5 +
+                          z2 * (FAST_SIN_C7 + z2 * FAST_SIN_C9))));
+}
+
+static inline float fast_exp2(float x) {
+  if (isnan(x)) {
+    return x;
+  } else if (x >= 128.f) {
+    return INFINITY;
+  } else if (x < -125.f) {
+    return 0;
+  }
+  int32_t i = (int32_t)x;
+  if (x < (float)i) {
+    i = i - 1;
+  }
+  float f = x - (float)i;
+  float p =
+      1.f +
+      f * (FAST_EXP2_C1 +
+           f * (FAST_EXP2_C2 +
+                f * (FAST_EXP2_C3 + f * (FAST_EXP2_C4 + f * FAST_EXP2_C5))));
+  return fast_bits_float(fast_float_bits(p) + ((uint32_t)i << 23));
+}
+
+static inline float fast_log2(float x) {
+  if (isnan(x) || x < 0) {
+    return NAN;
+  } else if (x == 0) {
+    return -INFINITY;
+  } else if (x == INFINITY) {
+    return INFINITY;
+  }
+  int32_t e = 0;
+  if (x < FLT_MIN) {
+    x = x * 8388608.f;
+    e = -23;
+  }
+  uint32_t bits = fast_float_bits(x);
+  e = e + (int32_t)(bits >> 23) - 127;
+  float m = fast_bits_float((bits & 0x7fffff) | 0x3f800000);
+  if (1.41421356f < m) {
+    m = m * 0.5f;
+    e = e + 1;
+  }
+  float t = (m - 1.f) / (m + 1.f);
+  float t2 = t * t;
+  return (float)e +
+         t * (FAST_LOG2_C1 +
+              t2 * (FAST_LOG2_C3 + t2 * (FAST_LOG2_C5 + t2 * FAST_LOG2_C7)));
+}
+
+/* Sine of x turns, i.e. with a period of 1 like the SIN() lookup table had */
+static inline float fast_sin(float x) {
+  float r = x - rintf(x);
+  float a = fabsf(r);
+  float b = 0.5f - a;
+  float y = fast_sin_poly(4.f * (a < b ? a : b));
+  return copysignf(y, r);
+}
+
+static inline float fast_sqrt(float x) { return sqrtf(x); }
+
+#ifdef SIMD_LANES
+static inline simd_f simd_sin_poly(simd_f z) {
+  simd_f z2 = simd_mulf(z, z);
+  simd_f y = simd_mulf(z2, simd_set1f(FAST_SIN_C9));
+  y = simd_mulf(z2, simd_addf(simd_set1f(FAST_SIN_C7), y));
+  y = simd_mulf(z2, simd_addf(simd_set1f(FAST_SIN_C5), y));
+  y = simd_mulf(z2, simd_addf(simd_set1f(FAST_SIN_C3), y));
+  return simd_mulf(z, simd_addf(simd_set1f(FAST_SIN_C1), y));
+}
+
+static inline simd_f simd_exp2(simd_f x) {
+  simd_i i = simd_ftoit(x);
+  /* Truncation rounds negative numbers up, a true mask is -1 */
+  i = simd_addi(i, simd_castfi(simd_ltf(x, simd_itof(i))));
+  simd_f f = simd_subf(x, simd_itof(i));
+  simd_f p = simd_mulf(f, simd_set1f(FAST_EXP2_C5));
+  p = simd_mulf(f, simd_addf(simd_set1f(FAST_EXP2_C4), p));
+  p = simd_mulf(f, simd_addf(simd_set1f(FAST_EXP2_C3), p));
+  p = simd_mulf(f, simd_addf(simd_set1f(FAST_EXP2_C2), p));
+  p = simd_mulf(f, simd_addf(simd_set1f(FAST_EXP2_C1), p));
+  p = simd_addf(simd_set1f(1.f), p);
+  simd_f r = simd_castif(simd_addi(simd_castfi(p), simd_slli(i, 23)));
+  r = simd_andnotf(simd_ltf(x, simd_set1f(-125.f)), r);
+  r = simd_selectf(simd_lef(simd_set1f(128.f), x), simd_set1f(INFINITY), r);
+  return simd_selectf(simd_ordf(x), r, x);
+}
+
+static inline simd_f simd_log2(simd_f x) {
+  simd_f small = simd_ltf(x, simd_set1f(FLT_MIN));
+  simd_f xs = simd_selectf(small, simd_mulf(x, simd_set1f(8388608.f)), x);
+  simd_i e = simd_andi(simd_castfi(small), simd_set1i(-23));
+  simd_i bits = simd_castfi(xs);
+  e = simd_addi(e, simd_subi(simd_srli(bits, 23), simd_set1i(127)));
+  simd_f m = simd_castif(simd_ori(simd_andi(bits, simd_set1i(0x7fffff)),
+                                  simd_set1i(0x3f800000)));
+  simd_f big = simd_ltf(simd_set1f(1.41421356f), m);
+  m = simd_selectf(big, simd_mulf(m, simd_set1f(0.5f)), m);
+  e = simd_subi(e, simd_castfi(big));
+  simd_f t = simd_divf(simd_subf(m, simd_set1f(1.f)),
+                       simd_addf(m, simd_set1f(1.f)));
+  simd_f t2 = simd_mulf(t, t);
+  simd_f p = simd_mulf(t2, simd_set1f(FAST_LOG2_C7));
+  p = simd_mulf(t2, simd_addf(simd_set1f(FAST_LOG2_C5), p));
+  p = simd_mulf(t2, simd_addf(simd_set1f(FAST_LOG2_C3), p));
+  p = simd_mulf(t, simd_addf(simd_set1f(FAST_LOG2_C1), p));
+  simd_f r = simd_addf(simd_itof(e), p);
+  r = simd_selectf(simd_eqf(x, simd_set1f(INFINITY)), x, r);
+  r = simd_selectf(simd_eqf(x, simd_set1f(0)), simd_set1f(-INFINITY), r);
+  return simd_selectf(simd_lef(simd_set1f(0), x), r, simd_set1f(NAN));
+}
+
+static inline simd_f simd_sin(simd_f x) {
+  /* Conversion only works for small numbers, larger ones are whole turns */
+  simd_f r = simd_subf(x, simd_itof(simd_ftoi(x)));
+  r = simd_selectf(simd_ltf(simd_absf(x), simd_set1f(8388608.f)), r,
+                   simd_subf(x, x));
+  simd_f a = simd_absf(r);
+  simd_f b = simd_subf(simd_set1f(0.5f), a);
+  simd_f y = simd_sin_poly(simd_mulf(simd_set1f(4.f), simd_minf(a, b)));
+  simd_f sign = simd_andf(r, simd_castif(simd_set1i(INT32_MIN)));
+  return simd_orf(y, sign);
+}
+
+static inline simd_f simd_sqrt(simd_f x) { return simd_sqrtf(x); }
+#endif
+
+#ifdef SIMD_LANES
+#define FAST_BLOCK(f, x, out, n)                                               \
+  do {                                                                         \
+    int i_ = 0;                                                                \
+    for (; i_ + SIMD_LANES <= (n); i_ += SIMD_LANES) {                         \
+      simd_storef((out) + i_, simd_##f(simd_loadf((x) + i_)));                 \
+    }                                                                          \
+    for (; i_ < (n); i_++) {                                                   \
+      (out)[i_] = fast_##f((x)[i_]);                                           \
+    }                                                                          \
+  } while (0)
+#else
+#define FAST_BLOCK(f, x, out, n)                                               \
+  do {                                                                         \
+    for (int i_ = 0; i_ < (n); i_++) {                                         \
+      (out)[i_] = fast_##f((x)[i_]);                                           \
+    }                                                                          \
+  } while (0)
+#endif
+
+/* Block variants, x and out may be the same buffer */
+static inline void fast_exp2_block(const float *x, float *out, int n) {
+  FAST_BLOCK(exp2, x, out, n);
+}
+
+static inline void fast_log2_block(const float *x, float *out, int n) {
+  FAST_BLOCK(log2, x, out, n);
+}
+
+static inline void fast_sin_block(const float *x, float *out, int n) {
+  FAST_BLOCK(sin, x, out, n);
+}
+
+static inline void fast_sqrt_block(const float *x, float *out, int n) {
+  FAST_BLOCK(sqrt, x, out, n);
+}
+
+#endif /* FASTMATH_H */
@@ -7,6 +7,8 @@
 #include "tr808.h"
 
 #include "expr.h"
+#include "fastmath.h"
+#include "simd.h"
 
 static int SAMPLE_RATE = 48000;
 
@@ -15,17 +17,42 @@ static glitch_loader_fn loader = NULL;
 #define PI 3.1415926f
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
-#define MAX_DELAY_TIME 10    /* seconds */
-#define MIN_DELAY_BLOCK 8192 /* smallest delay buffer resize */
+/* Script hand-off between the compiler and the audio thread */
+#define ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define ATOMIC_EXCHANGE(p, v) __atomic_exchange_n((p), (v), __ATOMIC_ACQ_REL)
+#define ATOMIC_CAS(p, expected, v)                                             \
+  __atomic_compare_exchange_n((p), (expected), (v), 0, __ATOMIC_ACQ_REL,       \
+                              __ATOMIC_ACQUIRE)
+/* No pending glitch_xy(), both halves would be the same all-ones NAN */
+#define GLITCH_XY_NONE UINT64_MAX
+
+#define MAX_DELAY_TIME 10 /* seconds */
+#define MIN_PLUCK_FREQ 20 /* Hz, lower notes are clamped to this pitch */
 
 #ifdef GLITCH_USE_MATH
 #include <math.h>
 #define LOG2(n) (logf(n) / logf(2.f))
 #define POW2(n) (powf(2.f, (n)))
 #define SQRT(n) (sqrt(n))
-#define SIN(n) (sinf((n)*2 * PI))
+#define SIN(n) (sinf(fwrap(n) * 2 * PI))
+#define MATH_BLOCK(f, x, out, n)                                               \
+  do {                                                                         \
+    for (int i_ = 0; i_ < (n); i_++) {                                         \
+      (out)[i_] = f((x)[i_]);                                                  \
+    }                                                                          \
+  } while (0)
+#define LOG2_BLOCK(x, out, n) MATH_BLOCK(LOG2, x, out, n)
+#define POW2_BLOCK(x, out, n) MATH_BLOCK(POW2, x, out, n)
+#define SIN_BLOCK(x, out, n) MATH_BLOCK(SIN, x, out, n)
 #else
-#include "math_lut.h"
+#define LOG2(n) fast_log2(n)
+#define POW2(n) fast_exp2(n)
+#define SQRT(n) fast_sqrt(n)
+#define SIN(n) fast_sin(n)
+#define LOG2_BLOCK(x, out, n) fast_log2_block((x), (out), (n))
+#define POW2_BLOCK(x, out, n) fast_exp2_block((x), (out), (n))
+#define SIN_BLOCK(x, out, n) fast_sin_block((x), (out), (n))
 #endif
 
 static float arg(vec_expr_t args, int n, float defval) {
@@ -35,6 +62,27 @@ static float arg(vec_expr_t args, int n, float defval) {
   return expr_eval(&vec_nth(&args, n));
 }
 
+/* Block variants get their arguments evaluated for every frame in the block */
+static inline float block_arg(float **argv, int argc, int n, int frame,
+                              float defval) {
+  if (argc < n + 1) {
+    return defval;
+  }
+  return argv[n][frame];
+}
+
+/* Whole block of an argument, missing ones are filled into buf */
+static inline const float *block_args(float **argv, int argc, int n,
+                                      float *buf, int frames, float defval) {
+  if (argc < n + 1) {
+    for (int i = 0; i < frames; i++) {
+      buf[i] = defval;
+    }
+    return buf;
+  }
+  return argv[n];
+}
+
 static inline float fwrap(float x) { return x - (long)x; }
 static inline float fwrap2(float x) { return fwrap(fwrap(x) + 1); }
 static inline float fsign(float x) { return (x < 0 ? -1 : 1); }
@@ -48,8 +96,7 @@ static inline float flim(float x, float a, float b) {
 }
 
 struct osc_context {
-  float freq;
-  float w;
+  uint32_t phase; /* one period is 2^32, wraps around on its own */
 };
 
 struct fm_context {
@@ -68,9 +115,12 @@ typedef vec(float) vec_float_t;
 typedef vec(struct seq_step) vec_step_t;
 
 struct pluck_context {
+  float *buf; /* power of two frames, allocated by glitch_compile() */
+  uint32_t mask;
+  uint32_t pos;
+  uint32_t fill; /* frames of excitation left to write */
+  uint32_t seed; /* noise generator state */
   int init;
-  int t;
-  float *sample;
 };
 
 struct seq_step {
@@ -112,16 +162,38 @@ struct mix_context {
   vec_float_t values;
 };
 
+enum filter_type { FILTER_LPF, FILTER_HPF, FILTER_BPF, FILTER_BSF };
+
+/* Frames between coefficient updates of a modulated biquad */
+#define FILTER_CONTROL 16
+
 struct filter_context {
-  float x1;
-  float x2;
-  float y1;
-  float y2;
+  float s1; /* transposed direct form II state */
+  float s2;
+  float w0; /* target coefficients are for this cutoff and q */
+  float q;
+  int tick;  /* frames until the next coefficient update */
+  int glide; /* frames until the coefficients reach their target */
+  float c[5]; /* b0, b1, b2, a1, a2, normalized by a0 */
+  float dc[5];
+  float target[5];
+};
+
+struct svf_context {
+  float ic1; /* trapezoidal integrator states */
+  float ic2;
+  float w0; /* coefficients below are for this cutoff and q */
+  float q;
+  float k;
+  float a1;
+  float a2;
+  float a3;
 };
 
 struct delay_context {
-  vec_float_t buf;
-  int pos;
+  float *buf; /* power of two frames, allocated by glitch_compile() */
+  uint32_t mask;
+  uint32_t pos;
 };
 
 struct each_context {
@@ -129,25 +201,63 @@ struct each_context {
   vec_expr_t args;
 };
 
+/* Frames of a sample, see sampler_render() */
+struct sampler_src {
+  const float *data;
+  const int16_t *data16; /* read instead of data if set */
+  int len;
+  int rate;  /* frames per second, 0 if the same as the engine */
+  float end; /* value past the last frame */
+};
+
 struct sample_context {
-  float t;
+  double t;
+  int init;  /* variant has been resolved */
+  int tuned; /* src and step are set for pitch */
+  int variant;
+  float pitch; /* argument the step has been computed for */
+  float step;
+  const struct glitch_sample *sample;
+  struct sampler_src src;
 };
 
-static float lib_byte(struct expr_func *f, vec_expr_t args, void *context) {
-  (void)f;
-  (void)context;
-  float x = arg(args, 0, 127);
+static float byte_step(float x) {
   if (isnan(x)) {
     return NAN;
   }
   return (((int)x & 255) - 127) / 128.0;
 }
 
+static float lib_byte(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  (void)context;
+  return byte_step(arg(args, 0, 127));
+}
+
+static void lib_byte_block(struct expr_func *f, float **argv, int argc,
+                           void *context, float *out, int n) {
+  (void)f;
+  (void)context;
+  for (int i = 0; i < n; i++) {
+    out[i] = byte_step(block_arg(argv, argc, 0, i, 127));
+  }
+}
+
 static float lib_s(struct expr_func *f, vec_expr_t args, void *context) {
   (void)f;
   (void)context;
-  float w = arg(args, 0, 0);
-  return SIN(fwrap2(w));
+  return SIN(arg(args, 0, 0));
+}
+
+static void lib_s_block(struct expr_func *f, float **argv, int argc,
+                        void *context, float *out, int n) {
+  (void)f;
+  (void)context;
+  if (argc < 1) {
+    memset(out, 0, n * sizeof(float));
+    return;
+  }
+  SIN_BLOCK(argv[0], out, n);
 }
 
 static float lib_r(struct expr_func *f, vec_expr_t args, void *context) {
@@ -156,15 +266,44 @@ static float lib_r(struct expr_func *f, vec_expr_t args, void *context) {
   return rand() * arg(args, 0, 1) / RAND_MAX;
 }
 
-static float lib_l(struct expr_func *f, vec_expr_t args, void *context) {
+static void lib_r_block(struct expr_func *f, float **argv, int argc,
+                        void *context, float *out, int n) {
   (void)f;
   (void)context;
-  if (arg(args, 0, 0)) {
-    return LOG2(arg(args, 0, 0));
+  for (int i = 0; i < n; i++) {
+    out[i] = rand() * block_arg(argv, argc, 0, i, 1) / RAND_MAX;
+  }
+}
+
+static float l_step(float x) {
+  if (x) {
+    return LOG2(x);
   }
   return 0;
 }
 
+static float lib_l(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  (void)context;
+  return l_step(arg(args, 0, 0));
+}
+
+static void lib_l_block(struct expr_func *f, float **argv, int argc,
+                        void *context, float *out, int n) {
+  (void)f;
+  (void)context;
+  if (argc < 1) {
+    memset(out, 0, n * sizeof(float));
+    return;
+  }
+  LOG2_BLOCK(argv[0], out, n);
+  for (int i = 0; i < n; i++) {
+    if (argv[0][i] == 0) {
+      out[i] = 0;
+    }
+  }
+}
+
 static float lib_a(struct expr_func *f, vec_expr_t args, void *context) {
   (void)f;
   (void)context;
@@ -199,11 +338,7 @@ static int scales[][13] = {
     {12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}, // chromatic is a fallback scale
 };
 
-static float lib_scale(struct expr_func *f, vec_expr_t args, void *context) {
-  (void)f;
-  (void)context;
-  float note = arg(args, 0, 0);
-  float scale = arg(args, 1, 0);
+static float scale_step(float note, float scale) {
   if (isnan(scale) || isnan(note)) {
     return NAN;
   }
@@ -218,12 +353,58 @@ static float lib_scale(struct expr_func *f, vec_expr_t args, void *context) {
   return scales[(int)scale][n + 1] + transpose;
 }
 
+static float lib_scale(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  (void)context;
+  float note = arg(args, 0, 0);
+  float scale = arg(args, 1, 0);
+  return scale_step(note, scale);
+}
+
+static void lib_scale_block(struct expr_func *f, float **argv, int argc,
+                            void *context, float *out, int n) {
+  (void)f;
+  (void)context;
+  for (int i = 0; i < n; i++) {
+    out[i] = scale_step(block_arg(argv, argc, 0, i, 0),
+                        block_arg(argv, argc, 1, i, 0));
+  }
+}
+
 static float lib_hz(struct expr_func *f, vec_expr_t args, void *context) {
   (void)f;
   (void)context;
   return POW2(arg(args, 0, 0) / 12.f) * 440.f;
 }
 
+static void lib_hz_block(struct expr_func *f, float **argv, int argc,
+                         void *context, float *out, int n) {
+  (void)f;
+  (void)context;
+  for (int i = 0; i < n; i++) {
+    out[i] = block_arg(argv, argc, 0, i, 0) / 12.f;
+  }
+  POW2_BLOCK(out, out, n);
+  for (int i = 0; i < n; i++) {
+    out[i] = out[i] * 440.f;
+  }
+}
+
+/* Clones the body for every list of values. The compiler does it before the
+ * clones are prepared, so that their functions get buffers too */
+static int each_init(struct each_context *each, vec_expr_t *args) {
+  each->init = 1;
+  for (int i = 0; i < vec_len(args) - 2; i++) {
+    struct expr tmp = {0};
+    expr_copy(&tmp, &vec_nth(args, 1));
+    if (vec_push(&each->args, tmp) < 0) {
+      expr_destroy_args(&tmp);
+      return -1;
+    }
+  }
+  return 0;
+}
+
 static float lib_each(struct expr_func *f, vec_expr_t args, void *context) {
   (void)f;
   struct each_context *each = (struct each_context *)context;
@@ -234,12 +415,7 @@ static float lib_each(struct expr_func *f, vec_expr_t args, void *context) {
   }
 
   if (!each->init) {
-    each->init = 1;
-    for (int i = 0; i < vec_len(&args) - 2; i++) {
-      struct expr tmp = {0};
-      expr_copy(&tmp, &vec_nth(&args, 1));
-      vec_push(&each->args, tmp);
-    }
+    each_init(each, &args);
   }
 
   // List of variables
@@ -273,6 +449,11 @@ static float lib_each(struct expr_func *f, vec_expr_t args, void *context) {
   return mix / SQRT(vec_len(&each->args));
 }
 
+static vec_expr_t *lib_each_trees(struct expr_func *f, void *context) {
+  (void)f;
+  return &((struct each_context *)context)->args;
+}
+
 static void lib_each_cleanup(struct expr_func *f, void *context) {
   (void)f;
   int i;
@@ -282,41 +463,264 @@ static void lib_each_cleanup(struct expr_func *f, void *context) {
   vec_free(&each->args);
 }
 
-static float lib_osc(struct expr_func *f, vec_expr_t args, void *context) {
-  struct osc_context *osc = (struct osc_context *)context;
+/*
+ * Oscillators keep an integer phase accumulator. Each waveform has its own
+ * kernel rendering a block of phases, vectorized when SIMD_LANES is defined.
+ * The scalar loops perform the same float operations in the same order, so
+ * that sample by sample and block rendering give identical results.
+ */
+#define OSC_SCALE (1.f / 2147483648.f) /* signed phase to [-1, 1) */
+
+/* Phase increment per frame, frequencies alias into [-rate/2, rate/2] */
+static inline int32_t osc_inc(float freq) {
+  float x = freq / SAMPLE_RATE;
+  x = (x - rintf(x)) * 4294967296.f;
+  if (isnan(freq)) {
+    return 0;
+  }
+  /* Matches the vector conversion, which gives INT32_MIN when out of range */
+  if (!(x >= -2147483648.f && x < 2147483648.f)) {
+    return INT32_MIN;
+  }
+  return (int32_t)x;
+}
+
+/* Fills in the phase of each frame and advances the oscillator, returns
+ * non-zero if any frequency is NAN */
+static int osc_phases(struct osc_context *osc, const float *freq,
+                      uint32_t *phase, int32_t *inc, int n) {
+  int i = 0;
+  int nan = 0;
+#ifdef SIMD_LANES
+  simd_f rate = simd_set1f((float)SAMPLE_RATE);
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_f f = simd_loadf(freq + i);
+    simd_f x = simd_divf(f, rate);
+    x = simd_subf(x, simd_itof(simd_ftoi(x)));
+    /* Out of range conversion gives INT32_MIN, which is what we want */
+    simd_i d = simd_ftoit(simd_mulf(x, simd_set1f(4294967296.f)));
+    simd_storei(inc + i, simd_andi(d, simd_castfi(simd_ordf(f))));
+  }
+#endif
+  for (; i < n; i++) {
+    inc[i] = osc_inc(freq[i]);
+  }
+  uint32_t p = osc->phase;
+  for (i = 0; i < n; i++) {
+    phase[i] = p;
+    p = p + (uint32_t)inc[i];
+    nan = nan | isnan(freq[i]);
+  }
+  osc->phase = p;
+  return nan;
+}
+
+/* Triangle folds the phase into [-1, 1], sine is a polynomial over it */
+static inline float osc_tri1(uint32_t phase) {
+  return 2 * fabsf((int32_t)(phase + 0x40000000u) * OSC_SCALE) - 1;
+}
+
+#ifdef SIMD_LANES
+static inline simd_f osc_tri4(simd_i phase) {
+  simd_i u = simd_addi(phase, simd_set1i(0x40000000));
+  simd_f s = simd_mulf(simd_itof(u), simd_set1f(OSC_SCALE));
+  return simd_subf(simd_mulf(simd_set1f(2), simd_absf(s)), simd_set1f(1));
+}
+#endif
+
+static void osc_sin(const uint32_t *phase, float *out, int n) {
+  int i = 0;
+#ifdef SIMD_LANES
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_storef(out + i, simd_sin_poly(osc_tri4(simd_loadi(phase + i))));
+  }
+#endif
+  for (; i < n; i++) {
+    out[i] = fast_sin_poly(osc_tri1(phase[i]));
+  }
+}
+
+static void osc_tri(const uint32_t *phase, float *out, int n) {
+  int i = 0;
+#ifdef SIMD_LANES
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_storef(out + i, osc_tri4(simd_loadi(phase + i)));
+  }
+#endif
+  for (; i < n; i++) {
+    out[i] = osc_tri1(phase[i]);
+  }
+}
+
+/* Saw jumps at half of the period, to the side it is heading from */
+static void osc_saw(const uint32_t *phase, const int32_t *inc, float *out,
+                    int n) {
+  int i = 0;
+#ifdef SIMD_LANES
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_i neg = simd_gti(simd_set1i(0), simd_loadi(inc + i));
+    simd_i u = simd_subi(simd_xori(simd_loadi(phase + i), neg), neg);
+    simd_f s = simd_mulf(simd_itof(u), simd_set1f(OSC_SCALE));
+    simd_f sign = simd_castif(simd_andi(neg, simd_set1i(INT32_MIN)));
+    simd_storef(out + i, simd_xorf(s, sign));
+  }
+#endif
+  for (; i < n; i++) {
+    if (inc[i] < 0) {
+      out[i] = -((int32_t)(0u - phase[i]) * OSC_SCALE);
+    } else {
+      out[i] = (int32_t)phase[i] * OSC_SCALE;
+    }
+  }
+}
+
+static void osc_sqr(const uint32_t *phase, const float *pwm, float *out,
+                    int n) {
+  int i = 0;
+#ifdef SIMD_LANES
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_i u = simd_srli(simd_loadi(phase + i), 8);
+    simd_f w = simd_mulf(simd_itof(u), simd_set1f(1.f / 16777216.f));
+    simd_f mask = simd_ltf(w, simd_loadf(pwm + i));
+    simd_storef(out + i,
+                simd_selectf(mask, simd_set1f(1), simd_set1f(-1)));
+  }
+#endif
+  for (; i < n; i++) {
+    float w = (int32_t)(phase[i] >> 8) * (1.f / 16777216.f);
+    out[i] = (w < pwm[i] ? 1 : -1);
+  }
+}
+
+/* Replaces the frames where the frequency was NAN, or all if there was none */
+static void osc_nan(const float *freq, float *out, int n) {
+  for (int i = 0; i < n; i++) {
+    if (freq == NULL || isnan(freq[i])) {
+      out[i] = NAN;
+    }
+  }
+}
+
+static float lib_sin(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  uint32_t phase;
+  int32_t inc;
+  float freq = arg(args, 0, NAN);
+  float out;
+  osc_phases((struct osc_context *)context, &freq, &phase, &inc, 1);
+  osc_sin(&phase, &out, 1);
+  return isnan(freq) ? NAN : out;
+}
+
+static float lib_tri(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  uint32_t phase;
+  int32_t inc;
+  float freq = arg(args, 0, NAN);
+  float out;
+  osc_phases((struct osc_context *)context, &freq, &phase, &inc, 1);
+  osc_tri(&phase, &out, 1);
+  return isnan(freq) ? NAN : out;
+}
+
+static float lib_saw(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  uint32_t phase;
+  int32_t inc;
+  float freq = arg(args, 0, NAN);
+  float out;
+  osc_phases((struct osc_context *)context, &freq, &phase, &inc, 1);
+  osc_saw(&phase, &inc, &out, 1);
+  return isnan(freq) ? NAN : out;
+}
+
+static float lib_sqr(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  uint32_t phase;
+  int32_t inc;
   float freq = arg(args, 0, NAN);
+  float out;
   if (isnan(freq)) {
     return NAN;
   }
-  float w = osc->w;
-  osc->freq = freq;
-  osc->w = fwrap(osc->w + osc->freq / SAMPLE_RATE);
-  if (strncmp(f->name, "sin", 4) == 0) {
-    return SIN(fwrap2(w));
-  } else if (strncmp(f->name, "tri", 4) == 0) {
-    float sign = fsign(w);
-    w = fwrap(w * sign + 0.25f) - 0.5f;
-    return sign * 4 * (0.25f - w * fsign(w));
-  } else if (strncmp(f->name, "saw", 4) == 0) {
-    return 2 * fwrap(w + 0.5f * fsign(w)) - fsign(w);
-  } else if (strncmp(f->name, "sqr", 4) == 0) {
-    w = fwrap2(w);
-    return w < arg(args, 1, 0.5) ? 1 : -1;
+  float pwm = arg(args, 1, 0.5);
+  osc_phases((struct osc_context *)context, &freq, &phase, &inc, 1);
+  osc_sqr(&phase, &pwm, &out, 1);
+  return out;
+}
+
+static void lib_sin_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  uint32_t phase[EXPR_BLOCK_SIZE];
+  int32_t inc[EXPR_BLOCK_SIZE];
+  if (argc < 1) {
+    osc_nan(NULL, out, n);
+    return;
+  }
+  const float *freq = argv[0];
+  int nan = osc_phases((struct osc_context *)context, freq, phase, inc, n);
+  osc_sin(phase, out, n);
+  if (nan) {
+    osc_nan(freq, out, n);
   }
-  return 0;
 }
 
-static float lib_fm(struct expr_func *f, vec_expr_t args, void *context) {
+static void lib_tri_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
   (void)f;
-  struct fm_context *fm = (struct fm_context *)context;
-  float freq = arg(args, 0, NAN);
-  float mf1 = arg(args, 1, 0);
-  float mi1 = arg(args, 2, 0);
-  float mf2 = arg(args, 3, 0);
-  float mi2 = arg(args, 4, 0);
-  float mf3 = arg(args, 5, 0);
-  float mi3 = arg(args, 6, 0);
+  uint32_t phase[EXPR_BLOCK_SIZE];
+  int32_t inc[EXPR_BLOCK_SIZE];
+  if (argc < 1) {
+    osc_nan(NULL, out, n);
+    return;
+  }
+  const float *freq = argv[0];
+  int nan = osc_phases((struct osc_context *)context, freq, phase, inc, n);
+  osc_tri(phase, out, n);
+  if (nan) {
+    osc_nan(freq, out, n);
+  }
+}
 
+static void lib_saw_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  uint32_t phase[EXPR_BLOCK_SIZE];
+  int32_t inc[EXPR_BLOCK_SIZE];
+  if (argc < 1) {
+    osc_nan(NULL, out, n);
+    return;
+  }
+  const float *freq = argv[0];
+  int nan = osc_phases((struct osc_context *)context, freq, phase, inc, n);
+  osc_saw(phase, inc, out, n);
+  if (nan) {
+    osc_nan(freq, out, n);
+  }
+}
+
+static void lib_sqr_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  uint32_t phase[EXPR_BLOCK_SIZE];
+  int32_t inc[EXPR_BLOCK_SIZE];
+  float buf[EXPR_BLOCK_SIZE];
+  if (argc < 1) {
+    osc_nan(NULL, out, n);
+    return;
+  }
+  const float *freq = argv[0];
+  const float *pwm = block_args(argv, argc, 1, buf, n, 0.5);
+  int nan = osc_phases((struct osc_context *)context, freq, phase, inc, n);
+  osc_sqr(phase, pwm, out, n);
+  if (nan) {
+    osc_nan(freq, out, n);
+  }
+}
+
+static float fm_step(struct fm_context *fm, float freq, float mf1, float mi1,
+                     float mf2, float mi2, float mf3, float mi3) {
   fm->w3 = fwrap(fm->w3 + mf3 * fm->freq / SAMPLE_RATE);
   fm->w2 = fwrap(fm->w2 + mf2 * fm->freq / SAMPLE_RATE);
   fm->w1 = fwrap(fm->w1 + mf1 * fm->freq / SAMPLE_RATE);
@@ -344,6 +748,68 @@ static float lib_fm(struct expr_func *f, vec_expr_t args, void *context) {
   return v0;
 }
 
+static float lib_fm(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  struct fm_context *fm = (struct fm_context *)context;
+  float freq = arg(args, 0, NAN);
+  float mf1 = arg(args, 1, 0);
+  float mi1 = arg(args, 2, 0);
+  float mf2 = arg(args, 3, 0);
+  float mi2 = arg(args, 4, 0);
+  float mf3 = arg(args, 5, 0);
+  float mi3 = arg(args, 6, 0);
+  return fm_step(fm, freq, mf1, mi1, mf2, mi2, mf3, mi3);
+}
+
+static void lib_fm_block(struct expr_func *f, float **argv, int argc,
+                         void *context, float *out, int n) {
+  (void)f;
+  struct fm_context *fm = (struct fm_context *)context;
+  for (int i = 0; i < n; i++) {
+    out[i] = fm_step(
+        fm, block_arg(argv, argc, 0, i, NAN), block_arg(argv, argc, 1, i, 0),
+        block_arg(argv, argc, 2, i, 0), block_arg(argv, argc, 3, i, 0),
+        block_arg(argv, argc, 4, i, 0), block_arg(argv, argc, 5, i, 0),
+        block_arg(argv, argc, 6, i, 0));
+  }
+}
+
+/* Caches the expression of every step, the compiler does it so that the audio
+ * thread never allocates them */
+static int seq_init(struct seq_context *seq, vec_expr_t *args) {
+  seq->init = 1;
+  for (int i = 1; i < vec_len(args); i++) {
+    struct expr *e = &vec_nth(args, i);
+    struct expr *dur = NULL;
+    if (e->type == OP_COMMA) {
+      dur = &vec_nth(&e->param.op.args, 0);
+      e = &vec_nth(&e->param.op.args, 1);
+    }
+    struct seq_step step = {.gliss = 0, .e = e, .dur = dur};
+    if (e->type == OP_COMMA) {
+      int gliss = 0;
+      for (struct expr *sube = e; sube->type == OP_COMMA;
+           sube = &vec_nth(&sube->param.op.args, 1)) {
+        gliss++;
+      }
+      while (e->type == OP_COMMA) {
+        step.e = &vec_nth(&e->param.op.args, 0);
+        step.gliss = gliss;
+        if (vec_push(&seq->steps, step) < 0) {
+          return -1;
+        }
+        e = &vec_nth(&e->param.op.args, 1);
+        step.gliss = -1;
+      }
+      step.e = e;
+    }
+    if (vec_push(&seq->steps, step) < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
 static float lib_seq(struct expr_func *f, vec_expr_t args, void *context) {
   struct seq_context *seq = (struct seq_context *)context;
 
@@ -352,34 +818,8 @@ static float lib_seq(struct expr_func *f, vec_expr_t args, void *context) {
     return NAN;
   }
 
-  /* Initialize vector of steps, cache all expression pointers */
-  if (!seq->init) {
-    seq->init = 1;
-    for (int i = 1; i < vec_len(&args); i++) {
-      struct expr *e = &vec_nth(&args, i);
-      struct expr *dur = NULL;
-      if (e->type == OP_COMMA) {
-        dur = &vec_nth(&e->param.op.args, 0);
-        e = &vec_nth(&e->param.op.args, 1);
-      }
-      struct seq_step step = {.gliss = 0, .e = e, .dur = dur};
-      if (e->type == OP_COMMA) {
-        int gliss = 0;
-        for (struct expr *sube = e; sube->type == OP_COMMA;
-             sube = &vec_nth(&sube->param.op.args, 1)) {
-          gliss++;
-        }
-        while (e->type == OP_COMMA) {
-          step.e = &vec_nth(&e->param.op.args, 0);
-          step.gliss = gliss;
-          vec_push(&seq->steps, step);
-          e = &vec_nth(&e->param.op.args, 1);
-          step.gliss = -1;
-        }
-        step.e = e;
-      }
-      vec_push(&seq->steps, step);
-    }
+  if (!seq->init && seq_init(seq, &args) < 0) {
+    return NAN;
   }
 
   /* A function can be either "seq" or "loop" */
@@ -533,15 +973,39 @@ static float lib_env(struct expr_func *f, vec_expr_t args, void *context) {
   return r * v;
 }
 
-static float lib_mix(struct expr_func *f, vec_expr_t args, void *context) {
-  (void)f;
-  struct mix_context *mix = (struct mix_context *)context;
+/* Last values of the voices, set up by the compiler like seq_init() */
+static int mix_init(struct mix_context *mix, int n) {
   if (!mix->init) {
-    for (int i = 0; i < vec_len(&args); i++) {
-      vec_push(&mix->values, 0);
+    for (int i = 0; i < n; i++) {
+      if (vec_push(&mix->values, 0) < 0) {
+        return -1;
+      }
     }
     mix->init = 1;
   }
+  return 0;
+}
+
+static float mix_clip(float v, int n) {
+  if (n > 0) {
+    v = v / SQRT(n);
+    if (v <= -1.25f) {
+      return -0.984375;
+    } else if (v >= 1.25f) {
+      return 0.984375;
+    } else {
+      return 1.1f * v - 0.2f * v * v * v;
+    }
+  }
+  return 0;
+}
+
+static float lib_mix(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  struct mix_context *mix = (struct mix_context *)context;
+  if (mix_init(mix, vec_len(&args)) < 0) {
+    return NAN;
+  }
   float v = 0;
   for (int i = 0; i < vec_len(&args); i++) {
     struct expr *e = &vec_nth(&args, i);
@@ -552,18 +1016,31 @@ static float lib_mix(struct expr_func *f, vec_expr_t args, void *context) {
     vec_nth(&mix->values, i) = sample;
     v = v + sample;
   }
-  if (vec_len(&args) > 0) {
-    v = v / SQRT(vec_len(&args));
-    if (v <= -1.25f) {
-      return -0.984375;
-    } else if (v >= 1.25f) {
-      return 0.984375;
-    } else {
-      return 1.1f * v - 0.2f * v * v * v;
+  return mix_clip(v, vec_len(&args));
+}
+
+static void lib_mix_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  struct mix_context *mix = (struct mix_context *)context;
+  if (mix_init(mix, argc) < 0) {
+    for (int i = 0; i < n; i++) {
+      out[i] = NAN;
     }
-    return v;
+    return;
+  }
+  for (int i = 0; i < n; i++) {
+    float v = 0;
+    for (int j = 0; j < argc; j++) {
+      float sample = argv[j][i];
+      if (isnan(sample)) {
+        sample = vec_nth(&mix->values, j);
+      }
+      vec_nth(&mix->values, j) = sample;
+      v = v + sample;
+    }
+    out[i] = mix_clip(v, argc);
   }
-  return 0;
 }
 
 static void lib_mix_cleanup(struct expr_func *f, void *context) {
@@ -572,122 +1049,705 @@ static void lib_mix_cleanup(struct expr_func *f, void *context) {
   vec_free(&mix->values);
 }
 
-static float lib_filter(struct expr_func *f, vec_expr_t args, void *context) {
-  struct filter_context *filter = (struct filter_context *)context;
-  float signal = arg(args, 0, NAN);
-  float cutoff = arg(args, 1, 200);
-  float q = arg(args, 2, 1);
+/* Biquad coefficients (RBJ cookbook), normalized by a0 */
+static void filter_coefs(enum filter_type type, float w0, float q,
+                         float *c) {
+  float cs = SIN(fwrap(w0 + 0.25));
+  float sn = SIN(fwrap(w0));
+  float alpha = sn / (2 * q);
+  float a0 = 1 + alpha;
+  float b0, b1, b2;
 
-  if (isnan(signal) || isnan(cutoff) || isnan(q)) {
-    filter->x1 = filter->x2 = filter->y1 = filter->y2 = 0;
-    return NAN;
-  }
-  if (cutoff <= 0 || q <= 0) {
-    return 0;
-  }
-
-  float w0 = cutoff / SAMPLE_RATE;
-  float cs = SIN(fwrap(w0 + 0.25));
-  float sn = SIN(fwrap(w0));
-  float alpha = sn / (2 * q);
-  float a0, a1, a2, b0, b1, b2;
-
-  if (strncmp(f->name, "lpf", 4) == 0) {
+  switch (type) {
+  case FILTER_LPF:
     b0 = (1 - cs) / 2;
     b1 = 1 - cs;
     b2 = (1 - cs) / 2;
-    a0 = 1 + alpha;
-    a1 = -2 * cs;
-    a2 = 1 - alpha;
-  } else if (strncmp(f->name, "hpf", 4) == 0) {
+    break;
+  case FILTER_HPF:
     b0 = (1 + cs) / 2;
     b1 = -(1 + cs);
     b2 = (1 + cs) / 2;
-    a0 = 1 + alpha;
-    a1 = -2 * cs;
-    a2 = 1 - alpha;
-  } else if (strncmp(f->name, "bpf", 4) == 0) {
+    break;
+  case FILTER_BPF:
     b0 = alpha;
     b1 = 0;
     b2 = -alpha;
-    a0 = 1 + alpha;
-    a1 = -2 * cs;
-    a2 = 1 - alpha;
-  } else if (strncmp(f->name, "bsf", 4) == 0) {
+    break;
+  default:
     b0 = 1;
     b1 = -2 * cs;
     b2 = 1;
-    a0 = 1 + alpha;
-    a1 = -2 * cs;
-    a2 = 1 - alpha;
-  } else {
-    return signal;
+    break;
   }
+  c[0] = b0 / a0;
+  c[1] = b1 / a0;
+  c[2] = b2 / a0;
+  c[3] = -2 * cs / a0;
+  c[4] = (1 - alpha) / a0;
+}
 
-  float out = (b0 / a0) * signal + b1 / a0 * filter->x1 + b2 / a0 * filter->x2 -
-              a1 / a0 * filter->y1 - a2 / a0 * filter->y2;
+/* Cutoff and q are sampled every FILTER_CONTROL frames. When they change,
+ * the coefficients glide to the new ones until the next update, the first
+ * ones are taken as is */
+static void filter_control(struct filter_context *filter,
+                           enum filter_type type, float cutoff, float q) {
+  float w0 = cutoff / SAMPLE_RATE;
+  filter->tick = FILTER_CONTROL;
+  if (w0 == filter->w0 && q == filter->q) {
+    return;
+  }
+  int init = (filter->q > 0);
+  filter->w0 = w0;
+  filter->q = q;
+  filter_coefs(type, w0, q, filter->target);
+  if (!init) {
+    memcpy(filter->c, filter->target, sizeof(filter->c));
+    filter->glide = 0;
+    return;
+  }
+  for (int i = 0; i < 5; i++) {
+    filter->dc[i] = (filter->target[i] - filter->c[i]) / FILTER_CONTROL;
+  }
+  filter->glide = FILTER_CONTROL;
+}
 
-  filter->x2 = filter->x1;
-  filter->x1 = signal;
-  filter->y2 = filter->y1;
-  filter->y1 = out;
+static inline float filter_step(struct filter_context *filter,
+                                enum filter_type type, float signal,
+                                float cutoff, float q) {
+  if (isnan(signal) || isnan(cutoff) || isnan(q)) {
+    filter->s1 = filter->s2 = 0;
+    return NAN;
+  }
+  if (cutoff <= 0 || q <= 0) {
+    return 0;
+  }
+  if (filter->tick == 0) {
+    filter_control(filter, type, cutoff, q);
+  }
+  filter->tick--;
+  float *c = filter->c;
+  if (filter->glide > 0) {
+    if (--filter->glide == 0) {
+      memcpy(c, filter->target, sizeof(filter->c));
+    } else {
+      for (int i = 0; i < 5; i++) {
+        c[i] = c[i] + filter->dc[i];
+      }
+    }
+  }
+  float out = c[0] * signal + filter->s1;
+  filter->s1 = c[1] * signal - c[3] * out + filter->s2;
+  filter->s2 = c[2] * signal - c[4] * out;
   return out;
 }
 
+static float filter_eval(enum filter_type type, vec_expr_t args,
+                         void *context) {
+  struct filter_context *filter = (struct filter_context *)context;
+  float signal = arg(args, 0, NAN);
+  float cutoff = arg(args, 1, 200);
+  float q = arg(args, 2, 1);
+  return filter_step(filter, type, signal, cutoff, q);
+}
+
+/* Between control updates of settled coefficients only the state changes,
+ * those frames run in a tight loop */
+static void filter_block(enum filter_type type, float **argv, int argc,
+                         void *context, float *out, int n) {
+  struct filter_context *filter = (struct filter_context *)context;
+  float buf[3][EXPR_BLOCK_SIZE];
+  const float *x = block_args(argv, argc, 0, buf[0], n, NAN);
+  const float *cutoff = block_args(argv, argc, 1, buf[1], n, 200);
+  const float *q = block_args(argv, argc, 2, buf[2], n, 1);
+  int i = 0;
+  while (i < n) {
+    out[i] = filter_step(filter, type, x[i], cutoff[i], q[i]);
+    i++;
+    if (filter->glide > 0 || filter->tick == 0) {
+      continue;
+    }
+    float b0 = filter->c[0], b1 = filter->c[1], b2 = filter->c[2];
+    float a1 = filter->c[3], a2 = filter->c[4];
+    float s1 = filter->s1, s2 = filter->s2;
+    int end = (n - i < filter->tick ? n : i + filter->tick);
+    for (; i < end; i++) {
+      /* Parameters matter again at the next update, unless they are bad */
+      if (isnan(x[i]) || !(cutoff[i] > 0) || !(q[i] > 0)) {
+        break;
+      }
+      float y = b0 * x[i] + s1;
+      s1 = b1 * x[i] - a1 * y + s2;
+      s2 = b2 * x[i] - a2 * y;
+      out[i] = y;
+      filter->tick--;
+    }
+    filter->s1 = s1;
+    filter->s2 = s2;
+  }
+}
+
+static float lib_lpf(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  return filter_eval(FILTER_LPF, args, context);
+}
+
+static float lib_hpf(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  return filter_eval(FILTER_HPF, args, context);
+}
+
+static float lib_bpf(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  return filter_eval(FILTER_BPF, args, context);
+}
+
+static float lib_bsf(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  return filter_eval(FILTER_BSF, args, context);
+}
+
+static void lib_lpf_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  filter_block(FILTER_LPF, argv, argc, context, out, n);
+}
+
+static void lib_hpf_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  filter_block(FILTER_HPF, argv, argc, context, out, n);
+}
+
+static void lib_bpf_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  filter_block(FILTER_BPF, argv, argc, context, out, n);
+}
+
+static void lib_bsf_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  filter_block(FILTER_BSF, argv, argc, context, out, n);
+}
+
+/* State variable filter with trapezoidal integrators (Andrew Simper). Its
+ * coefficients cost one division and two sines, so they simply follow the
+ * cutoff and q on every frame. Mode selects low-pass, high-pass, band-pass
+ * or band-stop output, in the order of the biquads above */
+static float svf_step(struct svf_context *svf, float signal, float cutoff,
+                      float q, int mode) {
+  if (isnan(signal) || isnan(cutoff) || isnan(q)) {
+    svf->ic1 = svf->ic2 = 0;
+    return NAN;
+  }
+  if (cutoff <= 0 || q <= 0) {
+    return 0;
+  }
+  float w0 = cutoff / SAMPLE_RATE;
+  if (w0 != svf->w0 || q != svf->q) {
+    /* g = tan(pi * w0), which only stays finite below Nyquist */
+    float half = (w0 < 0.499f ? w0 : 0.499f) / 2;
+    float g = SIN(half) / SIN(half + 0.25f);
+    svf->w0 = w0;
+    svf->q = q;
+    svf->k = 1 / q;
+    svf->a1 = 1 / (1 + g * (g + svf->k));
+    svf->a2 = g * svf->a1;
+    svf->a3 = g * svf->a2;
+  }
+  float v3 = signal - svf->ic2;
+  float v1 = svf->a1 * svf->ic1 + svf->a2 * v3;
+  float v2 = svf->ic2 + svf->a2 * svf->ic1 + svf->a3 * v3;
+  svf->ic1 = 2 * v1 - svf->ic1;
+  svf->ic2 = 2 * v2 - svf->ic2;
+  switch (mode) {
+  case 1:
+    return signal - svf->k * v1 - v2;
+  case 2:
+    return v1;
+  case 3:
+    return signal - svf->k * v1;
+  default:
+    return v2;
+  }
+}
+
+static float lib_svf(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  float signal = arg(args, 0, NAN);
+  float cutoff = arg(args, 1, 200);
+  float q = arg(args, 2, 1);
+  return svf_step((struct svf_context *)context, signal, cutoff, q,
+                  to_int(arg(args, 3, 0)));
+}
+
+static void lib_svf_block(struct expr_func *f, float **argv, int argc,
+                          void *context, float *out, int n) {
+  (void)f;
+  struct svf_context *svf = (struct svf_context *)context;
+  for (int i = 0; i < n; i++) {
+    out[i] = svf_step(svf, block_arg(argv, argc, 0, i, NAN),
+                      block_arg(argv, argc, 1, i, 200),
+                      block_arg(argv, argc, 2, i, 1),
+                      to_int(block_arg(argv, argc, 3, i, 0)));
+  }
+}
+
+/* Delay lines are sized by the compiler: for the longest delay time if all
+ * of them are constants, otherwise for MAX_DELAY_TIME. Longer times are
+ * clamped to the buffer */
+static int delay_alloc(struct delay_context *delay, float time) {
+  if (!(time > 0)) {
+    return 0;
+  }
+  uint32_t len = 2;
+  while (len < (uint32_t)ceilf(time * SAMPLE_RATE) + 1) {
+    len = len * 2;
+  }
+  delay->buf = calloc(len, sizeof(float));
+  delay->mask = len - 1;
+  return (delay->buf == NULL ? -1 : 0);
+}
+
+/* Range of a folded delay time: constants, oscillators, comparisons and
+ * arithmetic on them. Returns -1 if it can't be bounded */
+static int delay_range(struct expr *e, float *lo, float *hi) {
+  float a0, a1, b0, b1;
+  if (e->type == OP_CONST) {
+    *lo = *hi = e->param.num.value;
+    return isnan(*lo) ? -1 : 0;
+  } else if (e->type == OP_FUNC) {
+    exprfn_t fn = e->param.func.f->f;
+    if (fn != lib_sin && fn != lib_tri && fn != lib_saw && fn != lib_sqr &&
+        fn != lib_s) {
+      return -1;
+    }
+    *lo = -1;
+    *hi = 1;
+    return 0;
+  } else if ((e->type >= OP_LT && e->type <= OP_NE) ||
+             e->type == OP_UNARY_LOGICAL_NOT) {
+    *lo = 0;
+    *hi = 1;
+    return 0;
+  } else if (e->type == OP_UNARY_MINUS) {
+    if (delay_range(&vec_nth(&e->param.op.args, 0), &a0, &a1) < 0) {
+      return -1;
+    }
+    *lo = -a1;
+    *hi = -a0;
+    return 0;
+  } else if (e->type != OP_PLUS && e->type != OP_MINUS &&
+             e->type != OP_MULTIPLY && e->type != OP_DIVIDE) {
+    return -1;
+  }
+  if (delay_range(&vec_nth(&e->param.op.args, 0), &a0, &a1) < 0 ||
+      delay_range(&vec_nth(&e->param.op.args, 1), &b0, &b1) < 0) {
+    return -1;
+  }
+  if (e->type == OP_PLUS) {
+    *lo = a0 + b0;
+    *hi = a1 + b1;
+  } else if (e->type == OP_MINUS) {
+    *lo = a0 - b1;
+    *hi = a1 - b0;
+  } else {
+    /* Division only by a constant, otherwise the range is unbounded */
+    if (e->type == OP_DIVIDE) {
+      if (b0 != b1 || b0 == 0) {
+        return -1;
+      }
+      b0 = b1 = 1 / b0;
+    }
+    float p[4] = {a0 * b0, a0 * b1, a1 * b0, a1 * b1};
+    *lo = *hi = p[0];
+    for (int i = 1; i < 4; i++) {
+      *lo = (p[i] < *lo ? p[i] : *lo);
+      *hi = (p[i] > *hi ? p[i] : *hi);
+    }
+  }
+  return isnan(*lo) || isnan(*hi) ? -1 : 0;
+}
+
+/* Longest of the delay times found at every step-th argument from first,
+ * times that can't be bounded get the longest line */
+static float delay_max_time(vec_expr_t *args, int first, int step) {
+  float time = 0;
+  for (int i = first; i < vec_len(args); i += step) {
+    float lo, hi;
+    if (delay_range(&vec_nth(args, i), &lo, &hi) < 0) {
+      return MAX_DELAY_TIME;
+    }
+    float t = flim(hi, 0, MAX_DELAY_TIME);
+    time = (t > time ? t : time);
+  }
+  return time;
+}
+
+/* Reads the line the given time ago, linearly interpolated between frames */
+static inline float delay_read(struct delay_context *delay, uint32_t pos,
+                               float time) {
+  float frames = flim(time * SAMPLE_RATE, 1, (float)delay->mask);
+  uint32_t i = (uint32_t)frames;
+  float frac = frames - (float)i;
+  float a = delay->buf[(pos - i) & delay->mask];
+  float b = delay->buf[(pos - i - 1) & delay->mask];
+  return a + (b - a) * frac;
+}
+
+/* Feedback recirculates the delayed signal */
+static inline float delay_step(struct delay_context *delay, float signal,
+                               float time, float level, float feedback) {
+  feedback = flim(feedback, 0, 1);
+  if (!(time > 0) || delay->buf == NULL) {
+    return signal;
+  }
+  float delayed = delay_read(delay, delay->pos, time);
+  delay->buf[delay->pos] = signal + delayed * feedback;
+  delay->pos = (delay->pos + 1) & delay->mask;
+  return signal + delayed * level;
+}
+
 static float lib_delay(struct expr_func *f, vec_expr_t args, void *context) {
   (void)f;
   struct delay_context *delay = (struct delay_context *)context;
-
   float signal = arg(args, 0, NAN);
   float time = arg(args, 1, 0);
   float level = arg(args, 2, 0);
   float feedback = arg(args, 3, 0);
-  if (feedback > 1.0f)
-    feedback = 1.0f;
-  if (feedback < 0.0f)
-    feedback = 0.0f;
-  if (time <= 0) {
-    return signal;
-  }
-  if (time > MAX_DELAY_TIME) {
-    time = MAX_DELAY_TIME;
+  return delay_step(delay, signal, time, level, feedback);
+}
+
+static void lib_delay_block(struct expr_func *f, float **argv, int argc,
+                            void *context, float *out, int n) {
+  (void)f;
+  struct delay_context *delay = (struct delay_context *)context;
+  float buf[4][EXPR_BLOCK_SIZE];
+  const float *signal = block_args(argv, argc, 0, buf[0], n, NAN);
+  const float *time = block_args(argv, argc, 1, buf[1], n, 0);
+  const float *level = block_args(argv, argc, 2, buf[2], n, 0);
+  const float *feedback = block_args(argv, argc, 3, buf[3], n, 0);
+  for (int i = 0; i < n; i++) {
+    out[i] = delay_step(delay, signal[i], time[i], level[i], feedback[i]);
   }
+}
 
-  int bufsz = (int)(time * SAMPLE_RATE);
+/* Multi-tap delay: taps(voice, feedback, time, level, time, level...). All
+ * taps read one line, their sum is the wet signal that is fed back */
+static inline float taps_step(struct delay_context *delay, float signal,
+                              float feedback, float wet) {
+  delay->buf[delay->pos] = signal + wet * flim(feedback, 0, 1);
+  delay->pos = (delay->pos + 1) & delay->mask;
+  return signal + wet;
+}
 
-  /* Expand buffer if needed */
-  if (vec_len(&delay->buf) < bufsz) {
-    int sz = ((bufsz / MIN_DELAY_BLOCK) + 1) * MIN_DELAY_BLOCK;
-    int i = vec_len(&delay->buf);
-    delay->buf.len = sz;
-    delay->buf.cap = sz;
-    vec_expand(vec_unpack(&delay->buf));
-    while (i < sz) {
-      vec_nth(&delay->buf, i++) = 0;
+static float lib_taps(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  struct delay_context *delay = (struct delay_context *)context;
+  float signal = arg(args, 0, NAN);
+  float feedback = arg(args, 1, 0);
+  float wet = 0;
+  if (delay->buf == NULL) {
+    return signal;
+  }
+  for (int i = 2; i < vec_len(&args); i += 2) {
+    float time = arg(args, i, 0);
+    float level = arg(args, i + 1, 1);
+    if (time > 0) {
+      wet = wet + level * delay_read(delay, delay->pos, time);
     }
   }
+  return taps_step(delay, signal, feedback, wet);
+}
 
-  /* Get value delayed value from the buffer */
-  float out = 0;
-  if (bufsz <= vec_len(&delay->buf)) {
-    unsigned int i =
-        (delay->pos + vec_len(&delay->buf) - bufsz) % vec_len(&delay->buf);
-    out = vec_nth(&delay->buf, i) * level;
+/* Taps with constant times of at least a block read before any of the
+ * block is written, one tap at a time */
+static void lib_taps_block(struct expr_func *f, float **argv, int argc,
+                           void *context, float *out, int n) {
+  (void)f;
+  struct delay_context *delay = (struct delay_context *)context;
+  float buf[2][EXPR_BLOCK_SIZE];
+  float wet[EXPR_BLOCK_SIZE] = {0};
+  const float *signal = block_args(argv, argc, 0, buf[0], n, NAN);
+  const float *feedback = block_args(argv, argc, 1, buf[1], n, 0);
+  int spans = ((int)delay->mask >= n);
+  if (delay->buf == NULL) {
+    memcpy(out, signal, n * sizeof(float));
+    return;
+  }
+  for (int j = 2; j < argc && spans; j += 2) {
+    spans = expr_block_uniform(argv[j], n) && argv[j][0] * SAMPLE_RATE >= n &&
+            (j + 1 == argc || expr_block_uniform(argv[j + 1], n));
+  }
+  if (!spans) {
+    for (int i = 0; i < n; i++) {
+      float w = 0;
+      for (int j = 2; j < argc; j += 2) {
+        float level = (j + 1 < argc ? argv[j + 1][i] : 1);
+        if (argv[j][i] > 0) {
+          w = w + level * delay_read(delay, delay->pos, argv[j][i]);
+        }
+      }
+      out[i] = taps_step(delay, signal[i], feedback[i], w);
+    }
+    return;
+  }
+  for (int j = 2; j < argc; j += 2) {
+    float level = (j + 1 < argc ? argv[j + 1][0] : 1);
+    for (int i = 0; i < n; i++) {
+      wet[i] = wet[i] + level * delay_read(delay, delay->pos + i, argv[j][0]);
+    }
+  }
+  for (int i = 0; i < n; i++) {
+    out[i] = taps_step(delay, signal[i], feedback[i], wet[i]);
   }
-
-  /* Write updated value to the buffer */
-  vec_nth(&delay->buf, delay->pos) =
-      vec_nth(&delay->buf, delay->pos) * feedback + signal;
-  delay->pos = (delay->pos + 1) % vec_len(&delay->buf);
-  return signal + out;
 }
 
 static void lib_delay_cleanup(struct expr_func *f, void *context) {
   (void)f;
   struct delay_context *delay = (struct delay_context *)context;
-  vec_free(&delay->buf);
+  free(delay->buf);
+}
+
+/*
+ * Sample playback shared by tr808(), piano() and sample functions. Frames are
+ * read at fractional positions and interpolated as set by
+ * glitch_interpolation(). Blocks record the position of every frame first,
+ * then render the runs of frames from one source, gathering whole vectors of
+ * frames when all their taps are inside the sample.
+ */
+#define SAMPLER_TAPS 8 /* windowed sinc over frames i-3..i+4 */
+#define SAMPLER_PHASES 256
+#define SAMPLER_BETA 5.f
+#define SAMPLER_SKIP INT32_MIN /* frame written by the caller */
+
+static enum glitch_interp SAMPLER_MODE = GLITCH_INTERP_CUBIC;
+static float sampler_sinc[SAMPLER_PHASES + 1][SAMPLER_TAPS];
+
+void glitch_interpolation(enum glitch_interp mode) { SAMPLER_MODE = mode; }
+
+static float sampler_i0(float x) {
+  float sum = 1, term = 1;
+  for (int k = 1; k < 16; k++) {
+    term = term * (x / (2 * k)) * (x / (2 * k));
+    sum = sum + term;
+  }
+  return sum;
+}
+
+/* Kaiser windowed sinc, every phase is normalized to unity gain and whole
+ * frames are read exactly */
+static void sampler_init() {
+  for (int p = 0; p <= SAMPLER_PHASES; p++) {
+    float frac = (float)p / SAMPLER_PHASES, sum = 0;
+    for (int k = 0; k < SAMPLER_TAPS; k++) {
+      float x = frac + (SAMPLER_TAPS / 2 - 1) - k;
+      float r = x / (SAMPLER_TAPS / 2);
+      float w = (r * r < 1 ? sampler_i0(SAMPLER_BETA * sqrtf(1 - r * r)) /
+                                 sampler_i0(SAMPLER_BETA)
+                           : 0);
+      float h = (x == 0 ? 1 : sinf(PI * x) / (PI * x)) * w;
+      sampler_sinc[p][k] = ((p % SAMPLER_PHASES) == 0 ? x == 0 : h);
+      sum = sum + sampler_sinc[p][k];
+    }
+    for (int k = 0; k < SAMPLER_TAPS; k++) {
+      sampler_sinc[p][k] = sampler_sinc[p][k] / sum;
+    }
+  }
+}
+
+static inline float sampler_frame(const struct sampler_src *src, int i) {
+  if (i < 0 || i >= src->len) {
+    return 0;
+  }
+  return src->data16 != NULL ? src->data16[i] * (1.f / 0x8000) : src->data[i];
+}
+
+/* Catmull-Rom spline through x1 and x2 */
+static inline float sampler_cubic(float x0, float x1, float x2, float x3,
+                                  float f) {
+  float c1 = 0.5f * (x2 - x0);
+  float c2 = x0 - 2.5f * x1 + 2.f * x2 - 0.5f * x3;
+  float c3 = 0.5f * (x3 - x0) + 1.5f * (x1 - x2);
+  return ((c3 * f + c2) * f + c1) * f + x1;
+}
+
+static float sampler_read(const struct sampler_src *src, int i, float frac) {
+  if (i >= src->len) {
+    return src->end;
+  }
+  switch (SAMPLER_MODE) {
+  case GLITCH_INTERP_LINEAR: {
+    float a = sampler_frame(src, i);
+    return a + (sampler_frame(src, i + 1) - a) * frac;
+  }
+  case GLITCH_INTERP_SINC: {
+    const float *h = sampler_sinc[(int)(frac * SAMPLER_PHASES + 0.5f)];
+    float sum = 0;
+    for (int k = 0; k < SAMPLER_TAPS; k++) {
+      sum = sum + sampler_frame(src, i - (SAMPLER_TAPS / 2 - 1) + k) * h[k];
+    }
+    return sum;
+  }
+  default:
+    return sampler_cubic(sampler_frame(src, i - 1), sampler_frame(src, i),
+                         sampler_frame(src, i + 1), sampler_frame(src, i + 2),
+                         frac);
+  }
+}
+
+#ifdef SIMD_LANES
+static inline simd_f sampler_gather(const struct sampler_src *src, simd_i idx,
+                                    int offset) {
+  idx = simd_addi(idx, simd_set1i(offset));
+  if (src->data16 != NULL) {
+    return simd_mulf(simd_itof(simd_gatheri16(src->data16, idx)),
+                     simd_set1f(1.f / 0x8000));
+  }
+  return simd_gatherf(src->data, idx);
 }
 
+static inline simd_f sampler_read_simd(const struct sampler_src *src,
+                                       simd_i idx, simd_f frac) {
+  switch (SAMPLER_MODE) {
+  case GLITCH_INTERP_LINEAR: {
+    simd_f a = sampler_gather(src, idx, 0);
+    simd_f b = sampler_gather(src, idx, 1);
+    return simd_addf(a, simd_mulf(simd_subf(b, a), frac));
+  }
+  case GLITCH_INTERP_SINC: {
+    /* Row offsets of the nearest phase, the table is SAMPLER_TAPS wide */
+    simd_i row = simd_ftoit(simd_addf(
+        simd_mulf(frac, simd_set1f(SAMPLER_PHASES)), simd_set1f(0.5f)));
+    row = simd_slli(row, 3);
+    simd_f sum = simd_set1f(0);
+    for (int k = 0; k < SAMPLER_TAPS; k++) {
+      simd_f h = simd_gatherf(&sampler_sinc[0][k], row);
+      simd_f x = sampler_gather(src, idx, k - (SAMPLER_TAPS / 2 - 1));
+      sum = simd_addf(sum, simd_mulf(x, h));
+    }
+    return sum;
+  }
+  default: {
+    simd_f x0 = sampler_gather(src, idx, -1);
+    simd_f x1 = sampler_gather(src, idx, 0);
+    simd_f x2 = sampler_gather(src, idx, 1);
+    simd_f x3 = sampler_gather(src, idx, 2);
+    simd_f c1 = simd_mulf(simd_set1f(0.5f), simd_subf(x2, x0));
+    simd_f c2 = simd_subf(
+        simd_addf(simd_subf(x0, simd_mulf(simd_set1f(2.5f), x1)),
+                  simd_mulf(simd_set1f(2.f), x2)),
+        simd_mulf(simd_set1f(0.5f), x3));
+    simd_f c3 =
+        simd_addf(simd_mulf(simd_set1f(0.5f), simd_subf(x3, x0)),
+                  simd_mulf(simd_set1f(1.5f), simd_subf(x1, x2)));
+    simd_f y = simd_addf(simd_mulf(c3, frac), c2);
+    y = simd_addf(simd_mulf(y, frac), c1);
+    return simd_addf(simd_mulf(y, frac), x1);
+  }
+  }
+}
+#endif
+
+/* Renders frames at the recorded positions, skipped frames are left as is */
+static void sampler_render(const struct sampler_src *src, const int32_t *idx,
+                           const float *frac, const float *gain, float *out,
+                           int n) {
+  int i = 0;
+#ifdef SIMD_LANES
+  /* All lanes need every tap inside the sample, and one frame past it for
+   * 16-bit gathers */
+  simd_i lo = simd_set1i(SAMPLER_TAPS / 2 - 2);
+  simd_i hi = simd_set1i(src->len - SAMPLER_TAPS / 2 - 1);
+  for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+    simd_i vi = simd_loadi(idx + i);
+    simd_f inside = simd_castif(simd_andi(simd_gti(vi, lo), simd_gti(hi, vi)));
+    if (simd_movemaskf(inside) != (1 << SIMD_LANES) - 1) {
+      for (int j = i; j < i + SIMD_LANES; j++) {
+        if (idx[j] != SAMPLER_SKIP) {
+          out[j] = sampler_read(src, idx[j], frac[j]) * gain[j];
+        }
+      }
+      continue;
+    }
+    simd_f v = sampler_read_simd(src, vi, simd_loadf(frac + i));
+    simd_storef(out + i, simd_mulf(v, simd_loadf(gain + i)));
+  }
+#endif
+  for (; i < n; i++) {
+    if (idx[i] != SAMPLER_SKIP) {
+      out[i] = sampler_read(src, idx[i], frac[i]) * gain[i];
+    }
+  }
+}
+
+/* Step through frames recorded at the given rate for one engine frame */
+static float sampler_ratio(int rate) {
+  return rate > 0 && rate != SAMPLE_RATE ? (float)rate / SAMPLE_RATE : 1.f;
+}
+
+/* Reads the frame at the current position and steps past it */
+static float sampler_step(struct sample_context *sample) {
+  if (sample->t >= sample->src.len) {
+    return sample->src.end;
+  }
+  int i = (int)sample->t;
+  float x = sampler_read(&sample->src, i, (float)(sample->t - i));
+  sample->t = sample->t + sample->step;
+  return x;
+}
+
+/* Frames of a block, recorded until the source changes */
+struct sampler_run {
+  struct sampler_src src;
+  int start;
+  int32_t idx[EXPR_BLOCK_SIZE];
+  float frac[EXPR_BLOCK_SIZE];
+  float gain[EXPR_BLOCK_SIZE];
+};
+
+static void sampler_flush(struct sampler_run *run, float *out, int end) {
+  sampler_render(&run->src, run->idx + run->start, run->frac + run->start,
+                 run->gain + run->start, out + run->start, end - run->start);
+  run->start = end;
+}
+
+/* Records frame i: played at the current position with the given gain, or
+ * written as v if play is 0 */
+static void sampler_record(struct sample_context *sample,
+                           struct sampler_run *run, int play, float v,
+                           float *out, int i) {
+  if (!play) {
+    run->idx[i] = SAMPLER_SKIP;
+    out[i] = v;
+    return;
+  }
+  if (sample->src.data != run->src.data ||
+      sample->src.data16 != run->src.data16) {
+    sampler_flush(run, out, i);
+    run->src = sample->src;
+  }
+  run->gain[i] = v;
+  if (sample->t >= sample->src.len) {
+    run->idx[i] = sample->src.len;
+    run->frac[i] = 0;
+  } else {
+    run->idx[i] = (int32_t)sample->t;
+    run->frac[i] = (float)(sample->t - run->idx[i]);
+    sample->t = sample->t + sample->step;
+  }
+}
+
+/* Embedded WAV files, decoded once into cache-aligned floats */
+#define BANK_ALIGN 64
+#define TR808_DRUMS 9
+#define PIANO_NOTES 3
+
+static struct sampler_src tr808_bank[TR808_DRUMS];
+static struct sampler_src piano_bank[PIANO_NOTES];
+static const float piano_base_freq[PIANO_NOTES] = {65.41f, 261.63f, 1046.50f};
+
 static float int16_sample(unsigned char hi, unsigned char lo) {
   int sign = hi & (1 << 7);
   int v = (((int)(hi)&0x7f) << 8) | (int)lo;
@@ -697,186 +1757,407 @@ static float int16_sample(unsigned char hi, unsigned char lo) {
   return v * 1.f / 0x8000;
 }
 
-static float lib_tr808(struct expr_func *f, vec_expr_t args, void *context) {
-  (void)f;
-  struct sample_context *sample = (struct sample_context *)context;
-
-  float drum = arg(args, 0, NAN);
-  float vol = arg(args, 1, 1);
-  float shift = arg(args, 2, 0);
-
-  if (isnan(drum) || isnan(vol) || isnan(shift)) {
-    sample->t = 0;
-    return NAN;
+/* Finds the rate and the data chunk of a mono 16-bit WAV file, a broken file
+ * stays empty */
+static int bank_decode(struct sampler_src *s, const unsigned char *wav,
+                       unsigned int len) {
+  if (len < 12 || memcmp(wav, "RIFF", 4) != 0 ||
+      memcmp(wav + 8, "WAVE", 4) != 0) {
+    return 0;
   }
+  for (unsigned int off = 12; off + 8 <= len;) {
+    const unsigned char *h = wav + off;
+    uint32_t size = (uint32_t)h[4] | (uint32_t)h[5] << 8 |
+                    (uint32_t)h[6] << 16 | (uint32_t)h[7] << 24;
+    off = off + 8;
+    if (memcmp(h, "fmt ", 4) == 0 && size >= 8 && size <= len - off) {
+      s->rate = (int)((uint32_t)h[12] | (uint32_t)h[13] << 8 |
+                      (uint32_t)h[14] << 16 | (uint32_t)h[15] << 24);
+    }
+    if (memcmp(h, "data", 4) == 0) {
+      int n = (int)(MIN(size, len - off) / 2);
+      char *mem = malloc(n * sizeof(float) + BANK_ALIGN);
+      if (mem == NULL) {
+        return -1;
+      }
+      float *data = (float *)(((size_t)mem + BANK_ALIGN - 1) &
+                              ~(size_t)(BANK_ALIGN - 1));
+      for (int i = 0; i < n; i++) {
+        data[i] = int16_sample(wav[off + i * 2 + 1], wav[off + i * 2]);
+      }
+      s->data = data;
+      s->len = n;
+      return 0;
+    } else if (size > len - off) {
+      break;
+    }
+    off = off + size + (size & 1);
+  }
+  return 0;
+}
 
-  static unsigned char *samples[] = {
+/* Banks and the sinc table live as long as the process */
+static int bank_init() {
+  static int init = 0;
+  static const unsigned char *tr808[TR808_DRUMS] = {
       tr808_bd_wav, tr808_sn_wav, tr808_mt_wav, tr808_mc_wav, tr808_rs_wav,
       tr808_cl_wav, tr808_cb_wav, tr808_oh_wav, tr808_hh_wav,
   };
-  static unsigned int len[] = {
+  static const unsigned int tr808_len[TR808_DRUMS] = {
       tr808_bd_wav_len, tr808_sn_wav_len, tr808_mt_wav_len,
       tr808_mc_wav_len, tr808_rs_wav_len, tr808_cl_wav_len,
       tr808_cb_wav_len, tr808_oh_wav_len, tr808_hh_wav_len,
   };
-  static int N = sizeof(samples) / sizeof(*samples);
-
-  int index = (((int)drum % N) + N) % N;
-  unsigned char *pcm = samples[index];
-  if (sample->t * 2 + 0x80 + 1 < len[index]) {
-    unsigned char hi = pcm[0x80 + (int)sample->t * 2 + 1];
-    unsigned char lo = pcm[0x80 + (int)sample->t * 2];
-    float x = int16_sample(hi, lo);
-    sample->t = sample->t + POW2(shift / 12.0);
-    return x * vol;
+  static const unsigned char *piano[PIANO_NOTES] = {
+      samples_piano_pianoc2_wav,
+      samples_piano_pianoc4_wav,
+      samples_piano_pianoc6_wav,
+  };
+  static const unsigned int piano_len[PIANO_NOTES] = {
+      samples_piano_pianoc2_wav_len,
+      samples_piano_pianoc4_wav_len,
+      samples_piano_pianoc6_wav_len,
+  };
+  if (init) {
+    return 0;
+  }
+  for (int i = 0; i < TR808_DRUMS; i++) {
+    if (bank_decode(&tr808_bank[i], tr808[i], tr808_len[i]) < 0) {
+      return -1;
+    }
+  }
+  for (int i = 0; i < PIANO_NOTES; i++) {
+    if (bank_decode(&piano_bank[i], piano[i], piano_len[i]) < 0) {
+      return -1;
+    }
   }
+  sampler_init();
+  init = 1;
   return 0;
 }
 
-static float lib_piano(struct expr_func *f, vec_expr_t args, void *context) {
+/* Returns 1 if the frame plays at the given gain, otherwise the frame is v */
+static int tr808_prepare(struct sample_context *sample, float drum, float vol,
+                         float shift, float *v) {
+  if (isnan(drum) || isnan(vol) || isnan(shift)) {
+    sample->t = 0;
+    sample->init = sample->tuned = 0;
+    *v = NAN;
+    return 0;
+  }
+  if (!sample->init || (int)drum != sample->variant) {
+    sample->variant = (int)drum;
+    sample->src = tr808_bank[((sample->variant % TR808_DRUMS) + TR808_DRUMS) %
+                             TR808_DRUMS];
+    sample->init = 1;
+    sample->tuned = 0;
+  }
+  if (!sample->tuned || shift != sample->pitch) {
+    sample->pitch = shift;
+    sample->step = POW2(shift / 12.0) * sampler_ratio(sample->src.rate);
+    sample->tuned = 1;
+  }
+  *v = vol;
+  return 1;
+}
+
+static float lib_tr808(struct expr_func *f, vec_expr_t args, void *context) {
   (void)f;
   struct sample_context *sample = (struct sample_context *)context;
+  float v;
+  if (!tr808_prepare(sample, arg(args, 0, NAN), arg(args, 1, 1),
+                     arg(args, 2, 0), &v)) {
+    return v;
+  }
+  return sampler_step(sample) * v;
+}
 
-  float freq = arg(args, 0, NAN);
+static void lib_tr808_block(struct expr_func *f, float **argv, int argc,
+                            void *context, float *out, int n) {
+  (void)f;
+  struct sample_context *sample = (struct sample_context *)context;
+  struct sampler_run run;
+  run.src = sample->src;
+  run.start = 0;
+  for (int i = 0; i < n; i++) {
+    float v;
+    int play = tr808_prepare(sample, block_arg(argv, argc, 0, i, NAN),
+                             block_arg(argv, argc, 1, i, 1),
+                             block_arg(argv, argc, 2, i, 0), &v);
+    sampler_record(sample, &run, play, v, out, i);
+  }
+  sampler_flush(&run, out, n);
+}
+
+static int piano_prepare(struct sample_context *sample, float freq, float *v) {
   if (isnan(freq)) {
     sample->t = 0;
-    return NAN;
+    sample->tuned = 0;
+    *v = NAN;
+    return 0;
   }
   if (freq == 0) {
+    *v = 0;
     return 0;
   } else if (freq < 0) {
     freq = -freq;
   }
+  /* 0 = C0..C3, 1 = C3..C5, 2 = C5..C8, pitched by the ratio of frequencies */
+  if (!sample->tuned || freq != sample->pitch) {
+    int index = (freq < 130.f ? 0 : (freq < 523.f ? 1 : 2));
+    sample->pitch = freq;
+    sample->src = piano_bank[index];
+    sample->step =
+        freq / piano_base_freq[index] * sampler_ratio(sample->src.rate);
+    sample->tuned = 1;
+  }
+  *v = 1;
+  return 1;
+}
 
-  static unsigned char *samples[] = {
-      samples_piano_pianoc2_wav, samples_piano_pianoc4_wav,
-      samples_piano_pianoc6_wav,
-  };
-  static unsigned int len[] = {
-      samples_piano_pianoc2_wav_len, samples_piano_pianoc4_wav_len,
-      samples_piano_pianoc6_wav_len,
-  };
+static float lib_piano(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  struct sample_context *sample = (struct sample_context *)context;
+  float v;
+  if (!piano_prepare(sample, arg(args, 0, NAN), &v)) {
+    return v;
+  }
+  return sampler_step(sample);
+}
 
-  /* 0 = C0..C3, 1 = C3..C5, 2 = C5..C8 */
-  int index = (freq < 130.f ? 0 : (freq < 523.f ? 1 : 2));
-  float note = 12.f * LOG2(freq / 440.f);
-  float base_freq =
-      (freq < 130.f ? 65.41f : (freq < 523.f ? 261.63f : 1046.50f));
-  float base_note = 12.f * LOG2(base_freq / 440.f);
-  float shift = (note - base_note);
-  unsigned char *pcm = samples[index];
-  if (sample->t * 2 + 0x80 + 1 < len[index]) {
-    unsigned char hi = pcm[0x80 + (int)sample->t * 2 + 1];
-    unsigned char lo = pcm[0x80 + (int)sample->t * 2];
-    float x = int16_sample(hi, lo);
-    sample->t = sample->t + POW2(shift / 12.0);
-    return x;
+static void lib_piano_block(struct expr_func *f, float **argv, int argc,
+                            void *context, float *out, int n) {
+  (void)f;
+  struct sample_context *sample = (struct sample_context *)context;
+  struct sampler_run run;
+  run.src = sample->src;
+  run.start = 0;
+  for (int i = 0; i < n; i++) {
+    float v;
+    int play = piano_prepare(sample, block_arg(argv, argc, 0, i, NAN), &v);
+    sampler_record(sample, &run, play, v, out, i);
   }
-  return 0;
+  sampler_flush(&run, out, n);
 }
 
-static float lib_sample(struct expr_func *f, vec_expr_t args, void *context) {
+/* Asks the loader for a variant only when it differs from the resolved one */
+static void sample_resolve(struct expr_func *f, struct sample_context *sample,
+                           int variant) {
+  if (!sample->init || sample->variant != variant) {
+    sample->sample = loader(f->name, variant);
+    sample->variant = variant;
+    sample->init = 1;
+    sample->tuned = 0;
+  }
+}
+
+static int sample_prepare(struct expr_func *f, struct sample_context *sample,
+                          float variant, float vol, float shift, float *v) {
   if (loader == NULL) {
-    return NAN;
+    *v = NAN;
+    return 0;
+  } else if (isnan(variant) || isnan(vol) || isnan(shift)) {
+    sample->t = 0;
+    *v = NAN;
+    return 0;
+  }
+  sample_resolve(f, sample, (int)variant);
+  const struct glitch_sample *s = sample->sample;
+  if (s == NULL) {
+    *v = NAN;
+    return 0;
+  } else if (!sample->tuned && !ATOMIC_LOAD(&s->ready)) {
+    *v = 0;
+    return 0;
+  }
+  /* Frames at another rate are stepped through at theirs */
+  if (!sample->tuned || shift != sample->pitch) {
+    sample->pitch = shift;
+    sample->step = POW2(shift / 12.0) * sampler_ratio(s->rate);
+    sample->src.data = NULL;
+    sample->src.data16 = s->data;
+    sample->src.len = (int)MIN(s->len, (size_t)INT32_MAX - SAMPLER_TAPS);
+    sample->src.rate = s->rate;
+    sample->src.end = NAN;
+    sample->tuned = 1;
+  }
+  *v = vol;
+  return 1;
+}
+
+static float lib_sample(struct expr_func *f, vec_expr_t args, void *context) {
+  struct sample_context *sample = (struct sample_context *)context;
+  float v;
+  if (!sample_prepare(f, sample, arg(args, 0, NAN), arg(args, 1, 1),
+                      arg(args, 2, 0), &v)) {
+    return v;
   }
+  return sampler_step(sample) * v;
+}
+
+static void lib_sample_block(struct expr_func *f, float **argv, int argc,
+                             void *context, float *out, int n) {
   struct sample_context *sample = (struct sample_context *)context;
-  float variant = arg(args, 0, NAN);
-  float vol = arg(args, 1, 1);
-  float shift = arg(args, 2, 0);
-  if (isnan(variant) || isnan(vol) || isnan(shift)) {
-    sample->t = 0;
-    return NAN;
+  struct sampler_run run;
+  run.src = sample->src;
+  run.start = 0;
+  for (int i = 0; i < n; i++) {
+    float v;
+    int play = sample_prepare(f, sample, block_arg(argv, argc, 0, i, NAN),
+                              block_arg(argv, argc, 1, i, 1),
+                              block_arg(argv, argc, 2, i, 0), &v);
+    sampler_record(sample, &run, play, v, out, i);
   }
-  sample->t = sample->t + POW2(shift / 12.0);
-  return loader(f->name, (int)variant, (int)(sample->t)) * vol;
+  sampler_flush(&run, out, n);
 }
 
-static float lib_pluck(struct expr_func *f, vec_expr_t args, void *context) {
-  (void)f;
-  struct pluck_context *pluck = (struct pluck_context *)context;
-  float freq = arg(args, 0, NAN);
-  float decay = arg(args, 1, 0.5);
+/* Karplus-Strong string. The line is sized by the compiler for the pitch if
+ * it is a constant, otherwise for MIN_PLUCK_FREQ */
+static int pluck_alloc(struct pluck_context *pluck, vec_expr_t *args,
+                       uint32_t seed) {
+  float freq = MIN_PLUCK_FREQ;
+  if (vec_len(args) > 0 && vec_nth(args, 0).type == OP_CONST) {
+    freq = fabsf(vec_nth(args, 0).param.num.value);
+    freq = (freq > MIN_PLUCK_FREQ ? freq : MIN_PLUCK_FREQ);
+  }
+  uint32_t len = 4;
+  while (len < (uint32_t)ceilf(SAMPLE_RATE / freq) + 4) {
+    len = len * 2;
+  }
+  pluck->buf = calloc(len, sizeof(float));
+  pluck->mask = len - 1;
+  pluck->seed = seed;
+  return (pluck->buf == NULL ? -1 : 0);
+}
 
+static inline float pluck_noise(struct pluck_context *pluck) {
+  uint32_t x = pluck->seed; /* xorshift32 */
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  pluck->seed = x;
+  return (float)(int32_t)x / 2147483648.f;
+}
+
+/* Interpolated line value the given number of frames ago */
+static inline float pluck_read(struct pluck_context *pluck, uint32_t i,
+                               float frac) {
+  float a = pluck->buf[(pluck->pos - i) & pluck->mask];
+  float b = pluck->buf[(pluck->pos - i - 1) & pluck->mask];
+  return a + (b - a) * frac;
+}
+
+/* A trigger writes one period of excitation into the line as it plays, one
+ * frame at a time, then the line feeds back through the decay filter. The
+ * filter delays the loop by 1-decay frames, so the line is shortened by as
+ * much to keep the pitch. NAN excitation is white noise */
+static inline float pluck_step(struct pluck_context *pluck, float freq,
+                               float decay, float excitation) {
   if (isnan(freq)) {
     pluck->init = 0;
     return NAN;
-  } else if (freq == 0) {
+  } else if (freq == 0 || pluck->buf == NULL) {
     return 0;
-  } else if (freq < 0) {
-    freq = -freq;
   }
-
-  int n = (int)(SAMPLE_RATE / freq);
-  if (n == 0) {
-    return 0;
+  float period = flim(SAMPLE_RATE / fabsf(freq) - (1 - decay), 1,
+                      (float)(pluck->mask - 2));
+  uint32_t i = (uint32_t)period;
+  float frac = period - (float)i;
+  float v;
+  if (!pluck->init) {
+    pluck->init = 1;
+    pluck->fill = i + 2;
+  }
+  if (pluck->fill > 0) {
+    pluck->fill--;
+    v = (isnan(excitation) ? pluck_noise(pluck) : excitation);
+  } else {
+    v = decay * pluck_read(pluck, i, frac) +
+        (1 - decay) * pluck_read(pluck, i + 1, frac);
   }
+  pluck->buf[pluck->pos] = v;
+  pluck->pos = (pluck->pos + 1) & pluck->mask;
+  return v;
+}
 
-  if (pluck->init == 0) {
-    if (pluck->sample == NULL) {
-      pluck->sample = (float *)malloc(sizeof(float) * SAMPLE_RATE);
-    }
-    for (int i = 0; i < n; i++) {
-      if (vec_len(&args) >= 3) {
-        pluck->sample[i] = expr_eval(&vec_nth(&args, 2));
-      } else {
-        pluck->sample[i] = (rand() * 2.0f / RAND_MAX) - 1.0f;
-      }
-    }
-    pluck->init = 1;
-    pluck->t = 0;
+static float lib_pluck(struct expr_func *f, vec_expr_t args, void *context) {
+  (void)f;
+  float freq = arg(args, 0, NAN);
+  float decay = arg(args, 1, 0.5);
+  float excitation = arg(args, 2, NAN);
+  return pluck_step((struct pluck_context *)context, freq, decay, excitation);
+}
+
+static void lib_pluck_block(struct expr_func *f, float **argv, int argc,
+                            void *context, float *out, int n) {
+  (void)f;
+  struct pluck_context *pluck = (struct pluck_context *)context;
+  float buf[3][EXPR_BLOCK_SIZE];
+  const float *freq = block_args(argv, argc, 0, buf[0], n, NAN);
+  const float *decay = block_args(argv, argc, 1, buf[1], n, 0.5);
+  const float *excitation = block_args(argv, argc, 2, buf[2], n, NAN);
+  for (int i = 0; i < n; i++) {
+    out[i] = pluck_step(pluck, freq[i], decay[i], excitation[i]);
   }
-  float x = pluck->sample[pluck->t % n];
-  float y = pluck->sample[(pluck->t + 1) % n];
-  pluck->t = (pluck->t + 1) % n;
-  pluck->sample[pluck->t] = x * decay + y * (1 - decay);
-  return x;
 }
 
 static void lib_pluck_cleanup(struct expr_func *f, void *context) {
   (void)f;
   struct pluck_context *pluck = (struct pluck_context *)context;
-  free(pluck->sample);
+  free(pluck->buf);
 }
 
-#define MAX_FUNCS 1024
-static struct expr_func glitch_funcs[MAX_FUNCS + 1] = {
-    {"byte", lib_byte, NULL, 0},
-    {"s", lib_s, NULL, 0},
-    {"r", lib_r, NULL, 0},
-    {"l", lib_l, NULL, 0},
+static struct expr_func glitch_funcs[] = {
+    {"byte", lib_byte, NULL, 0, lib_byte_block, EXPR_FUNC_PURE},
+    {"s", lib_s, NULL, 0, lib_s_block, EXPR_FUNC_PURE},
+    {"r", lib_r, NULL, 0, lib_r_block},
+    {"l", lib_l, NULL, 0, lib_l_block, EXPR_FUNC_PURE},
     {"a", lib_a, NULL, 0},
-    {"scale", lib_scale, NULL, 0},
-    {"hz", lib_hz, NULL, 0},
-
-    {"each", lib_each, lib_each_cleanup, sizeof(struct each_context)},
-
-    {"sin", lib_osc, NULL, sizeof(struct osc_context)},
-    {"tri", lib_osc, NULL, sizeof(struct osc_context)},
-    {"saw", lib_osc, NULL, sizeof(struct osc_context)},
-    {"sqr", lib_osc, NULL, sizeof(struct osc_context)},
-    {"fm", lib_fm, NULL, sizeof(struct fm_context)},
-    {"pluck", lib_pluck, lib_pluck_cleanup, sizeof(struct pluck_context)},
-    {"tr808", lib_tr808, NULL, sizeof(struct sample_context)},
-    {"piano", lib_piano, NULL, sizeof(struct sample_context)},
+    {"scale", lib_scale, NULL, 0, lib_scale_block, EXPR_FUNC_PURE},
+    {"hz", lib_hz, NULL, 0, lib_hz_block, EXPR_FUNC_PURE},
+
+    {"each", lib_each, lib_each_cleanup, sizeof(struct each_context), NULL,
+     EXPR_FUNC_ASSIGNS, lib_each_trees},
+
+    {"sin", lib_sin, NULL, sizeof(struct osc_context), lib_sin_block},
+    {"tri", lib_tri, NULL, sizeof(struct osc_context), lib_tri_block},
+    {"saw", lib_saw, NULL, sizeof(struct osc_context), lib_saw_block},
+    {"sqr", lib_sqr, NULL, sizeof(struct osc_context), lib_sqr_block},
+    {"fm", lib_fm, NULL, sizeof(struct fm_context), lib_fm_block},
+    {"pluck", lib_pluck, lib_pluck_cleanup, sizeof(struct pluck_context),
+     lib_pluck_block},
+    {"tr808", lib_tr808, NULL, sizeof(struct sample_context), lib_tr808_block},
+    {"piano", lib_piano, NULL, sizeof(struct sample_context), lib_piano_block},
 
     {"loop", lib_seq, lib_seq_cleanup, sizeof(struct seq_context)},
     {"seq", lib_seq, lib_seq_cleanup, sizeof(struct seq_context)},
 
     {"env", lib_env, NULL, sizeof(struct env_context)},
 
-    {"mix", lib_mix, lib_mix_cleanup, sizeof(struct mix_context)},
+    {"mix", lib_mix, lib_mix_cleanup, sizeof(struct mix_context),
+     lib_mix_block},
 
-    {"lpf", lib_filter, NULL, sizeof(struct filter_context)},
-    {"hpf", lib_filter, NULL, sizeof(struct filter_context)},
-    {"bpf", lib_filter, NULL, sizeof(struct filter_context)},
-    {"bsf", lib_filter, NULL, sizeof(struct filter_context)},
+    {"lpf", lib_lpf, NULL, sizeof(struct filter_context), lib_lpf_block},
+    {"hpf", lib_hpf, NULL, sizeof(struct filter_context), lib_hpf_block},
+    {"bpf", lib_bpf, NULL, sizeof(struct filter_context), lib_bpf_block},
+    {"bsf", lib_bsf, NULL, sizeof(struct filter_context), lib_bsf_block},
+    {"svf", lib_svf, NULL, sizeof(struct svf_context), lib_svf_block},
 
-    {"delay", lib_delay, lib_delay_cleanup, sizeof(struct delay_context)},
+    {"delay", lib_delay, lib_delay_cleanup, sizeof(struct delay_context),
+     lib_delay_block},
+    {"taps", lib_taps, lib_delay_cleanup, sizeof(struct delay_context),
+     lib_taps_block},
     {NULL, NULL, 0},
 };
 
 struct glitch *glitch_create() {
+  if (bank_init() < 0) {
+    return NULL;
+  }
   struct glitch *g = calloc(1, sizeof(struct glitch));
+  if (g != NULL) {
+    g->xy = GLITCH_XY_NONE;
+  }
   return g;
 }
 
@@ -884,39 +2165,89 @@ void glitch_sample_rate(int rate) { SAMPLE_RATE = rate; }
 
 void glitch_set_loader(glitch_loader_fn fn) { loader = fn; }
 
+/* Built-in functions first, so that samples can not shadow them */
+static struct expr_func_list *glitch_func_list() {
+  static struct expr_func_list funcs = {NULL, NULL, 0, 0};
+  if (funcs.len == 0 && expr_func_add_all(&funcs, glitch_funcs) == -1) {
+    return NULL;
+  }
+  return &funcs;
+}
+
 int glitch_add_sample_func(const char *name) {
-  for (int i = 0; i < MAX_FUNCS; i++) {
-    if (glitch_funcs[i].name == NULL) {
-      glitch_funcs[i].name = name;
-      glitch_funcs[i].f = lib_sample;
-      glitch_funcs[i].ctxsz = sizeof(struct sample_context);
-      glitch_funcs[i + 1].name = NULL;
-      return 0;
+  struct expr_func_list *funcs = glitch_func_list();
+  if (funcs == NULL || expr_func(funcs, name, strlen(name)) != NULL) {
+    return -1;
+  }
+  struct expr_func *f = calloc(1, sizeof(struct expr_func));
+  if (f == NULL) {
+    return -1;
+  }
+  f->name = name;
+  f->f = lib_sample;
+  f->ctxsz = sizeof(struct sample_context);
+  f->block = lib_sample_block;
+  if (expr_func_add(funcs, f) == -1) {
+    free(f);
+    return -1;
+  }
+  return 0;
+}
+
+static void glitch_script_destroy(struct glitch_script *s) {
+  if (s != NULL) {
+    expr_prog_destroy(s->prog);
+    expr_block_destroy(s->block);
+    expr_arena_destroy(&s->arena, s->e);
+    vec_free(&s->samples);
+    free(s);
+  }
+}
+
+/* Destroys a script that the audio thread no longer uses */
+static void glitch_script_release(struct glitch *g, struct glitch_script *s) {
+  for (int i = 0; i < vec_len(&g->scripts); i++) {
+    if (vec_nth(&g->scripts, i) == s) {
+      vec_nth(&g->scripts, i) = vec_peek(&g->scripts);
+      (void)vec_pop(&g->scripts);
+      break;
     }
   }
-  return -1;
+  glitch_script_destroy(s);
 }
 
 void glitch_destroy(struct glitch *g) {
-  expr_destroy(g->e, &g->vars);
+  glitch_reclaim(g);
+  glitch_script_destroy(g->next);
+  glitch_script_destroy(g->pending);
+  glitch_script_destroy(g->script);
+  vec_free(&g->scripts);
+  expr_var_free(&g->vars);
   free(g);
 }
 
-void glitch_xy(struct glitch *g, float x, float y) {
-  g->x->value = x;
-  g->y->value = y;
+/* Releases the scripts retired by the audio thread, never call it from there */
+void glitch_reclaim(struct glitch *g) {
+  unsigned int head = ATOMIC_LOAD(&g->retired_head);
+  unsigned int tail = g->retired_tail;
+  while (tail != head) {
+    glitch_script_release(g, g->retired[tail % MAX_RETIRED]);
+    tail++;
+    ATOMIC_STORE(&g->retired_tail, tail);
+  }
 }
 
-void glitch_midi(struct glitch *g, unsigned char cmd, unsigned char a,
-                 unsigned char b) {
-  cmd = cmd >> 4;
+/* Applied by the audio thread, see glitch_midi_at() */
+static void glitch_midi_event(struct glitch *g,
+                              const struct glitch_midi_event *ev) {
+  unsigned char cmd = ev->cmd >> 4, a = ev->a, b = ev->b;
   if (cmd == 0x9 && b > 0) {
     // Note pressed: insert to the head of the "list"
     for (int i = 0; i < MAX_POLYPHONY; i++) {
-      if (isnan(g->k[i]->value)) {
-        g->k[i]->value = a - 69;
-        g->g[i]->value = b / 128.0;
-        g->v[i]->value = b / 128.0;
+      if (isnan(*g->k[i]->value)) {
+        *g->k[i]->value = a - 69;
+        *g->g[i]->value = b / 128.0;
+        *g->v[i]->value = b / 128.0;
         break;
       }
     }
@@ -924,20 +2255,181 @@ void glitch_midi(struct glitch *g, unsigned char cmd, unsigned char a,
     // Note released: remove from the "list" and shift the rest
     float key = a - 69;
     for (int i = 0; i < MAX_POLYPHONY; i++) {
-      if (g->k[i]->value == key) {
-        g->g[i]->value = NAN;
+      if (*g->k[i]->value == key) {
+        *g->g[i]->value = NAN;
         break;
       }
     }
   } else if (cmd == 0xe) {
     // Pitch bend wheel
-    g->x->value = (b - 64.f) / 65.f;
+    *g->x->value = (b - 64.f) / 65.f;
   } else if (cmd == 0xb && a == 1) {
     // Control change message: mod wheel
-    g->y->value = (b - 64.f) / 65.f;
-  } else {
-    fprintf(stderr, "MIDI command %d %d %d\n", cmd, a, b);
+    *g->y->value = (b - 64.f) / 65.f;
+  }
+}
+
+static int glitch_midi_queue(struct glitch *g, long frame,
+                             struct glitch_midi_event ev) {
+  unsigned int head = g->midi_head;
+  if (head - ATOMIC_LOAD(&g->midi_tail) == MAX_MIDI_EVENTS) {
+    return -1;
+  }
+  /* Events are kept in order, so that the audio thread only looks at the
+   * oldest one */
+  if (frame < g->midi_frame) {
+    frame = g->midi_frame;
+  }
+  ev.frame = g->midi_frame = frame;
+  g->midi[head % MAX_MIDI_EVENTS] = ev;
+  ATOMIC_STORE(&g->midi_head, head + 1);
+  return 0;
+}
+
+/* Queues a MIDI message for the audio thread, returns -1 if the queue is full.
+ * Frames in the past are applied at the beginning of the next block, messages
+ * glitch doesn't handle are dropped here rather than on the audio thread */
+int glitch_midi_at(struct glitch *g, long frame, unsigned char cmd,
+                   unsigned char a, unsigned char b) {
+  unsigned char type = cmd >> 4;
+  if (type != 0x8 && type != 0x9 && type != 0xe && !(type == 0xb && a == 1)) {
+    fprintf(stderr, "MIDI command %d %d %d\n", type, a, b);
+    return 0;
+  }
+  struct glitch_midi_event ev = {0, cmd, a, b};
+  return glitch_midi_queue(g, frame, ev);
+}
+
+int glitch_midi(struct glitch *g, unsigned char cmd, unsigned char a,
+                unsigned char b) {
+  return glitch_midi_at(g, 0, cmd, a, b);
+}
+
+/* Only the latest position matters, so it replaces one that hasn't been
+ * applied yet instead of queueing */
+void glitch_xy(struct glitch *g, float x, float y) {
+  uint32_t bx, by;
+  memcpy(&bx, &x, sizeof(bx));
+  memcpy(&by, &y, sizeof(by));
+  ATOMIC_STORE(&g->xy, (uint64_t)bx << 32 | by);
+}
+
+/* Applies the latest x and y and queued MIDI events that are due at the
+ * current frame, returns the number of frames until the next one, at most max */
+static int glitch_midi_apply(struct glitch *g, int max) {
+  if (ATOMIC_LOAD(&g->xy) != GLITCH_XY_NONE) {
+    uint64_t xy = ATOMIC_EXCHANGE(&g->xy, GLITCH_XY_NONE);
+    uint32_t bx = (uint32_t)(xy >> 32), by = (uint32_t)xy;
+    memcpy(g->x->value, &bx, sizeof(bx));
+    memcpy(g->y->value, &by, sizeof(by));
+  }
+  unsigned int head = ATOMIC_LOAD(&g->midi_head);
+  while (g->midi_tail != head) {
+    struct glitch_midi_event *ev = &g->midi[g->midi_tail % MAX_MIDI_EVENTS];
+    if (ev->frame > g->frame) {
+      return (int)MIN(ev->frame - g->frame, max);
+    }
+    glitch_midi_event(g, ev);
+    ATOMIC_STORE(&g->midi_tail, g->midi_tail + 1);
+  }
+  return max;
+}
+
+static int sample_add(struct glitch_script *script,
+                      const struct glitch_sample *sample) {
+  for (int i = 0; i < vec_len(&script->samples); i++) {
+    if (vec_nth(&script->samples, i) == sample) {
+      return 0;
+    }
+  }
+  return vec_push(&script->samples, sample);
+}
+
+/* Resolves the variants a sample function may play, a constant one or all of
+ * them, so that the loader can fetch them before the script starts */
+static int sample_prefetch(struct glitch_script *script, struct expr *e) {
+  vec_expr_t *args = &e->param.func.args;
+  struct sample_context *sample = e->param.func.context;
+  const struct glitch_sample *s;
+  if (vec_len(args) == 0) {
+    return 0;
+  } else if (vec_nth(args, 0).type == OP_CONST) {
+    float variant = vec_nth(args, 0).param.num.value;
+    if (isnan(variant)) {
+      return 0;
+    }
+    sample_resolve(e->param.func.f, sample, (int)variant);
+    return sample->sample == NULL ? 0 : sample_add(script, sample->sample);
+  }
+  for (int i = 0; (s = loader(e->param.func.f->name, i)) != NULL; i++) {
+    if (sample_add(script, s) < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/* Allocates what functions need for rendering, so that the audio thread
+ * never has to */
+static int glitch_prepare(struct glitch_script *script, struct expr *e,
+                          int *count) {
+  vec_expr_t *args = &e->param.op.args;
+  if (e->type == OP_CONST || e->type == OP_VAR) {
+    return 0;
+  } else if (e->type == OP_FUNC) {
+    args = &e->param.func.args;
+    /* Strings get different noise, the same in every compilation */
+    if (e->param.func.f->f == lib_pluck &&
+        pluck_alloc(e->param.func.context, args,
+                    0x9e3779b9u * (uint32_t)++*count) < 0) {
+      return -1;
+    }
+    if (e->param.func.f->f == lib_sample && loader != NULL &&
+        sample_prefetch(script, e) < 0) {
+      return -1;
+    }
+    /* each() plays clones of its body, the body itself is never evaluated */
+    if (e->param.func.f->f == lib_each && vec_len(args) >= 3) {
+      struct each_context *each = e->param.func.context;
+      if (!each->init && each_init(each, args) < 0) {
+        return -1;
+      }
+      for (int i = 0; i < vec_len(&each->args); i++) {
+        if (glitch_prepare(script, &vec_nth(&each->args, i), count) < 0) {
+          return -1;
+        }
+      }
+      for (int i = 0; i < vec_len(args); i++) {
+        if (i != 1 && glitch_prepare(script, &vec_nth(args, i), count) < 0) {
+          return -1;
+        }
+      }
+      return 0;
+    }
+    if (e->param.func.f->f == lib_seq && vec_len(args) >= 2 &&
+        seq_init(e->param.func.context, args) < 0) {
+      return -1;
+    }
+    if (e->param.func.f->f == lib_mix &&
+        mix_init(e->param.func.context, vec_len(args)) < 0) {
+      return -1;
+    }
+    float time = -1;
+    if (e->param.func.f->f == lib_delay) {
+      time = delay_max_time(args, 1, 4);
+    } else if (e->param.func.f->f == lib_taps) {
+      time = delay_max_time(args, 2, 2);
+    }
+    if (time > 0 && delay_alloc(e->param.func.context, time) < 0) {
+      return -1;
+    }
+  }
+  for (int i = 0; i < vec_len(args); i++) {
+    if (glitch_prepare(script, &vec_nth(args, i), count) < 0) {
+      return -1;
+    }
   }
+  return 0;
 }
 
 int glitch_compile(struct glitch *g, const char *s, size_t len) {
@@ -955,8 +2447,10 @@ int glitch_compile(struct glitch *g, const char *s, size_t len) {
       g->v[i] = expr_var(&g->vars, name, strlen(name));
       snprintf(name, sizeof(name), "g%d", i);
       g->g[i] = expr_var(&g->vars, name, strlen(name));
-      g->k[i]->value = g->v[i]->value = g->g[i]->value = NAN;
+      *g->k[i]->value = *g->v[i]->value = *g->g[i]->value = NAN;
+      g->k[i]->pinned = g->v[i]->pinned = g->g[i]->pinned = 1;
     }
+    g->t->pinned = g->x->pinned = g->y->pinned = g->bpm->pinned = 1;
 
     /* Note constants */
     const struct {
@@ -976,68 +2470,274 @@ int glitch_compile(struct glitch *g, const char *s, size_t len) {
         strncpy(buf, notes[n].name, sizeof(buf));
         buf[strlen(buf) - 1] = '0' + octave + 4;
         int note = notes[n].pitch + octave * 12;
-        expr_var(&g->vars, buf, strlen(buf))->value = note;
+        struct expr_var *v = expr_var(&g->vars, buf, strlen(buf));
+        *v->value = note;
+        v->constant = 1;
+        v->pinned = 1;
       }
     }
 
     /* TR808 drum constants */
-    expr_var(&g->vars, "BD", 3)->value = 0;
-    expr_var(&g->vars, "SD", 3)->value = 1;
-    expr_var(&g->vars, "MT", 3)->value = 2;
-    expr_var(&g->vars, "MA", 3)->value = 3;
-    expr_var(&g->vars, "RS", 3)->value = 4;
-    expr_var(&g->vars, "CP", 3)->value = 5;
-    expr_var(&g->vars, "CB", 7)->value = 6;
-    expr_var(&g->vars, "OH", 3)->value = 7;
-    expr_var(&g->vars, "HH", 3)->value = 8;
+    const char *drums[] = {"BD", "SD", "MT", "MA", "RS",
+                           "CP", "CB", "OH", "HH"};
+    for (unsigned int n = 0; n < sizeof(drums) / sizeof(drums[0]); n++) {
+      struct expr_var *v = expr_var(&g->vars, drums[n], strlen(drums[n]));
+      *v->value = n;
+      v->constant = 1;
+      v->pinned = 1;
+    }
 
     g->init = 1;
   }
-  struct expr *e = expr_create(s, len, &g->vars, glitch_funcs);
+  glitch_reclaim(g);
+  struct expr_func_list *funcs = glitch_func_list();
+  if (funcs == NULL) {
+    return -1;
+  }
+  struct expr *e = expr_create(s, len, &g->vars, funcs);
   if (e == NULL) {
     return -1;
   }
-  expr_destroy(g->next_expr, NULL);
-  g->next_expr = e;
+  expr_optimize(e, &g->vars);
+  struct glitch_script *script = calloc(1, sizeof(struct glitch_script));
+  if (script == NULL || (vec_push(&g->scripts, script)) == -1) {
+    free(script);
+    expr_destroy(e, NULL);
+    return -1;
+  }
+  struct expr *compact = expr_arena_create(&script->arena, e);
+  if (compact == NULL) {
+    expr_destroy(e, NULL);
+    glitch_script_release(g, script);
+    return -1;
+  }
+  e = compact;
+  script->e = e;
+  int count = 0;
+  if (glitch_prepare(script, e, &count) < 0) {
+    glitch_script_release(g, script);
+    return -1;
+  }
+  /* Time and MIDI keys/velocities change every frame, see glitch_tick().
+   * Time is always a whole number */
+  float *driven[1 + 2 * MAX_POLYPHONY];
+  driven[0] = g->t->value;
+  for (int i = 0; i < MAX_POLYPHONY; i++) {
+    driven[1 + i] = g->k[i]->value;
+    driven[1 + MAX_POLYPHONY + i] = g->v[i]->value;
+  }
+  /* Native code only pays off for hosts that render frame by frame */
+  script->prog = expr_compile(e);
+  if (script->prog != NULL && !g->blocks) {
+    expr_jit(script->prog);
+  }
+  script->block = expr_block_create(e, driven, 1 + 2 * MAX_POLYPHONY, 1);
+  if (script->block != NULL) {
+    script->block->smooth = g->smooth;
+  }
+
+  /* A pending script that the audio thread hasn't taken yet is dropped */
+  struct glitch_script *dropped = ATOMIC_EXCHANGE(&g->next, script);
+  if (dropped != NULL) {
+    glitch_script_release(g, dropped);
+  }
+
+  /* Variables that no published and unreclaimed script uses */
+  int n = vec_len(&g->scripts);
+  struct expr **live = malloc(n * sizeof(struct expr *));
+  if (live != NULL) {
+    for (int i = 0; i < n; i++) {
+      live[i] = vec_nth(&g->scripts, i)->e;
+    }
+    expr_var_gc(&g->vars, live, n);
+    free(live);
+  }
   return 0;
 }
 
 float glitch_beat(struct glitch *g) {
-  return (g->frame - g->bpm_start) * g->bpm->value / 60.0 / SAMPLE_RATE;
+  return (g->frame - g->bpm_start) * *g->bpm->value / 60.0 / SAMPLE_RATE;
 }
 
-float glitch_eval(struct glitch *g) {
+/* Hands a script that the audio thread owns over to glitch_reclaim() */
+static void glitch_retire(struct glitch *g, struct glitch_script *s) {
+  g->retired[g->retired_head % MAX_RETIRED] = s;
+  ATOMIC_STORE(&g->retired_head, g->retired_head + 1);
+}
+
+/* Checks if the loader has published all samples of a script, resuming from
+ * the first one that was not ready last time */
+static int glitch_script_ready(struct glitch_script *s) {
+  while (s->resident < vec_len(&s->samples) &&
+         ATOMIC_LOAD(&vec_nth(&s->samples, s->resident)->ready)) {
+    s->resident++;
+  }
+  return s->resident == vec_len(&s->samples);
+}
+
+/* With wait_samples the audio thread takes published scripts into the pending
+ * slot, where they stay until their samples are resident. The mailbox stays
+ * empty meanwhile, so blocks are only split when a swap is due */
+static void glitch_take(struct glitch *g) {
+  if (!g->wait_samples || ATOMIC_LOAD(&g->next) == NULL) {
+    return;
+  }
+  if (g->pending != NULL &&
+      g->retired_head - ATOMIC_LOAD(&g->retired_tail) == MAX_RETIRED) {
+    return;
+  }
+  struct glitch_script *next = ATOMIC_EXCHANGE(&g->next, NULL);
+  if (g->pending != NULL) {
+    glitch_retire(g, g->pending);
+  }
+  g->pending = next;
+}
+
+/* Returns 1 if a script is waiting to be swapped in on the beat */
+static int glitch_due(struct glitch *g) {
+  glitch_take(g);
+  if (g->pending != NULL) {
+    return !g->wait_samples || glitch_script_ready(g->pending);
+  }
+  return ATOMIC_LOAD(&g->next) != NULL;
+}
+
+static void glitch_swap(struct glitch *g) {
+  if (!glitch_due(g)) {
+    return;
+  }
   int apply_next = 1;
   /* If BPM is given - apply changes on the next beat */
-  if (g->bpm->value > 0) {
+  if (*g->bpm->value > 0) {
     float beat = glitch_beat(g);
-    if (beat - floorf(beat) > g->bpm->value / 60.0 / SAMPLE_RATE) {
+    if (beat - floorf(beat) > *g->bpm->value / 60.0 / SAMPLE_RATE) {
       apply_next = 0;
     }
   }
-  if (apply_next && g->next_expr != NULL) {
-    if (g->bpm->value != g->last_bpm) {
-      g->last_bpm = g->bpm->value;
-      g->bpm_start = g->frame;
-    }
-    expr_destroy(g->e, NULL);
-    g->e = g->next_expr;
-    g->next_expr = NULL;
+  /* The replaced script is queued for glitch_reclaim(), if the queue is full
+   * the swap waits until it has been drained */
+  if (g->retired_head - ATOMIC_LOAD(&g->retired_tail) == MAX_RETIRED) {
+    apply_next = 0;
   }
-  float v = expr_eval(g->e);
-  if (!isnan(v)) {
-    g->last_sample = v;
+  if (!apply_next) {
+    return;
+  }
+  struct glitch_script *next = g->pending;
+  if (next != NULL) {
+    g->pending = NULL;
+  } else if (g->wait_samples) {
+    /* Published after glitch_take(), its samples are checked next frame */
+    return;
+  } else if ((next = ATOMIC_EXCHANGE(&g->next, NULL)) == NULL) {
+    return;
+  }
+  if (*g->bpm->value != g->last_bpm) {
+    g->last_bpm = *g->bpm->value;
+    g->bpm_start = g->frame;
+  }
+  if (g->script != NULL) {
+    glitch_retire(g, g->script);
   }
-  g->t->value = (long)(g->frame * 8000.0f / SAMPLE_RATE);
+  g->script = next;
+}
+
+/* Advances time and fades out released MIDI notes at the end of each frame */
+static void glitch_tick(struct glitch *g) {
+  *g->t->value = (long)(g->frame * 8000.0f / SAMPLE_RATE);
   g->frame++;
+  if (g->script != NULL && g->script->block != NULL) {
+    g->script->block->frames++;
+  }
   for (int i = 0; i < MAX_POLYPHONY; i++) {
-    if (!isnan(g->v[i]->value) && isnan(g->g[i]->value)) {
-      g->v[i]->value = g->v[i]->value * 0.999;
-      if (g->v[i]->value < 0.01f) {
-        g->v[i]->value = NAN;
-        g->k[i]->value = NAN;
+    if (!isnan(*g->v[i]->value) && isnan(*g->g[i]->value)) {
+      *g->v[i]->value = *g->v[i]->value * 0.999;
+      if (*g->v[i]->value < 0.01f) {
+        *g->v[i]->value = NAN;
+        *g->k[i]->value = NAN;
       }
     }
   }
+}
+
+float glitch_eval(struct glitch *g) {
+  glitch_midi_apply(g, 1);
+  glitch_swap(g);
+  struct glitch_script *s = g->script;
+  if (s == NULL) {
+    glitch_tick(g);
+    return g->last_sample;
+  }
+  /* Bytecode is missing only if it couldn't be allocated */
+  float v = (s->prog != NULL ? expr_run(s->prog) : expr_eval(s->e));
+  if (!isnan(v)) {
+    g->last_sample = v;
+  }
+  glitch_tick(g);
   return g->last_sample;
 }
+
+static void glitch_render(struct glitch *g, float *out, int n) {
+  struct expr_block *b = g->script->block;
+  float driven[1 + 2 * MAX_POLYPHONY];
+
+  /* Record per-frame values of the driven variables in advance */
+  b->n = n;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < b->ndriven; j++) {
+      b->ramps[j].buf[i] = *b->ramps[j].value;
+    }
+    glitch_tick(g);
+  }
+  for (int j = 0; j < b->ndriven; j++) {
+    driven[j] = *b->ramps[j].value;
+  }
+
+  expr_eval_block(g->script->e, out, b);
+  expr_block_finish(b);
+
+  for (int j = 0; j < b->ndriven; j++) {
+    *b->ramps[j].value = driven[j];
+  }
+  for (int i = 0; i < n; i++) {
+    if (isnan(out[i])) {
+      out[i] = g->last_sample;
+    } else {
+      g->last_sample = out[i];
+    }
+  }
+}
+
+/* Frames that can be rendered in a block before a due script change, which is
+ * applied on the first frame of a beat. One frame early, so that the swap is
+ * still decided by glitch_eval() */
+static int glitch_until_beat(struct glitch *g, int max) {
+  float bpm = *g->bpm->value;
+  if (!(bpm > 0)) {
+    return max;
+  }
+  float beat = glitch_beat(g);
+  double left = (1 - (beat - floorf(beat))) * 60.0 * SAMPLE_RATE / bpm - 1;
+  return left < 1 ? 0 : (int)MIN(left, max);
+}
+
+void glitch_eval_block(struct glitch *g, float *out, int frames) {
+  while (frames > 0) {
+    /* Blocks are split at queued MIDI events and at the beat of a pending
+     * script change */
+    int n = glitch_midi_apply(g, MIN(frames, EXPR_BLOCK_SIZE));
+    glitch_swap(g);
+    if (g->script != NULL && g->script->block != NULL && glitch_due(g)) {
+      n = glitch_until_beat(g, n);
+    }
+    if (n == 0 || g->script == NULL || g->script->block == NULL) {
+      n = (n == 0 ? 1 : n);
+      for (int i = 0; i < n; i++) {
+        out[i] = glitch_eval(g);
+      }
+    } else {
+      glitch_render(g, out, n);
+    }
+    out = out + n;
+    frames = frames - n;
+  }
+}
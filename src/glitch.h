@@ -7,11 +7,74 @@ extern "C" {
 #include "expr.h"
 
 #define MAX_POLYPHONY 9
+#define MAX_RETIRED 4
+#define MAX_MIDI_EVENTS 256
 
+/*
+ * Mono 16-bit frames of one sample variant. The loader resolves a sample
+ * function name and variant to a handle that must stay valid for as long as
+ * the loader is set, or returns NULL if there is no such sample. It must not
+ * block: frames may be loaded in the background and published by setting
+ * ready atomically, until then the sample plays silence. Samples should be
+ * converted to the engine rate when they are loaded, others are stepped
+ * through at their own rate.
+ *
+ * glitch_compile() resolves every variant a script may play, all of them if
+ * the variant is not a constant, so that the loader can prefetch them. The
+ * audio thread calls the loader only when a playing variant changes, never
+ * per frame.
+ */
+struct glitch_sample {
+  const int16_t *data;
+  size_t len;
+  int ready;
+  int rate; /* frames per second, played at the engine rate if 0 */
+};
+
+/* Everything compiled from one script */
+struct glitch_script {
+  struct expr *e;
+  struct expr_prog *prog;
+  struct expr_block *block;
+  struct expr_arena arena;
+  vec(const struct glitch_sample *) samples; /* referenced, see loader */
+  int resident; /* leading samples known to be ready */
+};
+
+/* A MIDI message to be applied at the given frame, see glitch_midi_at() */
+struct glitch_midi_event {
+  long frame;
+  unsigned char cmd;
+  unsigned char a;
+  unsigned char b;
+};
+
+/*
+ * glitch_compile() and glitch_reclaim() may run on another thread than the
+ * audio callback, as long as they are not called concurrently with each other.
+ * Scripts are handed over lock-free: the compiler publishes the next script in
+ * a single-slot mailbox and the audio thread takes it on the beat, returning
+ * the replaced one through a single-producer single-consumer ring.
+ *
+ * MIDI events are queued the same way and applied by the audio thread at
+ * their exact frames. glitch_midi_at(), glitch_midi() and glitch_xy() must all
+ * be called from the same single producer thread. x and y are not queued, only
+ * their latest values are kept and applied on the next frame.
+ */
 struct glitch {
   int init;
-  struct expr *e;
-  struct expr *next_expr;
+  struct glitch_script *script;  /* playing, owned by the audio thread */
+  struct glitch_script *next;    /* mailbox, swapped atomically */
+  struct glitch_script *pending; /* taken from next, waiting for samples */
+  struct glitch_script *retired[MAX_RETIRED];
+  unsigned int retired_head; /* advanced by the audio thread */
+  unsigned int retired_tail; /* advanced by glitch_reclaim() */
+  vec(struct glitch_script *) scripts; /* published, not yet reclaimed */
+  struct glitch_midi_event midi[MAX_MIDI_EVENTS];
+  unsigned int midi_head; /* advanced by glitch_midi_at() */
+  unsigned int midi_tail; /* advanced by the audio thread */
+  long midi_frame;        /* frame of the last queued event */
+  uint64_t xy;            /* latest x and y bits, GLITCH_XY_NONE if applied */
   struct expr_var_list vars;
   struct expr_var *t;
   struct expr_var *x;
@@ -22,6 +85,10 @@ struct glitch {
   struct expr_var *g[MAX_POLYPHONY];
   struct expr_var *v[MAX_POLYPHONY];
 
+  int smooth; /* glide block-rate values in glitch_eval_block(), see expr.h */
+  int wait_samples; /* hold script changes until their samples are ready */
+  int blocks; /* host renders with glitch_eval_block(), skip native code */
+
   long frame;     /* Frame number since the beginning of the playback */
   long bpm_start; /* Frame number when tempo has been changed */
   float last_bpm;
@@ -31,15 +98,34 @@ struct glitch {
 struct glitch *glitch_create();
 void glitch_destroy(struct glitch *g);
 int glitch_compile(struct glitch *g, const char *s, size_t len);
+void glitch_reclaim(struct glitch *g);
 float glitch_beat(struct glitch *g);
 void glitch_xy(struct glitch *g, float x, float y);
-void glitch_midi(struct glitch *g, unsigned char cmd, unsigned char a,
-                 unsigned char b);
+int glitch_midi(struct glitch *g, unsigned char cmd, unsigned char a,
+                unsigned char b);
+int glitch_midi_at(struct glitch *g, long frame, unsigned char cmd,
+                   unsigned char a, unsigned char b);
+/*
+ * glitch_eval() runs the script's native code where the JIT is available and
+ * blocks is not set, otherwise its bytecode, or the tree if that couldn't be
+ * allocated. glitch_eval_block() evaluates the tree a block at a time and only
+ * uses glitch_eval() for the frames around a script change on the beat.
+ */
 float glitch_eval(struct glitch *g);
+void glitch_eval_block(struct glitch *g, float *out, int frames);
 
 void glitch_sample_rate(int rate);
 
-typedef float (*glitch_loader_fn)(const char *name, int variant, int frame);
+/* How samples are read between frames when they are pitched */
+enum glitch_interp {
+  GLITCH_INTERP_LINEAR,
+  GLITCH_INTERP_CUBIC, /* default */
+  GLITCH_INTERP_SINC,
+};
+void glitch_interpolation(enum glitch_interp mode);
+
+typedef const struct glitch_sample *(*glitch_loader_fn)(const char *name,
+                                                        int variant);
 void glitch_set_loader(glitch_loader_fn fn);
 int glitch_add_sample_func(const char *name);
 
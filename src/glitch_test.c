@@ -74,6 +74,12 @@ static void test_hz() {
   GLITCH_TEST("hz(A3+0.5)") {
     ASSERT(glitch_eval(g) > 220.f && glitch_eval(g) < 233.f);
   }
+
+  /* Ten octaves above and below A4 */
+  GLITCH_TEST("hz(A4+120)") { ASSERT(glitch_eval(g) == 450560.f); }
+  GLITCH_TEST("hz(A4-120)") {
+    ASSERT(fabsf(glitch_eval(g) - 0.4296875f) < 0.000001f);
+  }
 }
 
 static void test_byte() {
@@ -317,6 +323,48 @@ static void test_env() {
   }
 }
 
+static void test_filter() {
+  printf("TEST: lpf(), svf()\n");
+
+  /* Low-pass filters pass DC, high-pass filters block it */
+  const char *dc[] = {"lpf(1, 1000)", "bsf(1, 1000)", "svf(1, 1000)",
+                      "svf(1, 1000, 1, 3)"};
+  const char *blocked[] = {"hpf(1, 1000)", "bpf(1, 1000)",
+                           "svf(1, 1000, 1, 1)", "svf(1, 1000, 1, 2)"};
+  for (int i = 0; i < 4; i++) {
+    GLITCH_TEST(dc[i]) {
+      for (int j = 0; j < 1000; j++) {
+        glitch_eval(g);
+      }
+      ASSERT(fabsf(glitch_eval(g) - 1) < 0.001f);
+    }
+    GLITCH_TEST(blocked[i]) {
+      for (int j = 0; j < 1000; j++) {
+        glitch_eval(g);
+      }
+      ASSERT(fabsf(glitch_eval(g)) < 0.001f);
+    }
+  }
+
+  /* Modulated biquads glide to new coefficients within a control period */
+  GLITCH_TEST("lpf(1, 100+x*1000)") {
+    struct filter_context *filter =
+        (struct filter_context *)g->next->e->param.func.context;
+    float c[5];
+    glitch_eval(g);
+    glitch_xy(g, 1, 0);
+    for (int i = 0; i < FILTER_CONTROL; i++) {
+      glitch_eval(g);
+    }
+    ASSERT(filter->glide == FILTER_CONTROL - 1);
+    for (int i = 1; i < FILTER_CONTROL; i++) {
+      glitch_eval(g);
+    }
+    filter_coefs(FILTER_LPF, 1100.f / SAMPLE_RATE, 1, c);
+    ASSERT(filter->glide == 0 && memcmp(filter->c, c, sizeof(c)) == 0);
+  }
+}
+
 static void test_delay() {
   printf("TEST: delay()\n");
 
@@ -325,7 +373,7 @@ static void test_delay() {
     int prev_sr = SAMPLE_RATE;
     SAMPLE_RATE = 4;
     float x[] = {1, 2, 3, 4, 3, 2, 1};
-    float expect[] = {1, 2, 3.5, 5, 4.5, 4, 2.5};
+    float expect[] = {1, 2, 3.5, 5, 4.75, 4.5, 3.375};
     for (unsigned int i = 0; i < sizeof(expect) / sizeof(expect[0]); i++) {
       glitch_xy(g, x[i], 0);
       float v = glitch_eval(g);
@@ -340,7 +388,7 @@ static void test_delay() {
     SAMPLE_RATE = 4;
     float x[] = {1, 2, 3, 4, 5, 6, 7, 8};
     float y[] = {1, 1, 1, 1, 1, 0.75, 0.5, 0.25};
-    float expect[] = {1, 2, 3, 4, 5.5, 7.5, 9.5, 11.5};
+    float expect[] = {1, 2, 3, 4, 5.5, 7.5, 9.75, 12.875};
     for (unsigned int i = 0; i < sizeof(expect) / sizeof(expect[0]); i++) {
       glitch_xy(g, x[i], y[i]);
       float v = glitch_eval(g);
@@ -348,9 +396,849 @@ static void test_delay() {
     }
     SAMPLE_RATE = prev_sr;
   }
+
+  /* Fractional delay times interpolate between frames */
+  GLITCH_TEST("delay(x, 0.375, 1, 0)") {
+    int prev_sr = SAMPLE_RATE;
+    SAMPLE_RATE = 4;
+    float expect[] = {1, 2.5, 4.5, 6.5};
+    for (unsigned int i = 0; i < sizeof(expect) / sizeof(expect[0]); i++) {
+      glitch_xy(g, i + 1, 0);
+      float v = glitch_eval(g);
+      ASSERT(v == expect[i]);
+    }
+    SAMPLE_RATE = prev_sr;
+  }
+
+  /* Taps share one line and feed their sum back */
+  GLITCH_TEST("taps(x, 0.5, 0.25, 1, 0.5, 0.5)") {
+    int prev_sr = SAMPLE_RATE;
+    SAMPLE_RATE = 4;
+    float expect[] = {1, 1, 1, 0.75};
+    for (unsigned int i = 0; i < sizeof(expect) / sizeof(expect[0]); i++) {
+      glitch_xy(g, i == 0, 0);
+      float v = glitch_eval(g);
+      ASSERT(v == expect[i]);
+    }
+    SAMPLE_RATE = prev_sr;
+  }
+
+  /* Buffers are allocated by the compiler, constant times get short ones */
+  GLITCH_TEST("delay(x, 0.5) + delay(x, y)") {
+    struct expr *e = g->next->e;
+    struct delay_context *a = vec_nth(&e->param.op.args, 0).param.func.context;
+    struct delay_context *b = vec_nth(&e->param.op.args, 1).param.func.context;
+    ASSERT(a->buf != NULL && (int)a->mask >= SAMPLE_RATE / 2);
+    ASSERT((int)a->mask < SAMPLE_RATE);
+    ASSERT(b->buf != NULL && (int)b->mask >= SAMPLE_RATE * MAX_DELAY_TIME);
+  }
+  /* Times swept by an oscillator are bounded by its range */
+  GLITCH_TEST("delay(x, 0.25+sin(4)/10) + delay(x, 0.5-(y>1)*tri(2)*0.2)") {
+    struct expr *e = g->next->e;
+    struct delay_context *a = vec_nth(&e->param.op.args, 0).param.func.context;
+    struct delay_context *b = vec_nth(&e->param.op.args, 1).param.func.context;
+    ASSERT((int)a->mask >= SAMPLE_RATE * 0.35f && (int)a->mask < SAMPLE_RATE);
+    ASSERT((int)b->mask >= SAMPLE_RATE * 0.7f && (int)b->mask < SAMPLE_RATE * 2);
+  }
+  GLITCH_TEST("taps(x, 0.5, 0.1, 0.5, 0.2, 0.5)") {
+    struct delay_context *delay = g->next->e->param.func.context;
+    ASSERT(delay->buf != NULL && (int)delay->mask < SAMPLE_RATE / 2);
+  }
+  /* each() clones its body before the clones are prepared */
+  GLITCH_TEST("each((n), delay(x, 0.5, 0.5, 0.5), 0)") {
+    int prev_sr = SAMPLE_RATE;
+    SAMPLE_RATE = 4;
+    float x[] = {1, 2, 3, 4, 3, 2, 1};
+    float expect[] = {1, 2, 3.5, 5, 4.75, 4.5, 3.375};
+    for (unsigned int i = 0; i < sizeof(expect) / sizeof(expect[0]); i++) {
+      glitch_xy(g, x[i], 0);
+      ASSERT(glitch_eval(g) == expect[i]);
+    }
+    SAMPLE_RATE = prev_sr;
+  }
+  GLITCH_TEST("each((n), taps(x, 0.5, 0.25, 1, 0.5, 0.5), 0)") {
+    int prev_sr = SAMPLE_RATE;
+    SAMPLE_RATE = 4;
+    float expect[] = {1, 1, 1, 0.75};
+    for (unsigned int i = 0; i < sizeof(expect) / sizeof(expect[0]); i++) {
+      glitch_xy(g, i == 0, 0);
+      ASSERT(glitch_eval(g) == expect[i]);
+    }
+    SAMPLE_RATE = prev_sr;
+  }
 }
 
-static void test_benchmark(const char *s) {
+static double ref_sin(double x) { return sin(2 * 3.14159265358979 * x); }
+
+static void test_pluck() {
+  printf("TEST: pluck()\n");
+
+  /* Strings are tuned to fractional periods, here 100.5 frames */
+  float f = SAMPLE_RATE / 100.5f;
+  char s[64];
+  snprintf(s, sizeof(s), "pluck(%f)", f);
+  GLITCH_TEST(s) {
+    struct pluck_context *pluck = g->next->e->param.func.context;
+    ASSERT(pluck->buf != NULL && pluck->mask == 127);
+    float out[5000];
+    for (int i = 0; i < 5000; i++) {
+      out[i] = glitch_eval(g);
+      ASSERT(out[i] >= -1 && out[i] <= 1);
+    }
+    float tuned = 0, rounded = 0;
+    for (int i = 4000; i < 4600; i++) {
+      tuned = tuned + fabsf(out[i + 201] - out[i]);
+      rounded = rounded + fabsf(out[i + 200] - out[i]);
+    }
+    ASSERT(tuned * 4 < rounded);
+  }
+
+  /* NAN retriggers the string, which plays a period of the excitation before
+   * it feeds back. Here period is 9.5 frames and a click is filtered */
+  GLITCH_TEST("pluck(x, 0.5, y)") {
+    glitch_xy(g, SAMPLE_RATE / 10.f, 1);
+    ASSERT(glitch_eval(g) == 1);
+    glitch_xy(g, SAMPLE_RATE / 10.f, 0);
+    for (int i = 1; i < 11; i++) {
+      ASSERT(glitch_eval(g) == 0);
+    }
+    ASSERT(glitch_eval(g) == 0.25f);
+    glitch_xy(g, NAN, 0);
+    glitch_eval(g);
+    glitch_xy(g, SAMPLE_RATE / 10.f, 0);
+    for (int i = 0; i < 100; i++) {
+      ASSERT(glitch_eval(g) == 0);
+    }
+  }
+
+  /* Strings cloned by each() are allocated by the compiler as well */
+  GLITCH_TEST("each((n), pluck(x, 0.5, y), 0, 1)") {
+    struct each_context *each = g->next->e->param.func.context;
+    for (int i = 0; i < vec_len(&each->args); i++) {
+      struct pluck_context *pluck = vec_nth(&each->args, i).param.func.context;
+      ASSERT(pluck->buf != NULL);
+    }
+    glitch_xy(g, SAMPLE_RATE / 10.f, 1);
+    ASSERT(glitch_eval(g) == 2 / sqrtf(2));
+  }
+}
+
+static void test_tr808() {
+  printf("TEST: tr808()\n");
+  /* Frames start at the real data chunk, not at a fixed header size */
+  ASSERT(tr808_bank[0].len == 0xac46 / 2);
+  ASSERT(tr808_bank[0].data[0] == -16.f / 0x8000);
+  ASSERT(((size_t)tr808_bank[0].data & (BANK_ALIGN - 1)) == 0);
+  /* Banks recorded at another rate than the engine are resampled */
+  ASSERT(tr808_bank[0].rate == 44100);
+  GLITCH_TEST("tr808(BD)") {
+    glitch_eval(g);
+    struct sample_context *sample = g->script->e->param.func.context;
+    ASSERT(sample->step == 44100.f / SAMPLE_RATE);
+  }
+  int prev_sr = SAMPLE_RATE;
+  SAMPLE_RATE = tr808_bank[0].rate;
+  GLITCH_TEST("tr808(BD, 2, y)") {
+    ASSERT(glitch_eval(g) == tr808_bank[0].data[0] * 2);
+    ASSERT(glitch_eval(g) == tr808_bank[0].data[1] * 2);
+    /* An octave up skips every other frame */
+    glitch_xy(g, 0, 12);
+    ASSERT(glitch_eval(g) == tr808_bank[0].data[2] * 2);
+    ASSERT(glitch_eval(g) == tr808_bank[0].data[4] * 2);
+  }
+  SAMPLE_RATE = prev_sr;
+  /* Vectors of frames read the same as single ones in every mode */
+  const char *s = "tr808(t>>11&7, 1, seq(480,0,-5,7)) + piano(hz(t>>12&31))";
+  for (int i = GLITCH_INTERP_LINEAR; i <= GLITCH_INTERP_SINC; i++) {
+    glitch_interpolation((enum glitch_interp)i);
+    struct glitch *a = glitch_create();
+    struct glitch *b = glitch_create();
+    float out[1000];
+    ASSERT(glitch_compile(a, s, strlen(s)) == 0);
+    ASSERT(glitch_compile(b, s, strlen(s)) == 0);
+    for (int j = 0; j < 20; j++) {
+      glitch_eval_block(b, out, 1000);
+      for (int k = 0; k < 1000; k++) {
+        float v = glitch_eval(a);
+        if (fabsf(v - out[k]) > 1e-6f) {
+          ASSERT(v == out[k]);
+          j = 20;
+          break;
+        }
+      }
+    }
+    glitch_destroy(a);
+    glitch_destroy(b);
+  }
+  glitch_interpolation(GLITCH_INTERP_CUBIC);
+}
+
+static void test_math() {
+  printf("TEST: fast_exp2(), fast_log2(), fast_sin(), fast_sqrt()\n");
+
+  /* Block variants must give the same results as the scalar ones */
+  float x[1000], out[1000];
+  unsigned int seed = 1;
+  for (int i = 0; i < 1000; i++) {
+    seed = seed * 1664525 + 1013904223;
+    x[i] = ldexpf((seed >> 8) / 16777216.f - 0.5f, (int)(seed % 16) - 4);
+  }
+  x[0] = NAN, x[1] = INFINITY, x[2] = -INFINITY, x[3] = 0, x[4] = 1e-40f;
+  fast_exp2_block(x, out, 1000);
+  for (int i = 0; i < 1000; i++) {
+    float v = fast_exp2(x[i]);
+    ASSERT(memcmp(&v, &out[i], sizeof(v)) == 0);
+    ASSERT(i < 3 || fabsf(x[i]) > 125 ||
+           fabs(v - exp2((double)x[i])) < 1.7e-7 * exp2(x[i]));
+    ASSERT(!(x[i] >= 128) || v == INFINITY);
+    ASSERT(!(x[i] < -125) || v == 0);
+  }
+  fast_log2_block(x, out, 1000);
+  for (int i = 0; i < 1000; i++) {
+    float v = fast_log2(x[i]);
+    ASSERT(memcmp(&v, &out[i], sizeof(v)) == 0);
+    ASSERT(i < 4 || !(x[i] > 0) ||
+           fabs(v - log2((double)x[i])) < 1.5e-7 * fmax(1, fabs(v)));
+  }
+  fast_sin_block(x, out, 1000);
+  for (int i = 0; i < 1000; i++) {
+    float v = fast_sin(x[i]);
+    ASSERT(memcmp(&v, &out[i], sizeof(v)) == 0);
+    ASSERT(i < 3 || fabs(v - ref_sin(x[i])) < 1.7e-7);
+  }
+  fast_sqrt_block(x, out, 1000);
+  for (int i = 0; i < 1000; i++) {
+    float v = fast_sqrt(x[i]);
+    ASSERT(memcmp(&v, &out[i], sizeof(v)) == 0);
+  }
+
+  /* Special values */
+  ASSERT(isnan(fast_exp2(NAN)) && isnan(fast_log2(NAN)));
+  ASSERT(isnan(fast_sin(NAN)) && isnan(fast_sin(INFINITY)));
+  ASSERT(fast_exp2(INFINITY) == INFINITY && fast_exp2(-INFINITY) == 0);
+  ASSERT(fast_exp2(0) == 1 && fast_exp2(-3) == 0.125f);
+  ASSERT(fast_exp2(100) == 1267650600228229401496703205376.f);
+  ASSERT(fast_log2(0) == -INFINITY && isnan(fast_log2(-1)));
+  ASSERT(fast_log2(INFINITY) == INFINITY && fast_log2(1024) == 10);
+  ASSERT(fabsf(fast_log2(1e-40f) + 132.877f) < 0.001f);
+  ASSERT(fast_sin(0.25f) == 1 && fast_sin(-0.25f) == -1 && fast_sin(1e9f) == 0);
+}
+
+static void test_eval_block() {
+  printf("TEST: glitch_eval_block()\n");
+
+  /* Block rendering must produce the same samples as glitch_eval() */
+  const char *scripts[] = {
+      "sin(440)",
+      "byte(t*(t>>10&42))",
+      "(sin(220)+sin(440)+sin(880)+sin(110))/4",
+      "lpf(saw(hz(seq(480,0,3,7))), 800+400*sin(2))",
+      "bpm=120, i=seq(bpm*4,0,3,7), v=env(tri(hz(i)), (0.01, 0.1)),"
+      "mix(v, delay(v, 0.01, 0.5, 0.5))",
+      "x=sin(2), y=x&&seq(480,1,0), y*sqr(110, 0.25)",
+      "a(i=i+1,1,2,3,4)",
+      "each((k, v), v*sin(hz(k)), (k0, v0), (k1, v1))",
+      "saw(440-t%900)+tri(30000+t)+sqr(t%3000, sin(1)/2+0.5)",
+      "y=x+1, lpf(saw(hz(seq(480,0,3,7)+y)), 800*y, 1+x) + l(t%7) + s(t/9)",
+      "(t<<23|t)>>t%5 ^ (t<<(t&7)) ^ ~t%64 ^ (t*7)<<24>>20 ^ (t>>3)%-7",
+      "(1/x|t) + (-1/x&t) + (0/0^t) + ((t-900)%16) + ((t-900)>>2)%-5 + t%x",
+      "svf(saw(hz(seq(480,0,3,7))), 300+200*sin(1), 1+y, t>>9) + "
+      "bpf(sqr(110), 1000+t%900) + hpf(tri(55), 800, 0.7) + bsf(saw(t%99))",
+      "taps(sin(440), 0.3, 0.01, 0.5, 0.02+sin(2)/100, 0.3, 0.005) + "
+      "taps(saw(220)*(t<999), 0.4, 0.05, 0.5, 0.1, 0.25)",
+      "pluck(hz(seq(240,0,3,7)), 0.5) + pluck(330+t%7, 0.3, sin(1000)) + "
+      "pluck(y*-2000-50, x)",
+      "a=t&7, b=a*3, a=t>>2&3, b*100 + a*3 + (t>>2&3)*3 + (x*y+t%5)*(x*y+t%5)",
+      "each((f, v), sin(f*hz(t>>11&7))*v + (t>>11&7)/9, (1, 0.5), (2, 0.2)) + "
+      "hz(t>>11&7)/1000 + (t>>11&7)",
+  };
+  int sizes[] = {1, 7, 64, 128, 300, 1000, 33, 500};
+  float out[1000];
+  for (unsigned int i = 0; i < sizeof(scripts) / sizeof(scripts[0]); i++) {
+    struct glitch *a = glitch_create();
+    struct glitch *b = glitch_create();
+    ASSERT(glitch_compile(a, scripts[i], strlen(scripts[i])) == 0);
+    ASSERT(glitch_compile(b, scripts[i], strlen(scripts[i])) == 0);
+    for (unsigned int j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+      if (j == 1 || j == 4) {
+        /* Press a key, then release it and let the velocity fade out */
+        unsigned char cmd = (j == 1 ? 0x90 : 0x80);
+        glitch_midi(a, cmd, 69, 100);
+        glitch_midi(b, cmd, 69, 100);
+      }
+      glitch_eval_block(b, out, sizes[j]);
+      for (int k = 0; k < sizes[j]; k++) {
+        float v = glitch_eval(a);
+        if (out[k] != v) {
+          printf("%s: frame %d: %f != %f\n", scripts[i], k, out[k], v);
+          ASSERT(out[k] == v);
+          break;
+        }
+      }
+    }
+    glitch_destroy(a);
+    glitch_destroy(b);
+  }
+
+  /* Script changes land on the beat, blocks are only split there */
+  struct glitch *a = glitch_create();
+  struct glitch *b = glitch_create();
+  const char *s1 = "bpm=120, sin(440)", *s2 = "bpm=120, saw(220)";
+  ASSERT(glitch_compile(a, s1, strlen(s1)) == 0);
+  ASSERT(glitch_compile(b, s1, strlen(s1)) == 0);
+  glitch_eval_block(b, out, 1000);
+  for (int k = 0; k < 1000; k++) {
+    glitch_eval(a);
+  }
+  ASSERT(glitch_compile(a, s2, strlen(s2)) == 0);
+  ASSERT(glitch_compile(b, s2, strlen(s2)) == 0);
+  struct glitch_script *next = a->next;
+  long swapped = -1;
+  for (int j = 0; j < 30; j++) {
+    glitch_eval_block(b, out, 1000);
+    for (int k = 0; k < 1000; k++) {
+      float v = glitch_eval(a);
+      if (a->script == next && swapped < 0) {
+        swapped = a->frame - 1;
+      }
+      if (out[k] != v) {
+        ASSERT(out[k] == v);
+        j = 30;
+        break;
+      }
+    }
+  }
+  ASSERT(swapped == SAMPLE_RATE / 2);
+  glitch_destroy(a);
+  glitch_destroy(b);
+}
+
+static void test_rates() {
+  printf("TEST: expr_block_rate()\n");
+
+  /* Time changes every frame, x and y between blocks */
+  struct glitch *g = glitch_create();
+  const char *s = "x*440 + hz(y) + t";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  struct expr *e = g->next->e;
+  ASSERT(e->rate == EXPR_RATE_AUDIO);
+  ASSERT(vec_nth(&e->param.op.args, 0).rate == EXPR_RATE_BLOCK);
+  ASSERT(vec_nth(&e->param.op.args, 1).rate == EXPR_RATE_AUDIO);
+
+  /* Assigned variables take the rate of their values */
+  s = "a=x*2, b=t, c=3, (a+c)*b";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  for (e = g->next->e; e->type == OP_COMMA;) {
+    e = &vec_nth(&e->param.op.args, 1);
+  }
+  ASSERT(e->rate == EXPR_RATE_AUDIO);
+  ASSERT(vec_nth(&e->param.op.args, 0).rate == EXPR_RATE_BLOCK);
+  ASSERT(vec_nth(&e->param.op.args, 1).rate == EXPR_RATE_AUDIO);
+
+  /* Stateful functions run at audio rate */
+  s = "hz() + sin(440)";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  e = g->next->e;
+  ASSERT(vec_nth(&e->param.op.args, 0).rate == EXPR_RATE_CONST);
+  ASSERT(vec_nth(&e->param.op.args, 1).rate == EXPR_RATE_AUDIO);
+  glitch_destroy(g);
+
+  /* With smoothing, block-rate values glide to their new value */
+  float out[EXPR_BLOCK_SIZE];
+  g = glitch_create();
+  g->smooth = 1;
+  ASSERT(glitch_compile(g, "x", 1) == 0);
+  for (int i = 0; i < 2; i++) {
+    glitch_eval_block(g, out, EXPR_BLOCK_SIZE);
+    ASSERT(out[0] == 0 && out[EXPR_BLOCK_SIZE - 1] == 0);
+  }
+  glitch_xy(g, 1, 0);
+  glitch_eval_block(g, out, EXPR_BLOCK_SIZE);
+  ASSERT(out[0] > 0 && out[0] < 0.01f);
+  ASSERT(out[EXPR_BLOCK_SIZE / 2 - 1] == 0.5f);
+  ASSERT(out[EXPR_BLOCK_SIZE - 1] == 1);
+  glitch_eval_block(g, out, EXPR_BLOCK_SIZE);
+  ASSERT(out[0] == 1);
+  glitch_destroy(g);
+}
+
+static void test_ints() {
+  printf("TEST: expr_block_ints()\n");
+
+  /* Bitwise operators run on ints, a non-negative mask bounds the result */
+  struct glitch *g = glitch_create();
+  const char *s = "t*(t>>10&42)";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  struct expr *e = g->next->e;
+  ASSERT(e->bits == 0);
+  ASSERT(vec_nth(&e->param.op.args, 1).bits == 7);
+
+  /* Remainders only if the dividend is whole and the divisor constant */
+  s = "t%256 + (t>>1)%3 + x%4 + t%2.5";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  int tagged = 0;
+  for (e = g->next->e; e->type == OP_PLUS; e = &vec_nth(&e->param.op.args, 0)) {
+    tagged = tagged * 2 + (vec_nth(&e->param.op.args, 1).bits > 0);
+  }
+  tagged = tagged * 2 + (e->bits > 0);
+  ASSERT(tagged == 0x3);
+  glitch_destroy(g);
+}
+
+static void test_shared() {
+  printf("TEST: expr_block_share()\n");
+
+  /* Repeated subtrees share one result, their operands don't need to */
+  struct glitch *g = glitch_create();
+  const char *s = "(t>>3&7)*2 + sin((t>>3&7)*2) + ((t>>3&7)*2)/3";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  struct expr *e = g->next->e;
+  struct expr *lhs = &vec_nth(&e->param.op.args, 0);
+  struct expr *a = &vec_nth(&lhs->param.op.args, 0);
+  struct expr *b = &vec_nth(&vec_nth(&lhs->param.op.args, 1).param.func.args, 0);
+  struct expr *c = &vec_nth(&vec_nth(&e->param.op.args, 1).param.op.args, 0);
+  ASSERT(g->next->block->nshared == 1);
+  ASSERT(a->shared != NULL && a->shared == b->shared && b->shared == c->shared);
+  ASSERT(vec_nth(&lhs->param.op.args, 1).shared == NULL);
+
+  /* Reads of a variable assigned in between are different values */
+  s = "a=t&7, b=a*3, a=t&3, b*100+a*3";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  ASSERT(g->next->block->nshared == 0);
+
+  /* Clones of each() share what doesn't depend on their variables */
+  s = "each(f, f*hz(t&7), 1, 2)";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  struct each_context *each = g->next->e->param.func.context;
+  a = &vec_nth(&each->args, 0);
+  b = &vec_nth(&each->args, 1);
+  ASSERT(a->shared == NULL && b->shared == NULL);
+  a = &vec_nth(&a->param.op.args, 1);
+  b = &vec_nth(&b->param.op.args, 1);
+  ASSERT(a->shared != NULL && a->shared == b->shared);
+  glitch_destroy(g);
+
+  /* Frames evaluated one by one between blocks don't see stale values */
+  struct glitch *x = glitch_create();
+  struct glitch *y = glitch_create();
+  float out[EXPR_BLOCK_SIZE];
+  s = "each(f, (t&15)*f + hz(t&15), 1, 2) + byte((t&15)*t)";
+  ASSERT(glitch_compile(x, s, strlen(s)) == 0);
+  ASSERT(glitch_compile(y, s, strlen(s)) == 0);
+  for (int i = 0; i < 20; i++) {
+    int n = (i % 2 ? 36 : 1);
+    if (n > 1) {
+      glitch_eval_block(y, out, n);
+    } else {
+      out[0] = glitch_eval(y);
+    }
+    for (int j = 0; j < n; j++) {
+      float v = glitch_eval(x);
+      if (out[j] != v) {
+        ASSERT(out[j] == v);
+        i = 20;
+        break;
+      }
+    }
+  }
+  glitch_destroy(x);
+  glitch_destroy(y);
+}
+
+static void test_midi() {
+  printf("TEST: glitch_midi_at()\n");
+  float out[64];
+  GLITCH_TEST("(g0>0)+x") {
+    glitch_eval_block(g, out, 64);
+    ASSERT(glitch_midi_at(g, 64 + 10, 0x90, 69, 100) == 0);
+    ASSERT(glitch_midi_at(g, 64 + 40, 0x80, 69, 0) == 0);
+    glitch_eval_block(g, out, 64);
+    /* Events land on their frames within the block */
+    for (int i = 0; i < 64; i++) {
+      ASSERT(out[i] == (i >= 10 && i < 40 ? 1 : 0));
+    }
+    ASSERT(g->midi_tail == g->midi_head);
+
+    /* Late events are applied at the beginning of the next block */
+    ASSERT(glitch_midi_at(g, 0, 0xe0, 0, 129) == 0);
+    glitch_eval_block(g, out, 64);
+    ASSERT(out[0] == 1);
+
+    /* Messages glitch doesn't handle never reach the audio thread */
+    unsigned int head = g->midi_head;
+    ASSERT(glitch_midi_at(g, 0, 0xc0, 5, 0) == 0);
+    ASSERT(g->midi_head == head);
+
+    /* x and y keep only their latest value, even behind future events and
+     * while nothing is rendered */
+    ASSERT(glitch_midi_at(g, g->frame + 1000, 0x90, 60, 100) == 0);
+    for (int i = 0; i <= MAX_MIDI_EVENTS * 2; i++) {
+      glitch_xy(g, i, 0);
+    }
+    ASSERT(*g->x->value == 1);
+    glitch_eval_block(g, out, 64);
+    ASSERT(out[0] == MAX_MIDI_EVENTS * 2);
+
+    /* A full queue rejects events, the note above is still queued */
+    for (int i = 1; i < MAX_MIDI_EVENTS; i++) {
+      ASSERT(glitch_midi_at(g, 1000000, 0xe0, 0, 64) == 0);
+    }
+    ASSERT(glitch_midi_at(g, 1000000, 0xe0, 0, 64) == -1);
+  }
+}
+
+static void test_vars() {
+  printf("TEST: expr_var()\n");
+  struct glitch *g = glitch_create();
+  ASSERT(glitch_compile(g, "foo=1", 5) == 0);
+  int len = g->vars.len;
+
+  /* Names are interned, values are stored next to each other */
+  struct expr_var *foo = expr_var(&g->vars, "foo", 3);
+  ASSERT(foo == expr_var(&g->vars, "foo", 3));
+  ASSERT(g->x->value == g->t->value + 1);
+  ASSERT(((size_t)g->t->value & (EXPR_VAR_ALIGN - 1)) == 0);
+  ASSERT(expr_var_find(&g->vars, foo->value) == foo);
+  ASSERT(g->vars.len == len);
+
+  /* Variables used by the playing or the next script are kept */
+  glitch_eval(g);
+  ASSERT(*foo->value == 1);
+  ASSERT(glitch_compile(g, "bar+1", 5) == 0);
+  ASSERT(g->vars.len == len + 1);
+  ASSERT(expr_var_find(&g->vars, foo->value) == foo);
+  glitch_eval(g);
+
+  /* Once neither uses them, they are reclaimed and their slots reused */
+  float *value = foo->value;
+  ASSERT(glitch_compile(g, "baz", 3) == 0);
+  ASSERT(g->vars.len == len + 1);
+  ASSERT(glitch_compile(g, "qux", 3) == 0);
+  ASSERT(expr_var(&g->vars, "qux", 3)->value == value);
+  ASSERT(expr_var_find(&g->vars, g->t->value) == g->t);
+  ASSERT(*expr_var(&g->vars, "A4", 2)->value == 0);
+  glitch_destroy(g);
+}
+
+static void test_reclaim() {
+  printf("TEST: glitch_reclaim()\n");
+  struct glitch *g = glitch_create();
+  const char *s = "delay(sin(440)*seq(120,1,2),0.5,0.5,0.5)";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  /* Nodes, arguments and contexts are packed into one exact allocation */
+  struct glitch_script *first = g->next;
+  ASSERT(first->arena.mem != NULL);
+  ASSERT(first->arena.used == first->arena.size);
+  ASSERT((char *)first->e == first->arena.mem);
+  glitch_eval(g);
+  ASSERT(g->next == NULL && g->script == first && g->retired_head == 0);
+
+  /* A pending script that hasn't been played yet is replaced right away */
+  ASSERT(glitch_compile(g, "sin(220)", 8) == 0);
+  ASSERT(glitch_compile(g, "sin(330)", 8) == 0);
+  ASSERT(vec_len(&g->scripts) == 2);
+
+  /* Replaced scripts wait in the queue until a non-realtime thread drains it */
+  glitch_eval(g);
+  ASSERT(g->retired_head - g->retired_tail == 1);
+  ASSERT(g->retired[0] == first);
+  glitch_reclaim(g);
+  ASSERT(g->retired_head == g->retired_tail);
+  ASSERT(vec_len(&g->scripts) == 1);
+
+  /* A full queue postpones the swap */
+  ASSERT(glitch_compile(g, "sin(110)", 8) == 0);
+  g->retired_head = g->retired_tail + MAX_RETIRED;
+  glitch_eval(g);
+  ASSERT(g->next != NULL);
+  g->retired_head = g->retired_tail;
+  glitch_eval(g);
+  ASSERT(g->next == NULL);
+  glitch_destroy(g);
+}
+
+/* Contexts that used to allocate on their first evaluation */
+static void test_prepared() {
+  printf("TEST: glitch_prepare()\n");
+  const char *s = "mix(seq(120, 1, (2, 3)), loop(60, sin(220), 0)) + "
+                  "each((n), mix(seq(240, n, 0)), 1, 2)";
+  GLITCH_TEST(s) {
+    struct expr *sum = g->next->e;
+    struct expr *m = &vec_nth(&sum->param.op.args, 0);
+    struct mix_context *mix = m->param.func.context;
+    struct seq_context *seq = vec_nth(&m->param.func.args, 0).param.func.context;
+    struct seq_context *loop =
+        vec_nth(&m->param.func.args, 1).param.func.context;
+    struct each_context *each =
+        vec_nth(&sum->param.op.args, 1).param.func.context;
+    ASSERT(mix->init && vec_len(&mix->values) == 2);
+    ASSERT(seq->init && vec_len(&seq->steps) == 2);
+    ASSERT(loop->init && vec_len(&loop->steps) == 2);
+    ASSERT(each->init && vec_len(&each->args) == 2);
+    struct mix_context *clone = vec_nth(&each->args, 1).param.func.context;
+    ASSERT(clone->init && vec_len(&clone->values) == 1);
+    /* Playing the swapped script reuses what the compiler allocated */
+    const void *bufs[] = {mix->values.buf, seq->steps.buf, loop->steps.buf,
+                          each->args.buf, clone->values.buf};
+    float out[256];
+    glitch_eval(g);
+    glitch_eval_block(g, out, 256);
+    ASSERT(bufs[0] == mix->values.buf && bufs[1] == seq->steps.buf);
+    ASSERT(bufs[2] == loop->steps.buf && bufs[3] == each->args.buf);
+    ASSERT(bufs[4] == clone->values.buf);
+  }
+}
+
+static void test_parse() {
+  printf("TEST: expr_next_token()\n");
+  struct {
+    const char *s;
+    float value;
+  } ok[] = {
+      {"1<=2", 1},  {"3!=2", 1},      {"2**-1", 0.5},   {"1<-1", 0},
+      {"-2*-3", 6}, {"!0+^0", 0},     {"x=4 # x=5\nx", 4},
+      {"2>>1<<3", 8}, {"1&&0||1", 1},
+  };
+  for (unsigned int i = 0; i < sizeof(ok) / sizeof(ok[0]); i++) {
+    struct glitch *g = glitch_create();
+    ASSERT(glitch_compile(g, ok[i].s, strlen(ok[i].s)) == 0);
+    ASSERT(glitch_eval(g) == ok[i].value);
+    glitch_destroy(g);
+  }
+  const char *bad[] = {"1 .2", "1 !", "2 3", "1 */ 2", "(1", "1.5e", "4ever"};
+  for (unsigned int i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+    struct glitch *g = glitch_create();
+    ASSERT(glitch_compile(g, bad[i], strlen(bad[i])) != 0);
+    glitch_destroy(g);
+  }
+}
+
+static int test_loader_calls = 0;
+static const int16_t test_frames[] = {0, 0x4000, -0x4000, 0x2000};
+static struct glitch_sample test_samples[] = {
+    {test_frames, 4, 1}, {test_frames + 1, 3, 1}, {test_frames, 4, 0},
+    {test_frames, 4, 1}};
+
+static const struct glitch_sample *test_loader(const char *name, int variant) {
+  test_loader_calls++;
+  if (strcmp(name, "smp1") == 0 && variant >= 0 && variant <= 1) {
+    return &test_samples[variant];
+  } else if (strcmp(name, "smp2") == 0 && variant >= 0 && variant <= 1) {
+    return &test_samples[2 + variant];
+  }
+  return NULL;
+}
+
+static void test_sample_loader() {
+  glitch_set_loader(test_loader);
+  /* Constant variants are resolved once by the compiler */
+  GLITCH_TEST("smp1(0)") {
+    ASSERT(test_loader_calls == 1);
+    ASSERT(vec_len(&g->next->samples) == 1);
+    ASSERT(glitch_eval(g) == 0);
+    ASSERT(glitch_eval(g) == 0.5f);
+    ASSERT(glitch_eval(g) == -0.5f);
+    ASSERT(glitch_eval(g) == 0.25f);
+    ASSERT(isnan(expr_eval(g->script->e)));
+    ASSERT(test_loader_calls == 1);
+  }
+  /* Others are all prefetched, and resolved when the variant changes */
+  test_loader_calls = 0;
+  GLITCH_TEST("smp1(x, 2)") {
+    ASSERT(test_loader_calls == 3);
+    ASSERT(vec_len(&g->next->samples) == 2);
+    glitch_xy(g, 1, 0);
+    ASSERT(glitch_eval(g) == 1.f);
+    ASSERT(glitch_eval(g) == -1.f);
+    ASSERT(glitch_eval(g) == 0.5f);
+    /* x is applied by the audio thread on the next frame */
+    glitch_xy(g, 2, 0);
+    glitch_eval(g);
+    ASSERT(isnan(expr_eval(g->script->e)));
+    ASSERT(test_loader_calls == 5);
+  }
+  /* Samples that are not loaded yet play silence, or hold the script change */
+  GLITCH_TEST("smp2(0)") {
+    ASSERT(glitch_eval(g) == 0);
+    g->wait_samples = 1;
+    ASSERT(glitch_compile(g, "smp1(0)+smp2(0)", 15) == 0);
+    ASSERT(glitch_eval(g) == 0);
+    /* Pending scripts leave the mailbox, blocks aren't split while waiting */
+    ASSERT(g->next == NULL && g->pending != NULL);
+    ASSERT(g->pending->resident == 1 && !glitch_due(g));
+    test_samples[2].ready = 1;
+    ASSERT(glitch_eval(g) == 0);
+    ASSERT(g->pending == NULL);
+    ASSERT(glitch_eval(g) == 1.f);
+    test_samples[2].ready = 0;
+  }
+  /* Samples at another rate than the engine are stepped through at theirs */
+  test_samples[3].rate = SAMPLE_RATE * 2;
+  GLITCH_TEST("smp2(1)") {
+    ASSERT(glitch_eval(g) == 0);
+    ASSERT(glitch_eval(g) == -0.5f);
+    ASSERT(isnan(expr_eval(g->script->e)));
+  }
+  /* Frames between two others are interpolated, whole frames are exact */
+  float half[] = {0.25f, 0.3125f, 0};
+  for (int i = GLITCH_INTERP_LINEAR; i <= GLITCH_INTERP_SINC; i++) {
+    glitch_interpolation((enum glitch_interp)i);
+    GLITCH_TEST("smp1(0, 1, -12)") {
+      ASSERT(glitch_eval(g) == 0);
+      float v = glitch_eval(g);
+      ASSERT(v == half[i] || (half[i] == 0 && v > 0.2f && v < 0.4f));
+      ASSERT(glitch_eval(g) == 0.5f);
+    }
+  }
+  glitch_interpolation(GLITCH_INTERP_CUBIC);
+  glitch_set_loader(NULL);
+}
+
+static void test_funcs() {
+  printf("TEST: expr_func()\n");
+  /* No fixed limit on the number of sample functions */
+  static char names[2000][8];
+  for (int i = 0; i < 2000; i++) {
+    snprintf(names[i], sizeof(names[i]), "smp%d", i);
+    ASSERT(glitch_add_sample_func(names[i]) == 0);
+  }
+  ASSERT(glitch_add_sample_func("sin") == -1);
+  ASSERT(glitch_add_sample_func(names[0]) == -1);
+  struct expr_func_list *funcs = glitch_func_list();
+  ASSERT(expr_func(funcs, "smp1999", 7)->f == lib_sample);
+  ASSERT(expr_func(funcs, "sin", 3)->f == lib_sin);
+  ASSERT(expr_func(funcs, "smp2000", 7) == NULL);
+  ASSERT(expr_func(funcs, "si", 2) == NULL);
+  struct glitch *g = glitch_create();
+  ASSERT(glitch_compile(g, "smp1234(0)", 10) == 0);
+  ASSERT(glitch_compile(g, "smp2000(0)", 10) != 0);
+  glitch_destroy(g);
+  test_sample_loader();
+
+  /* Macros are looked up by name, the latest definition wins */
+  GLITCH_TEST("$(f, $1*2), $(h, $1+1), $(f, $1*3), f(h(1))") {
+    ASSERT(glitch_eval(g) == 6);
+  }
+}
+
+static void test_optimize() {
+  printf("TEST: expr_optimize()\n");
+  struct glitch *g = glitch_create();
+  struct expr *e;
+
+  /* Constants and pure functions are folded */
+  ASSERT(glitch_compile(g, "hz(A4)+1/2+8", 12) == 0);
+  e = g->next->e;
+  ASSERT(e->type == OP_CONST && e->param.num.value == 448.5f);
+  ASSERT(glitch_compile(g, "tr808(BD, scale(2, 1))", 22) == 0);
+  e = g->next->e;
+  ASSERT(e->type == OP_FUNC);
+  ASSERT(vec_nth(&e->param.func.args, 0).type == OP_CONST);
+  ASSERT(vec_nth(&e->param.func.args, 1).type == OP_CONST);
+
+  /* Functions with state, random numbers and host variables stay */
+  ASSERT(glitch_compile(g, "sin(440)+r(2)+t", 15) == 0);
+  e = g->next->e;
+  ASSERT(e->type == OP_PLUS);
+
+  /* Cheaper operators give the same results */
+  ASSERT(glitch_compile(g, "t/4", 3) == 0);
+  e = g->next->e;
+  ASSERT(e->type == OP_MULTIPLY &&
+         vec_nth(&e->param.op.args, 1).param.num.value == 0.25f);
+  ASSERT(glitch_compile(g, "t/3", 3) == 0);
+  ASSERT(g->next->e->type == OP_DIVIDE);
+  ASSERT(glitch_compile(g, "t**2", 4) == 0);
+  ASSERT(g->next->e->type == OP_MULTIPLY);
+  ASSERT(glitch_compile(g, "t*1/1-0", 7) == 0);
+  ASSERT(g->next->e->type == OP_VAR);
+  ASSERT(glitch_compile(g, "seq(60, (1, 2))", 15) == 0);
+  e = &vec_nth(&g->next->e->param.func.args, 1);
+  ASSERT(e->type == OP_COMMA);
+
+  /* Constants that a script assigns are variables from then on */
+  ASSERT(glitch_compile(g, "each(C4, C4, 1, 2)", 18) == 0);
+  ASSERT(glitch_compile(g, "C4", 2) == 0);
+  ASSERT(g->next->e->type == OP_VAR);
+  ASSERT(glitch_compile(g, "A4=A4+1", 7) == 0);
+  ASSERT(g->next->e->type == OP_ASSIGN);
+  ASSERT(glitch_compile(g, "A4", 2) == 0);
+  ASSERT(g->next->e->type == OP_VAR);
+  glitch_destroy(g);
+}
+
+static void test_bytecode() {
+  printf("TEST: expr_run()\n");
+
+  /* Bytecode and native code must produce the same samples as the tree
+   * walker */
+  const char *scripts[] = {
+      "-t + !(t&1) + ^t + t**0.5 + t/3 + t%7 - (t<<1) + (t>>2)",
+      "(t<5) + (t<=5) + (t>5) + (t>=5) + (t==5) + (t!=5) + (t|3) + (t^3)",
+      "(t&1)&&(t&2) + ((t&1)||(t&2)) + (0||t%3) + (x&&t) + (x||t)",
+      "x=t*2, y=x+1, z, x*y",
+      "byte(t*(t>>10&42))",
+      "lpf(saw(hz(seq(480,0,3,7))), 800+400*sin(2))",
+      "a(i=i+1,1,2,3,4)",
+      "each((k, v), v*sin(hz(k)), (k0, v0), (k1, v1))",
+      "x=t%8, hz(x)+hz(x)*2+(t&1 && hz(x+1))+hz(x+1)+(x=x+1)+hz(x)+(t%8)",
+      "y=hz(t%8), a(x=x+1,1,2)+x+hz(t%8)+(t&2 || (x=5))+x+y",
+  };
+  for (unsigned int i = 0; i < sizeof(scripts) / sizeof(scripts[0]); i++) {
+    struct glitch *a = glitch_create();
+    struct glitch *b = glitch_create();
+    struct glitch *c = glitch_create();
+    ASSERT(glitch_compile(a, scripts[i], strlen(scripts[i])) == 0);
+    ASSERT(glitch_compile(b, scripts[i], strlen(scripts[i])) == 0);
+    ASSERT(glitch_compile(c, scripts[i], strlen(scripts[i])) == 0);
+    ASSERT(b->next->prog != NULL && c->next->prog != NULL);
+#ifdef EXPR_JIT
+    ASSERT(c->next->prog->native != NULL);
+#endif
+    /* Hosts rendering in blocks never run it */
+    struct glitch *d = glitch_create();
+    d->blocks = 1;
+    ASSERT(glitch_compile(d, scripts[i], strlen(scripts[i])) == 0);
+    ASSERT(d->next->prog != NULL && d->next->prog->native == NULL);
+    glitch_destroy(d);
+    expr_prog_destroy(a->next->prog);
+    a->next->prog = NULL;
+    expr_jit_release(b->next->prog);
+    glitch_midi(a, 0x90, 69, 100);
+    glitch_midi(b, 0x90, 69, 100);
+    glitch_midi(c, 0x90, 69, 100);
+    for (int j = 0; j < 10000; j++) {
+      float u = glitch_eval(a);
+      float v = glitch_eval(b);
+      float w = glitch_eval(c);
+      if (u != v || u != w) {
+        printf("%s: frame %d: %f != %f != %f\n", scripts[i], j, u, v, w);
+        ASSERT(u == v && u == w);
+        break;
+      }
+    }
+    glitch_destroy(a);
+    glitch_destroy(b);
+    glitch_destroy(c);
+  }
+
+  /* Repeated pure subexpressions are computed once, stateful ones are not */
+  struct glitch *g = glitch_create();
+  const char *s = "hz(t%8)*2 + hz(t%8)*2 + sin(hz(t%8)) + sin(hz(t%8))";
+  ASSERT(glitch_compile(g, s, strlen(s)) == 0);
+  int calls = 0, loads = 0;
+  for (int i = 0; i < g->next->prog->len; i++) {
+    calls = calls + (g->next->prog->code[i].op == EXPR_OP_CALLB);
+    loads = loads + (g->next->prog->code[i].op == EXPR_OP_LOAD);
+  }
+  ASSERT(calls == 3);
+  ASSERT(loads == 1);
+  glitch_destroy(g);
+}
+
+enum { BENCH_TREE, BENCH_BYTECODE, BENCH_NATIVE, BENCH_BLOCK };
+
+static double benchmark(const char *s, int mode) {
   struct timeval t;
   gettimeofday(&t, NULL);
   double start = t.tv_sec + t.tv_usec * 1e-6;
@@ -358,22 +1246,156 @@ static void test_benchmark(const char *s) {
   if (g == NULL) {
     printf("FAIL: glitch instance can't be created\n");
     status = 1;
-    return;
+    return 0;
   }
   if (glitch_compile(g, s, strlen(s)) != 0) {
     printf("FAIL: %s can't be compiled\n", s);
     status = 1;
-    return;
+    return 0;
+  }
+  if (mode == BENCH_TREE) {
+    expr_prog_destroy(g->next->prog);
+    g->next->prog = NULL;
+  } else if (mode == BENCH_BYTECODE) {
+    expr_jit_release(g->next->prog);
   }
   long N = 1000000L;
-  for (long i = 0; i < N; i++) {
-    glitch_eval(g);
+  if (mode == BENCH_BLOCK) {
+    float buf[1024];
+    for (long i = 0; i < N; i += 1024) {
+      glitch_eval_block(g, buf, 1024);
+    }
+  } else {
+    for (long i = 0; i < N; i++) {
+      glitch_eval(g);
+    }
   }
   gettimeofday(&t, NULL);
   double end = t.tv_sec + t.tv_usec * 1e-6;
   glitch_destroy(g);
-  double ns = 1000000000 * (end - start) / N;
-  printf("BENCH %40s:\t%f ns/op (%dM op/sec)\n", s, ns, (int)(1000 / ns));
+  return 1000000000 * (end - start) / N;
+}
+
+static void test_benchmark(const char *s) {
+  double tree = benchmark(s, BENCH_TREE);
+  double bytecode = benchmark(s, BENCH_BYTECODE);
+  double ns = benchmark(s, BENCH_NATIVE);
+  double block = benchmark(s, BENCH_BLOCK);
+  printf("BENCH %40s:\t%f ns/op (%dM op/sec)\t%f ns/op (tree)\t%f ns/op "
+         "(bytecode)\t%f ns/op (block)\n",
+         s, ns, (int)(1000 / ns), tree, bytecode, block);
+}
+
+/* Compiles a 1MB generated script, one long sequence per line */
+static void test_compile_benchmark() {
+  const size_t size = 1 << 20;
+  char *s = malloc(size + 256);
+  size_t len = 0;
+  for (int i = 0; len < size; i++) {
+    len += sprintf(s + len, "x%d=seq(120", i % 4096);
+    for (int j = 0; j < 32; j++) {
+      len += sprintf(s + len, ",(0.5,%d.25),x%d+%d", j, (i + j) % 4096, j);
+    }
+    len += sprintf(s + len, ")*0.5 # step %d\n", i);
+  }
+  struct glitch *g = glitch_create();
+  const int N = 5;
+  struct timeval t;
+  gettimeofday(&t, NULL);
+  double start = t.tv_sec + t.tv_usec * 1e-6;
+  for (int i = 0; i < N; i++) {
+    ASSERT(glitch_compile(g, s, len) == 0);
+  }
+  gettimeofday(&t, NULL);
+  double end = t.tv_sec + t.tv_usec * 1e-6;
+  glitch_destroy(g);
+  free(s);
+  printf("BENCH %40s:\t%f ms/op (%f MB/sec)\n", "compile 1MB script",
+         1000 * (end - start) / N, N * len / (end - start) / (1 << 20));
+}
+
+/* The tables math_lut.h used to provide, rebuilt here for comparison */
+static float lut_sin_table[5001];
+static float lut_pow_table[481];
+
+static float lut_sin(float x) {
+  return isnan(x) ? NAN : lut_sin_table[(int)(x * 5000)];
+}
+
+static float lut_pow2(float n) {
+  if (isnan(n) || n < -5 || n > 5) {
+    return NAN;
+  }
+  return lut_pow_table[(int)((n + 5) / 0.020833f)];
+}
+
+static float lut_log2(float n) { return logf(n) / logf(2); }
+static float libm_pow2(float n) { return powf(2.f, n); }
+static float libm_sin(float n) { return sinf(n * 2 * PI); }
+
+static double math_time() {
+  struct timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec + t.tv_usec * 1e-6;
+}
+
+#define MATH_N 4096
+#define MATH_ROUNDS 256
+
+/* Times f over the inputs and reports the largest error against ref */
+static void math_benchmark(const char *name, float (*f)(float),
+                           void (*block)(const float *, float *, int),
+                           double (*ref)(double), float lo, float hi) {
+  static float x[MATH_N], out[MATH_N];
+  volatile float sink = 0;
+  for (int i = 0; i < MATH_N; i++) {
+    x[i] = lo + (hi - lo) * i / MATH_N;
+  }
+  double start = math_time();
+  for (int r = 0; r < MATH_ROUNDS; r++) {
+    if (block != NULL) {
+      for (int i = 0; i < MATH_N; i += EXPR_BLOCK_SIZE) {
+        block(x + i, out + i, EXPR_BLOCK_SIZE);
+      }
+    } else {
+      for (int i = 0; i < MATH_N; i++) {
+        out[i] = f(x[i]);
+      }
+    }
+    sink = sink + out[r];
+  }
+  double ns = 1e9 * (math_time() - start) / MATH_N / MATH_ROUNDS;
+  double err = 0;
+  for (int i = 0; i < MATH_N; i++) {
+    double y = ref(x[i]);
+    double e = fabs(out[i] - y) / fmax(1, fabs(y));
+    err = (e > err || isnan(e) ? e : err);
+  }
+  printf("BENCH %40s:\t%f ns/op\t%g max error\n", name, ns, err);
+}
+
+static void test_math_benchmark() {
+  for (int i = 0; i <= 5000; i++) {
+    lut_sin_table[i] = sin(2 * PI * i / 5000);
+  }
+  for (int i = 0; i <= 480; i++) {
+    lut_pow_table[i] = pow(2, -5 + i * 10 / 480.0);
+  }
+  math_benchmark("exp2, [-5, 5], lut", lut_pow2, NULL, exp2, -5, 5);
+  math_benchmark("exp2, [-5, 5], libm", libm_pow2, NULL, exp2, -5, 5);
+  math_benchmark("exp2, [-5, 5], fast", fast_exp2, NULL, exp2, -5, 5);
+  math_benchmark("exp2, [-5, 5], fast block", NULL, fast_exp2_block, exp2, -5,
+                 5);
+  math_benchmark("log2, [0.01, 100], lut/libm", lut_log2, NULL, log2, 0.01,
+                 100);
+  math_benchmark("log2, [0.01, 100], fast", fast_log2, NULL, log2, 0.01, 100);
+  math_benchmark("log2, [0.01, 100], fast block", NULL, fast_log2_block, log2,
+                 0.01, 100);
+  math_benchmark("sin, [0, 1), lut", lut_sin, NULL, ref_sin, 0, 1);
+  math_benchmark("sin, [0, 1), libm", libm_sin, NULL, ref_sin, 0, 1);
+  math_benchmark("sin, [0, 1), fast", fast_sin, NULL, ref_sin, 0, 1);
+  math_benchmark("sin, [0, 1), fast block", NULL, fast_sin_block, ref_sin, 0,
+                 1);
 }
 
 static void run_benchmarks() {
@@ -403,6 +1425,13 @@ static void run_benchmarks() {
   test_benchmark("bpf(saw(440))");
   test_benchmark("bsf(saw(440))");
   test_benchmark("delay(piano(seq(120,440)),0.1,0.5,0.5)");
+  test_benchmark("lpf(saw(hz(seq(480,0,3,7))),hz(seq(120,0,7))*2,1+x)");
+
+  printf("\n## Bytebeat\n");
+  test_benchmark("byte(t*(t>>10&42))");
+  test_benchmark("byte(t*((t>>12|t>>8)&63&t>>4))");
+  test_benchmark("byte((t*5&t>>7)|(t*3&t>>10))");
+  test_benchmark("byte(t%256 ^ (t>>6)%7 << 4)");
 
   printf("\n## Utils\n");
   test_benchmark("hz(A4)");
@@ -414,6 +1443,13 @@ static void run_benchmarks() {
   test_benchmark("each(f,sin(f),220,440,880,110)/4");
   test_benchmark("delay(sin(440),0.25,0.5,0.5)");
   test_benchmark("delay(sin(440),0.25+sin(4)/10,0.5,0.5)");
+  test_benchmark("taps(sin(440),0.5,0.1,0.5,0.15,0.4,0.25,0.3)");
+
+  printf("\n## Math\n");
+  test_math_benchmark();
+
+  printf("\n## Compiler\n");
+  test_compile_benchmark();
 }
 
 int main() {
@@ -423,9 +1459,25 @@ int main() {
   test_s();
   test_a();
   test_osc();
+  test_pluck();
+  test_tr808();
+  test_math();
   test_seq();
   test_env();
+  test_filter();
   test_delay();
+  test_eval_block();
+  test_rates();
+  test_ints();
+  test_shared();
+  test_midi();
+  test_bytecode();
+  test_optimize();
+  test_vars();
+  test_parse();
+  test_reclaim();
+  test_prepared();
+  test_funcs();
 
   run_benchmarks();
 
@@ -1,4 +1,6 @@
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -10,6 +12,10 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
 
 #include "vendor/oscpkt.hh"
 #include "vendor/udp.hh"
@@ -33,56 +39,92 @@ extern "C" {
 struct wav_sample {
   const char *path;
   const char *name;
-  int16_t *data;
-  size_t len;
+  struct wav_map map;
+  struct glitch_sample sample;
+  int queued; /* set atomically once, when the loader is first asked */
 };
 
 static vec(wav_sample) CACHE = {0};
 
-static struct wav_sample *cache_find(const char *name, int variant) {
-  int i;
-  int start = -1;
-  struct wav_sample it;
+/*
+ * Sample functions by name, an open addressing hash table of the runs of
+ * variants in the sorted CACHE. It is built once in load_samples() and only
+ * read afterwards.
+ */
+struct sample_bank {
+  const char *name;
+  int first;
+  int count;
+};
 
-  vec_foreach(&CACHE, it, i) {
-    if (strcmp(name, it.name) == 0) {
-      start = i;
-      break;
-    }
+static vec(sample_bank) BANKS = {0};
+
+/*
+ * Samples are mapped by a background thread. The loader only flags them and
+ * counts the requests, the thread polls for them and publishes each sample by
+ * setting its ready flag once its pages are resident.
+ */
+static unsigned int samplesQueued = 0;
+static uint32_t samplesRate = 0; /* audio rate to convert to, if known */
+
+static unsigned int bank_hash(const char *s) {
+  unsigned int h = 2166136261u;
+  for (; *s; s++) {
+    h = (h ^ (unsigned char)*s) * 16777619u;
   }
-  if (start == -1) {
+  return h;
+}
+
+static struct sample_bank *bank_find(const char *name) {
+  if (vec_len(&BANKS) == 0) {
     return NULL;
   }
-  for (i = start; i < vec_len(&CACHE); i++) {
-    struct wav_sample *w = &vec_nth(&CACHE, i);
-    if (strcmp(name, w->name) != 0) {
-      return NULL;
-    }
-    if (i == start + variant) {
-      return w;
+  unsigned int mask = vec_len(&BANKS) - 1;
+  for (unsigned int i = bank_hash(name) & mask;; i = (i + 1) & mask) {
+    struct sample_bank *b = &vec_nth(&BANKS, i);
+    if (b->name == NULL || strcmp(b->name, name) == 0) {
+      return b->name == NULL ? NULL : b;
     }
   }
-  return NULL;
 }
 
-static float sample_loader(const char *name, int variant, int frame) {
-  struct wav_sample *sample = cache_find(name, variant);
-  if (sample == NULL) {
-    return NAN;
+static const struct glitch_sample *sample_loader(const char *name,
+                                                 int variant) {
+  struct sample_bank *bank = bank_find(name);
+  if (bank == NULL || variant < 0 || variant >= bank->count) {
+    return NULL;
   }
-  if (sample->data == NULL) {
-    FILE *f = wav_open(sample->path, &sample->len);
-    if (f == NULL) {
-      return NAN;
-    }
-    sample->data = (int16_t *)malloc(sample->len * sizeof(int16_t));
-    wav_read(f, sample->data, sample->len);
-    wav_close(f);
+  struct wav_sample *w = &vec_nth(&CACHE, bank->first + variant);
+  if (__atomic_exchange_n(&w->queued, 1, __ATOMIC_ACQ_REL) == 0) {
+    __atomic_add_fetch(&samplesQueued, 1, __ATOMIC_RELEASE);
   }
-  if (frame < sample->len) {
-    return sample->data[frame] * 1.0f / 0x8000;
+  return &w->sample;
+}
+
+static void sample_prefetch_loop() {
+  unsigned int loaded = 0;
+  for (;;) {
+    unsigned int queued = __atomic_load_n(&samplesQueued, __ATOMIC_ACQUIRE);
+    for (int i = 0; loaded != queued && i < vec_len(&CACHE); i++) {
+      struct wav_sample *w = &vec_nth(&CACHE, i);
+      if (__atomic_load_n(&w->queued, __ATOMIC_ACQUIRE) && !w->sample.ready) {
+        /* A file that can not be read is published as an empty sample */
+        uint32_t rate = __atomic_load_n(&samplesRate, __ATOMIC_ACQUIRE);
+        if (wav_map_open(w->path, rate, &w->map) == 0) {
+          wav_map_prefetch(&w->map);
+          w->sample.data = w->map.data;
+          w->sample.len = w->map.len;
+          w->sample.rate = w->map.rate;
+        }
+        __atomic_store_n(&w->sample.ready, 1, __ATOMIC_RELEASE);
+        loaded++;
+      }
+    }
+    /* Polled rather than woken, mingw builds have no condition variables */
+    if (loaded == __atomic_load_n(&samplesQueued, __ATOMIC_ACQUIRE)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
   }
-  return NAN;
 }
 
 static int wav_sample_sort(const void *a, const void *b) {
@@ -91,6 +133,32 @@ static int wav_sample_sort(const void *a, const void *b) {
   return strcmp(wa->path, wb->path);
 }
 
+/* Indexes the sorted CACHE, table size is a power of two at most half full */
+static void index_samples() {
+  int cap = 16;
+  while (cap < vec_len(&CACHE) * 2) {
+    cap = cap * 2;
+  }
+  struct sample_bank empty = {NULL, 0, 0};
+  for (int i = 0; i < cap; i++) {
+    vec_push(&BANKS, empty);
+  }
+  for (int i = 0; i < vec_len(&CACHE);) {
+    const char *name = vec_nth(&CACHE, i).name;
+    unsigned int j = bank_hash(name) & (cap - 1);
+    while (vec_nth(&BANKS, j).name != NULL) {
+      j = (j + 1) & (cap - 1);
+    }
+    struct sample_bank *b = &vec_nth(&BANKS, j);
+    b->name = name;
+    b->first = i;
+    while (i < vec_len(&CACHE) && strcmp(vec_nth(&CACHE, i).name, name) == 0) {
+      b->count++;
+      i++;
+    }
+  }
+}
+
 static void load_samples() {
   struct dirent *e;
 
@@ -120,7 +188,7 @@ static void load_samples() {
           char path[PATH_MAX];
           snprintf(dirpath, PATH_MAX - 1, "%s/%s/%s", SAMPLES_DIR, it,
                    dirent->d_name);
-          struct wav_sample sample = {strdup(dirpath), strdup(it), NULL};
+          struct wav_sample sample = {strdup(dirpath), strdup(it)};
           vec_push(&CACHE, sample);
         }
       }
@@ -132,12 +200,16 @@ static void load_samples() {
 
   qsort(&vec_nth(&CACHE, 0), vec_len(&CACHE), sizeof(wav_sample),
         wav_sample_sort);
+  index_samples();
+  std::thread(sample_prefetch_loop).detach();
 }
 
 class Glitch {
 public:
   Glitch() {
     g = glitch_create();
+    g->wait_samples = 1;
+    g->blocks = 1;
     play("");
   }
 
@@ -165,8 +237,10 @@ public:
       params.deviceId = index;
       params.nChannels = numChannels;
       this->numChannels = numChannels;
+      this->sampleRate = sampleRate;
 
       glitch_sample_rate(sampleRate);
+      __atomic_store_n(&samplesRate, sampleRate, __ATOMIC_RELEASE);
 
       audio->openStream(&params, NULL, RTAUDIO_FLOAT32, sampleRate, &bufsz,
                         [](void *out, void *in, unsigned int frames, double t,
@@ -181,17 +255,19 @@ public:
                             }
                             return 0;
                           }
-                          g->m.lock();
-                          for (int i = 0; i < frames; i++) {
-                            float v = glitch_eval(g->g);
-                            for (int j = 0; j < g->numChannels; j++) {
-                              *buf++ = v;
+                          g->midiOrigin.store(now() - (double)g->g->frame /
+                                                          g->sampleRate);
+                          glitch_eval_block(g->g, buf, frames);
+                          /* Spread mono samples across channels in place */
+                          for (int i = frames - 1; i >= 0; i--) {
+                            for (int j = g->numChannels - 1; j >= 0; j--) {
+                              buf[i * g->numChannels + j] = buf[i];
                             }
                           }
-                          g->m.unlock();
                           return 0;
                         },
                         this, &options);
+      midiLatency = bufsz;
       audio->startStream();
 
     } catch (RtAudioError &err) {
@@ -223,17 +299,17 @@ public:
     try {
       for (int i = 0; i < rt.getPortCount(); i++) {
         if (indices.empty() || indices.find(i) != indices.end()) {
-          RtMidiIn *m = new RtMidiIn();
-          m->openPort(i);
-          m->setCallback(
+          MidiInput *in = new MidiInput{this, new RtMidiIn(), 0, false};
+          midiInputs.push_back(in);
+          in->port->openPort(i);
+          in->port->setCallback(
               [](double time, std::vector<unsigned char> *msg, void *arg) {
-                Glitch *g = (Glitch *)arg;
+                MidiInput *in = (MidiInput *)arg;
                 if (msg->size() == 3) {
-                  g->midi(msg->at(0), msg->at(1), msg->at(2));
+                  in->g->midi(in, time, msg->at(0), msg->at(1), msg->at(2));
                 }
               },
-              this);
-          midiInputs.push_back(m);
+              in);
         }
       }
     } catch (RtAudioError &err) {
@@ -246,30 +322,73 @@ public:
 
   void closeMIDI() {
     m.lock();
-    for (auto m : midiInputs) {
-      m->closePort();
-      delete m;
+    for (auto in : midiInputs) {
+      in->port->closePort();
+      delete in->port;
+      delete in;
     }
     midiInputs.clear();
     m.unlock();
   }
 
+  /* Compiles without blocking the audio callback, the new script is handed
+   * over lock-free and picked up on the next beat */
   int play(std::string s) {
-    m.lock();
+    compiler.lock();
     int r = glitch_compile(g, s.c_str(), s.length());
     if (r == 0) {
       currentScript = s;
     }
-    m.unlock();
+    compiler.unlock();
     return r;
   }
 
-  void midi(unsigned char cmd, unsigned char a, unsigned char b) {
-    m.lock();
-    glitch_midi(g, cmd, a, b);
-    m.unlock();
+  /* Frees the scripts that the audio callback has replaced */
+  void reclaim() {
+    compiler.lock();
+    glitch_reclaim(g);
+    compiler.unlock();
   }
 
+private:
+  struct MidiInput {
+    Glitch *g;
+    RtMidiIn *port;
+    double time; /* clock time of the last message */
+    bool started;
+  };
+
+  static double now() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+  }
+
+  /* Queues the message at the frame it has been received at, one buffer
+   * later, so that notes keep their timing within the buffer */
+  void midi(MidiInput *in, double delta, unsigned char cmd, unsigned char a,
+            unsigned char b) {
+    double t = now();
+    double latency = (double)midiLatency / sampleRate;
+    /* RtMidi passes the time since the previous message of the port. Stamps
+     * are accumulated, but never run ahead of the clock or fall behind by more
+     * than a buffer */
+    in->time = (in->started ? in->time + delta : t);
+    in->started = true;
+    if (in->time > t || t - in->time > latency) {
+      in->time = t;
+    }
+    double origin = midiOrigin.load();
+    long frame = 0;
+    if (!std::isnan(origin)) {
+      frame = (long)((in->time - origin) * sampleRate) + midiLatency;
+    }
+    midiQueue.lock();
+    glitch_midi_at(g, frame, cmd, a, b);
+    midiQueue.unlock();
+  }
+
+public:
+
   static std::vector<std::string> listAudio() {
     std::vector<std::string> devices;
     try {
@@ -300,11 +419,16 @@ public:
 
 private:
   std::recursive_mutex m;
+  std::mutex compiler; /* serializes glitch_compile() and glitch_reclaim() */
+  std::mutex midiQueue; /* serializes MIDI input threads, never audio */
+  std::atomic<double> midiOrigin{NAN}; /* clock time of frame zero */
+  unsigned int midiLatency = 0;        /* frames */
+  unsigned int sampleRate = 44100;
   std::string currentScript;
   unsigned int numChannels;
   struct glitch *g = NULL;
   RtAudio *audio = NULL;
-  std::vector<RtMidiIn *> midiInputs;
+  std::vector<MidiInput *> midiInputs;
 };
 
 static void serverSendResult(oscpkt::UdpSocket *s, std::string uri, int r) {
@@ -342,7 +466,8 @@ static void serverLoop(oscpkt::UdpSocket *s) {
   Glitch g;
 
   while (s->isOk()) {
-    if (s->receiveNextPacket()) {
+    g.reclaim();
+    if (s->receiveNextPacket(1000)) { // timeout, ms
       oscpkt::PacketReader pr;
       pr.init(s->packetData(), s->packetSize());
       oscpkt::Message *msg;
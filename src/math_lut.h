@@ -1,5511 +0,0 @@
-#ifndef MATH_LUT_H
-#define MATH_LUT_H
-static float sin_lut[] = {
-  0.0000000000, /* sin(0.00000) */
-  0.0012566367, /* sin(0.00020) */
-  0.0025132714, /* sin(0.00040) */
-  0.0037699021, /* sin(0.00060) */
-  0.0050265268, /* sin(0.00080) */
-  0.0062831437, /* sin(0.00100) */
-  0.0075397506, /* sin(0.00120) */
-  0.0087963456, /* sin(0.00140) */
-  0.0100529267, /* sin(0.00160) */
-  0.0113094919, /* sin(0.00180) */
-  0.0125660393, /* sin(0.00200) */
-  0.0138225668, /* sin(0.00220) */
-  0.0150790725, /* sin(0.00240) */
-  0.0163355544, /* sin(0.00260) */
-  0.0175920105, /* sin(0.00280) */
-  0.0188484388, /* sin(0.00300) */
-  0.0201048374, /* sin(0.00320) */
-  0.0213612042, /* sin(0.00340) */
-  0.0226175372, /* sin(0.00360) */
-  0.0238738346, /* sin(0.00380) */
-  0.0251300942, /* sin(0.00400) */
-  0.0263863142, /* sin(0.00420) */
-  0.0276424925, /* sin(0.00440) */
-  0.0288986272, /* sin(0.00460) */
-  0.0301547162, /* sin(0.00480) */
-  0.0314107576, /* sin(0.00500) */
-  0.0326667494, /* sin(0.00520) */
-  0.0339226896, /* sin(0.00540) */
-  0.0351785762, /* sin(0.00560) */
-  0.0364344073, /* sin(0.00580) */
-  0.0376901809, /* sin(0.00600) */
-  0.0389458949, /* sin(0.00620) */
-  0.0402015474, /* sin(0.00640) */
-  0.0414571365, /* sin(0.00660) */
-  0.0427126601, /* sin(0.00680) */
-  0.0439681162, /* sin(0.00700) */
-  0.0452235029, /* sin(0.00720) */
-  0.0464788182, /* sin(0.00740) */
-  0.0477340601, /* sin(0.00760) */
-  0.0489892266, /* sin(0.00780) */
-  0.0502443158, /* sin(0.00800) */
-  0.0514993256, /* sin(0.00820) */
-  0.0527542541, /* sin(0.00840) */
-  0.0540090992, /* sin(0.00860) */
-  0.0552638591, /* sin(0.00880) */
-  0.0565185318, /* sin(0.00900) */
-  0.0577731151, /* sin(0.00920) */
-  0.0590276073, /* sin(0.00940) */
-  0.0602820062, /* sin(0.00960) */
-  0.0615363100, /* sin(0.00980) */
-  0.0627905165, /* sin(0.01000) */
-  0.0640446239, /* sin(0.01020) */
-  0.0652986302, /* sin(0.01040) */
-  0.0665525334, /* sin(0.01060) */
-  0.0678063314, /* sin(0.01080) */
-  0.0690600224, /* sin(0.01100) */
-  0.0703136043, /* sin(0.01120) */
-  0.0715670752, /* sin(0.01140) */
-  0.0728204331, /* sin(0.01160) */
-  0.0740736760, /* sin(0.01180) */
-  0.0753268019, /* sin(0.01200) */
-  0.0765798089, /* sin(0.01220) */
-  0.0778326949, /* sin(0.01240) */
-  0.0790854580, /* sin(0.01260) */
-  0.0803380963, /* sin(0.01280) */
-  0.0815906077, /* sin(0.01300) */
-  0.0828429902, /* sin(0.01320) */
-  0.0840952419, /* sin(0.01340) */
-  0.0853473608, /* sin(0.01360) */
-  0.0865993450, /* sin(0.01380) */
-  0.0878511923, /* sin(0.01400) */
-  0.0891029010, /* sin(0.01420) */
-  0.0903544689, /* sin(0.01440) */
-  0.0916058942, /* sin(0.01460) */
-  0.0928571748, /* sin(0.01480) */
-  0.0941083088, /* sin(0.01500) */
-  0.0953592942, /* sin(0.01520) */
-  0.0966101290, /* sin(0.01540) */
-  0.0978608112, /* sin(0.01560) */
-  0.0991113389, /* sin(0.01580) */
-  0.1003617100, /* sin(0.01600) */
-  0.1016119227, /* sin(0.01620) */
-  0.1028619750, /* sin(0.01640) */
-  0.1041118648, /* sin(0.01660) */
-  0.1053615902, /* sin(0.01680) */
-  0.1066111492, /* sin(0.01700) */
-  0.1078605398, /* sin(0.01720) */
-  0.1091097602, /* sin(0.01740) */
-  0.1103588082, /* sin(0.01760) */
-  0.1116076820, /* sin(0.01780) */
-  0.1128563795, /* sin(0.01800) */
-  0.1141048988, /* sin(0.01820) */
-  0.1153532379, /* sin(0.01840) */
-  0.1166013948, /* sin(0.01860) */
-  0.1178493677, /* sin(0.01880) */
-  0.1190971544, /* sin(0.01900) */
-  0.1203447531, /* sin(0.01920) */
-  0.1215921617, /* sin(0.01940) */
-  0.1228393783, /* sin(0.01960) */
-  0.1240864009, /* sin(0.01980) */
-  0.1253332276, /* sin(0.02000) */
-  0.1265798563, /* sin(0.02020) */
-  0.1278262852, /* sin(0.02040) */
-  0.1290725122, /* sin(0.02060) */
-  0.1303185354, /* sin(0.02080) */
-  0.1315643528, /* sin(0.02100) */
-  0.1328099624, /* sin(0.02120) */
-  0.1340553624, /* sin(0.02140) */
-  0.1353005506, /* sin(0.02160) */
-  0.1365455252, /* sin(0.02180) */
-  0.1377902841, /* sin(0.02200) */
-  0.1390348255, /* sin(0.02220) */
-  0.1402791473, /* sin(0.02240) */
-  0.1415232475, /* sin(0.02260) */
-  0.1427671243, /* sin(0.02280) */
-  0.1440107757, /* sin(0.02300) */
-  0.1452541996, /* sin(0.02320) */
-  0.1464973942, /* sin(0.02340) */
-  0.1477403574, /* sin(0.02360) */
-  0.1489830873, /* sin(0.02380) */
-  0.1502255820, /* sin(0.02400) */
-  0.1514678394, /* sin(0.02420) */
-  0.1527098576, /* sin(0.02440) */
-  0.1539516347, /* sin(0.02460) */
-  0.1551931687, /* sin(0.02480) */
-  0.1564344576, /* sin(0.02500) */
-  0.1576754995, /* sin(0.02520) */
-  0.1589162923, /* sin(0.02540) */
-  0.1601568343, /* sin(0.02560) */
-  0.1613971233, /* sin(0.02580) */
-  0.1626371574, /* sin(0.02600) */
-  0.1638769348, /* sin(0.02620) */
-  0.1651164533, /* sin(0.02640) */
-  0.1663557111, /* sin(0.02660) */
-  0.1675947062, /* sin(0.02680) */
-  0.1688334367, /* sin(0.02700) */
-  0.1700719005, /* sin(0.02720) */
-  0.1713100958, /* sin(0.02740) */
-  0.1725480205, /* sin(0.02760) */
-  0.1737856728, /* sin(0.02780) */
-  0.1750230507, /* sin(0.02800) */
-  0.1762601521, /* sin(0.02820) */
-  0.1774969752, /* sin(0.02840) */
-  0.1787335180, /* sin(0.02860) */
-  0.1799697786, /* sin(0.02880) */
-  0.1812057550, /* sin(0.02900) */
-  0.1824414452, /* sin(0.02920) */
-  0.1836768474, /* sin(0.02940) */
-  0.1849119595, /* sin(0.02960) */
-  0.1861467796, /* sin(0.02980) */
-  0.1873813057, /* sin(0.03000) */
-  0.1886155359, /* sin(0.03020) */
-  0.1898494683, /* sin(0.03040) */
-  0.1910831009, /* sin(0.03060) */
-  0.1923164317, /* sin(0.03080) */
-  0.1935494589, /* sin(0.03100) */
-  0.1947821804, /* sin(0.03120) */
-  0.1960145943, /* sin(0.03140) */
-  0.1972466987, /* sin(0.03160) */
-  0.1984784916, /* sin(0.03180) */
-  0.1997099710, /* sin(0.03200) */
-  0.2009411352, /* sin(0.03220) */
-  0.2021719819, /* sin(0.03240) */
-  0.2034025095, /* sin(0.03260) */
-  0.2046327158, /* sin(0.03280) */
-  0.2058625990, /* sin(0.03300) */
-  0.2070921571, /* sin(0.03320) */
-  0.2083213882, /* sin(0.03340) */
-  0.2095502903, /* sin(0.03360) */
-  0.2107788615, /* sin(0.03380) */
-  0.2120070999, /* sin(0.03400) */
-  0.2132350035, /* sin(0.03420) */
-  0.2144625703, /* sin(0.03440) */
-  0.2156897985, /* sin(0.03460) */
-  0.2169166860, /* sin(0.03480) */
-  0.2181432311, /* sin(0.03500) */
-  0.2193694316, /* sin(0.03520) */
-  0.2205952858, /* sin(0.03540) */
-  0.2218207916, /* sin(0.03560) */
-  0.2230459471, /* sin(0.03580) */
-  0.2242707504, /* sin(0.03600) */
-  0.2254951995, /* sin(0.03620) */
-  0.2267192925, /* sin(0.03640) */
-  0.2279430276, /* sin(0.03660) */
-  0.2291664026, /* sin(0.03680) */
-  0.2303894158, /* sin(0.03700) */
-  0.2316120652, /* sin(0.03720) */
-  0.2328343488, /* sin(0.03740) */
-  0.2340562647, /* sin(0.03760) */
-  0.2352778111, /* sin(0.03780) */
-  0.2364989859, /* sin(0.03800) */
-  0.2377197872, /* sin(0.03820) */
-  0.2389402132, /* sin(0.03840) */
-  0.2401602618, /* sin(0.03860) */
-  0.2413799312, /* sin(0.03880) */
-  0.2425992194, /* sin(0.03900) */
-  0.2438181245, /* sin(0.03920) */
-  0.2450366446, /* sin(0.03940) */
-  0.2462547777, /* sin(0.03960) */
-  0.2474725220, /* sin(0.03980) */
-  0.2486898755, /* sin(0.04000) */
-  0.2499068362, /* sin(0.04020) */
-  0.2511234024, /* sin(0.04040) */
-  0.2523395719, /* sin(0.04060) */
-  0.2535553430, /* sin(0.04080) */
-  0.2547707137, /* sin(0.04100) */
-  0.2559856821, /* sin(0.04120) */
-  0.2572002462, /* sin(0.04140) */
-  0.2584144042, /* sin(0.04160) */
-  0.2596281541, /* sin(0.04180) */
-  0.2608414940, /* sin(0.04200) */
-  0.2620544221, /* sin(0.04220) */
-  0.2632669363, /* sin(0.04240) */
-  0.2644790347, /* sin(0.04260) */
-  0.2656907155, /* sin(0.04280) */
-  0.2669019768, /* sin(0.04300) */
-  0.2681128166, /* sin(0.04320) */
-  0.2693232330, /* sin(0.04340) */
-  0.2705332241, /* sin(0.04360) */
-  0.2717427880, /* sin(0.04380) */
-  0.2729519227, /* sin(0.04400) */
-  0.2741606265, /* sin(0.04420) */
-  0.2753688973, /* sin(0.04440) */
-  0.2765767332, /* sin(0.04460) */
-  0.2777841324, /* sin(0.04480) */
-  0.2789910930, /* sin(0.04500) */
-  0.2801976130, /* sin(0.04520) */
-  0.2814036905, /* sin(0.04540) */
-  0.2826093236, /* sin(0.04560) */
-  0.2838145105, /* sin(0.04580) */
-  0.2850192492, /* sin(0.04600) */
-  0.2862235377, /* sin(0.04620) */
-  0.2874273744, /* sin(0.04640) */
-  0.2886307571, /* sin(0.04660) */
-  0.2898336840, /* sin(0.04680) */
-  0.2910361532, /* sin(0.04700) */
-  0.2922381629, /* sin(0.04720) */
-  0.2934397111, /* sin(0.04740) */
-  0.2946407959, /* sin(0.04760) */
-  0.2958414154, /* sin(0.04780) */
-  0.2970415677, /* sin(0.04800) */
-  0.2982412510, /* sin(0.04820) */
-  0.2994404633, /* sin(0.04840) */
-  0.3006392028, /* sin(0.04860) */
-  0.3018374675, /* sin(0.04880) */
-  0.3030352555, /* sin(0.04900) */
-  0.3042325651, /* sin(0.04920) */
-  0.3054293942, /* sin(0.04940) */
-  0.3066257409, /* sin(0.04960) */
-  0.3078216035, /* sin(0.04980) */
-  0.3090169800, /* sin(0.05000) */
-  0.3102118685, /* sin(0.05020) */
-  0.3114062672, /* sin(0.05040) */
-  0.3126001741, /* sin(0.05060) */
-  0.3137935873, /* sin(0.05080) */
-  0.3149865050, /* sin(0.05100) */
-  0.3161789254, /* sin(0.05120) */
-  0.3173708464, /* sin(0.05140) */
-  0.3185622663, /* sin(0.05160) */
-  0.3197531831, /* sin(0.05180) */
-  0.3209435949, /* sin(0.05200) */
-  0.3221335000, /* sin(0.05220) */
-  0.3233228964, /* sin(0.05240) */
-  0.3245117822, /* sin(0.05260) */
-  0.3257001555, /* sin(0.05280) */
-  0.3268880145, /* sin(0.05300) */
-  0.3280753574, /* sin(0.05320) */
-  0.3292621821, /* sin(0.05340) */
-  0.3304484869, /* sin(0.05360) */
-  0.3316342699, /* sin(0.05380) */
-  0.3328195291, /* sin(0.05400) */
-  0.3340042629, /* sin(0.05420) */
-  0.3351884691, /* sin(0.05440) */
-  0.3363721461, /* sin(0.05460) */
-  0.3375552919, /* sin(0.05480) */
-  0.3387379046, /* sin(0.05500) */
-  0.3399199824, /* sin(0.05520) */
-  0.3411015235, /* sin(0.05540) */
-  0.3422825259, /* sin(0.05560) */
-  0.3434629878, /* sin(0.05580) */
-  0.3446429073, /* sin(0.05600) */
-  0.3458222826, /* sin(0.05620) */
-  0.3470011118, /* sin(0.05640) */
-  0.3481793930, /* sin(0.05660) */
-  0.3493571244, /* sin(0.05680) */
-  0.3505343041, /* sin(0.05700) */
-  0.3517109302, /* sin(0.05720) */
-  0.3528870010, /* sin(0.05740) */
-  0.3540625145, /* sin(0.05760) */
-  0.3552374689, /* sin(0.05780) */
-  0.3564118623, /* sin(0.05800) */
-  0.3575856930, /* sin(0.05820) */
-  0.3587589589, /* sin(0.05840) */
-  0.3599316583, /* sin(0.05860) */
-  0.3611037893, /* sin(0.05880) */
-  0.3622753501, /* sin(0.05900) */
-  0.3634463388, /* sin(0.05920) */
-  0.3646167536, /* sin(0.05940) */
-  0.3657865926, /* sin(0.05960) */
-  0.3669558539, /* sin(0.05980) */
-  0.3681245358, /* sin(0.06000) */
-  0.3692926364, /* sin(0.06020) */
-  0.3704601538, /* sin(0.06040) */
-  0.3716270862, /* sin(0.06060) */
-  0.3727934318, /* sin(0.06080) */
-  0.3739591887, /* sin(0.06100) */
-  0.3751243550, /* sin(0.06120) */
-  0.3762889289, /* sin(0.06140) */
-  0.3774529087, /* sin(0.06160) */
-  0.3786162924, /* sin(0.06180) */
-  0.3797790782, /* sin(0.06200) */
-  0.3809412643, /* sin(0.06220) */
-  0.3821028488, /* sin(0.06240) */
-  0.3832638300, /* sin(0.06260) */
-  0.3844242059, /* sin(0.06280) */
-  0.3855839747, /* sin(0.06300) */
-  0.3867431347, /* sin(0.06320) */
-  0.3879016839, /* sin(0.06340) */
-  0.3890596206, /* sin(0.06360) */
-  0.3902169429, /* sin(0.06380) */
-  0.3913736491, /* sin(0.06400) */
-  0.3925297371, /* sin(0.06420) */
-  0.3936852053, /* sin(0.06440) */
-  0.3948400519, /* sin(0.06460) */
-  0.3959942749, /* sin(0.06480) */
-  0.3971478726, /* sin(0.06500) */
-  0.3983008432, /* sin(0.06520) */
-  0.3994531848, /* sin(0.06540) */
-  0.4006048955, /* sin(0.06560) */
-  0.4017559737, /* sin(0.06580) */
-  0.4029064175, /* sin(0.06600) */
-  0.4040562250, /* sin(0.06620) */
-  0.4052053944, /* sin(0.06640) */
-  0.4063539240, /* sin(0.06660) */
-  0.4075018119, /* sin(0.06680) */
-  0.4086490563, /* sin(0.06700) */
-  0.4097956553, /* sin(0.06720) */
-  0.4109416073, /* sin(0.06740) */
-  0.4120869103, /* sin(0.06760) */
-  0.4132315626, /* sin(0.06780) */
-  0.4143755623, /* sin(0.06800) */
-  0.4155189077, /* sin(0.06820) */
-  0.4166615969, /* sin(0.06840) */
-  0.4178036281, /* sin(0.06860) */
-  0.4189449996, /* sin(0.06880) */
-  0.4200857095, /* sin(0.06900) */
-  0.4212257560, /* sin(0.06920) */
-  0.4223651374, /* sin(0.06940) */
-  0.4235038518, /* sin(0.06960) */
-  0.4246418974, /* sin(0.06980) */
-  0.4257792724, /* sin(0.07000) */
-  0.4269159751, /* sin(0.07020) */
-  0.4280520036, /* sin(0.07040) */
-  0.4291873562, /* sin(0.07060) */
-  0.4303220310, /* sin(0.07080) */
-  0.4314560263, /* sin(0.07100) */
-  0.4325893403, /* sin(0.07120) */
-  0.4337219711, /* sin(0.07140) */
-  0.4348539171, /* sin(0.07160) */
-  0.4359851763, /* sin(0.07180) */
-  0.4371157471, /* sin(0.07200) */
-  0.4382456276, /* sin(0.07220) */
-  0.4393748160, /* sin(0.07240) */
-  0.4405033107, /* sin(0.07260) */
-  0.4416311097, /* sin(0.07280) */
-  0.4427582113, /* sin(0.07300) */
-  0.4438846137, /* sin(0.07320) */
-  0.4450103152, /* sin(0.07340) */
-  0.4461353139, /* sin(0.07360) */
-  0.4472596082, /* sin(0.07380) */
-  0.4483831961, /* sin(0.07400) */
-  0.4495060760, /* sin(0.07420) */
-  0.4506282461, /* sin(0.07440) */
-  0.4517497045, /* sin(0.07460) */
-  0.4528704496, /* sin(0.07480) */
-  0.4539904796, /* sin(0.07500) */
-  0.4551097926, /* sin(0.07520) */
-  0.4562283869, /* sin(0.07540) */
-  0.4573462608, /* sin(0.07560) */
-  0.4584634125, /* sin(0.07580) */
-  0.4595798402, /* sin(0.07600) */
-  0.4606955422, /* sin(0.07620) */
-  0.4618105167, /* sin(0.07640) */
-  0.4629247619, /* sin(0.07660) */
-  0.4640382761, /* sin(0.07680) */
-  0.4651510575, /* sin(0.07700) */
-  0.4662631044, /* sin(0.07720) */
-  0.4673744149, /* sin(0.07740) */
-  0.4684849875, /* sin(0.07760) */
-  0.4695948202, /* sin(0.07780) */
-  0.4707039114, /* sin(0.07800) */
-  0.4718122593, /* sin(0.07820) */
-  0.4729198621, /* sin(0.07840) */
-  0.4740267181, /* sin(0.07860) */
-  0.4751328255, /* sin(0.07880) */
-  0.4762381827, /* sin(0.07900) */
-  0.4773427878, /* sin(0.07920) */
-  0.4784466391, /* sin(0.07940) */
-  0.4795497349, /* sin(0.07960) */
-  0.4806520734, /* sin(0.07980) */
-  0.4817536529, /* sin(0.08000) */
-  0.4828544717, /* sin(0.08020) */
-  0.4839545279, /* sin(0.08040) */
-  0.4850538200, /* sin(0.08060) */
-  0.4861523460, /* sin(0.08080) */
-  0.4872501044, /* sin(0.08100) */
-  0.4883470933, /* sin(0.08120) */
-  0.4894433110, /* sin(0.08140) */
-  0.4905387559, /* sin(0.08160) */
-  0.4916334261, /* sin(0.08180) */
-  0.4927273200, /* sin(0.08200) */
-  0.4938204358, /* sin(0.08220) */
-  0.4949127718, /* sin(0.08240) */
-  0.4960043262, /* sin(0.08260) */
-  0.4970950974, /* sin(0.08280) */
-  0.4981850836, /* sin(0.08300) */
-  0.4992742831, /* sin(0.08320) */
-  0.5003626942, /* sin(0.08340) */
-  0.5014503151, /* sin(0.08360) */
-  0.5025371442, /* sin(0.08380) */
-  0.5036231797, /* sin(0.08400) */
-  0.5047084199, /* sin(0.08420) */
-  0.5057928632, /* sin(0.08440) */
-  0.5068765077, /* sin(0.08460) */
-  0.5079593517, /* sin(0.08480) */
-  0.5090413937, /* sin(0.08500) */
-  0.5101226317, /* sin(0.08520) */
-  0.5112030643, /* sin(0.08540) */
-  0.5122826896, /* sin(0.08560) */
-  0.5133615059, /* sin(0.08580) */
-  0.5144395115, /* sin(0.08600) */
-  0.5155167048, /* sin(0.08620) */
-  0.5165930840, /* sin(0.08640) */
-  0.5176686474, /* sin(0.08660) */
-  0.5187433934, /* sin(0.08680) */
-  0.5198173202, /* sin(0.08700) */
-  0.5208904261, /* sin(0.08720) */
-  0.5219627095, /* sin(0.08740) */
-  0.5230341686, /* sin(0.08760) */
-  0.5241048018, /* sin(0.08780) */
-  0.5251746073, /* sin(0.08800) */
-  0.5262435836, /* sin(0.08820) */
-  0.5273117288, /* sin(0.08840) */
-  0.5283790413, /* sin(0.08860) */
-  0.5294455195, /* sin(0.08880) */
-  0.5305111615, /* sin(0.08900) */
-  0.5315759658, /* sin(0.08920) */
-  0.5326399307, /* sin(0.08940) */
-  0.5337030545, /* sin(0.08960) */
-  0.5347653355, /* sin(0.08980) */
-  0.5358267720, /* sin(0.09000) */
-  0.5368873624, /* sin(0.09020) */
-  0.5379471050, /* sin(0.09040) */
-  0.5390059980, /* sin(0.09060) */
-  0.5400640399, /* sin(0.09080) */
-  0.5411212290, /* sin(0.09100) */
-  0.5421775636, /* sin(0.09120) */
-  0.5432330420, /* sin(0.09140) */
-  0.5442876625, /* sin(0.09160) */
-  0.5453414236, /* sin(0.09180) */
-  0.5463943235, /* sin(0.09200) */
-  0.5474463605, /* sin(0.09220) */
-  0.5484975331, /* sin(0.09240) */
-  0.5495478395, /* sin(0.09260) */
-  0.5505972781, /* sin(0.09280) */
-  0.5516458472, /* sin(0.09300) */
-  0.5526935452, /* sin(0.09320) */
-  0.5537403704, /* sin(0.09340) */
-  0.5547863212, /* sin(0.09360) */
-  0.5558313959, /* sin(0.09380) */
-  0.5568755929, /* sin(0.09400) */
-  0.5579189105, /* sin(0.09420) */
-  0.5589613471, /* sin(0.09440) */
-  0.5600029010, /* sin(0.09460) */
-  0.5610435705, /* sin(0.09480) */
-  0.5620833541, /* sin(0.09500) */
-  0.5631222501, /* sin(0.09520) */
-  0.5641602569, /* sin(0.09540) */
-  0.5651973727, /* sin(0.09560) */
-  0.5662335961, /* sin(0.09580) */
-  0.5672689253, /* sin(0.09600) */
-  0.5683033586, /* sin(0.09620) */
-  0.5693368946, /* sin(0.09640) */
-  0.5703695315, /* sin(0.09660) */
-  0.5714012677, /* sin(0.09680) */
-  0.5724321016, /* sin(0.09700) */
-  0.5734620315, /* sin(0.09720) */
-  0.5744910559, /* sin(0.09740) */
-  0.5755191730, /* sin(0.09760) */
-  0.5765463814, /* sin(0.09780) */
-  0.5775726793, /* sin(0.09800) */
-  0.5785980651, /* sin(0.09820) */
-  0.5796225372, /* sin(0.09840) */
-  0.5806460941, /* sin(0.09860) */
-  0.5816687340, /* sin(0.09880) */
-  0.5826904554, /* sin(0.09900) */
-  0.5837112566, /* sin(0.09920) */
-  0.5847311361, /* sin(0.09940) */
-  0.5857500922, /* sin(0.09960) */
-  0.5867681233, /* sin(0.09980) */
-  0.5877852279, /* sin(0.10000) */
-  0.5888014042, /* sin(0.10020) */
-  0.5898166508, /* sin(0.10040) */
-  0.5908309659, /* sin(0.10060) */
-  0.5918443481, /* sin(0.10080) */
-  0.5928567956, /* sin(0.10100) */
-  0.5938683069, /* sin(0.10120) */
-  0.5948788805, /* sin(0.10140) */
-  0.5958885146, /* sin(0.10160) */
-  0.5968972078, /* sin(0.10180) */
-  0.5979049584, /* sin(0.10200) */
-  0.5989117648, /* sin(0.10220) */
-  0.5999176254, /* sin(0.10240) */
-  0.6009225387, /* sin(0.10260) */
-  0.6019265030, /* sin(0.10280) */
-  0.6029295169, /* sin(0.10300) */
-  0.6039315786, /* sin(0.10320) */
-  0.6049326866, /* sin(0.10340) */
-  0.6059328394, /* sin(0.10360) */
-  0.6069320353, /* sin(0.10380) */
-  0.6079302728, /* sin(0.10400) */
-  0.6089275502, /* sin(0.10420) */
-  0.6099238661, /* sin(0.10440) */
-  0.6109192189, /* sin(0.10460) */
-  0.6119136069, /* sin(0.10480) */
-  0.6129070286, /* sin(0.10500) */
-  0.6138994825, /* sin(0.10520) */
-  0.6148909669, /* sin(0.10540) */
-  0.6158814803, /* sin(0.10560) */
-  0.6168710212, /* sin(0.10580) */
-  0.6178595879, /* sin(0.10600) */
-  0.6188471790, /* sin(0.10620) */
-  0.6198337928, /* sin(0.10640) */
-  0.6208194278, /* sin(0.10660) */
-  0.6218040825, /* sin(0.10680) */
-  0.6227877552, /* sin(0.10700) */
-  0.6237704445, /* sin(0.10720) */
-  0.6247521487, /* sin(0.10740) */
-  0.6257328664, /* sin(0.10760) */
-  0.6267125960, /* sin(0.10780) */
-  0.6276913359, /* sin(0.10800) */
-  0.6286690846, /* sin(0.10820) */
-  0.6296458405, /* sin(0.10840) */
-  0.6306216022, /* sin(0.10860) */
-  0.6315963680, /* sin(0.10880) */
-  0.6325701364, /* sin(0.10900) */
-  0.6335429059, /* sin(0.10920) */
-  0.6345146750, /* sin(0.10940) */
-  0.6354854421, /* sin(0.10960) */
-  0.6364552056, /* sin(0.10980) */
-  0.6374239642, /* sin(0.11000) */
-  0.6383917161, /* sin(0.11020) */
-  0.6393584599, /* sin(0.11040) */
-  0.6403241941, /* sin(0.11060) */
-  0.6412889171, /* sin(0.11080) */
-  0.6422526275, /* sin(0.11100) */
-  0.6432153236, /* sin(0.11120) */
-  0.6441770040, /* sin(0.11140) */
-  0.6451376672, /* sin(0.11160) */
-  0.6460973116, /* sin(0.11180) */
-  0.6470559358, /* sin(0.11200) */
-  0.6480135381, /* sin(0.11220) */
-  0.6489701172, /* sin(0.11240) */
-  0.6499256714, /* sin(0.11260) */
-  0.6508801993, /* sin(0.11280) */
-  0.6518336994, /* sin(0.11300) */
-  0.6527861702, /* sin(0.11320) */
-  0.6537376101, /* sin(0.11340) */
-  0.6546880177, /* sin(0.11360) */
-  0.6556373914, /* sin(0.11380) */
-  0.6565857298, /* sin(0.11400) */
-  0.6575330313, /* sin(0.11420) */
-  0.6584792946, /* sin(0.11440) */
-  0.6594245179, /* sin(0.11460) */
-  0.6603687000, /* sin(0.11480) */
-  0.6613118393, /* sin(0.11500) */
-  0.6622539342, /* sin(0.11520) */
-  0.6631949834, /* sin(0.11540) */
-  0.6641349853, /* sin(0.11560) */
-  0.6650739384, /* sin(0.11580) */
-  0.6660118413, /* sin(0.11600) */
-  0.6669486925, /* sin(0.11620) */
-  0.6678844904, /* sin(0.11640) */
-  0.6688192337, /* sin(0.11660) */
-  0.6697529208, /* sin(0.11680) */
-  0.6706855503, /* sin(0.11700) */
-  0.6716171207, /* sin(0.11720) */
-  0.6725476305, /* sin(0.11740) */
-  0.6734770783, /* sin(0.11760) */
-  0.6744054626, /* sin(0.11780) */
-  0.6753327818, /* sin(0.11800) */
-  0.6762590347, /* sin(0.11820) */
-  0.6771842196, /* sin(0.11840) */
-  0.6781083352, /* sin(0.11860) */
-  0.6790313799, /* sin(0.11880) */
-  0.6799533524, /* sin(0.11900) */
-  0.6808742511, /* sin(0.11920) */
-  0.6817940746, /* sin(0.11940) */
-  0.6827128215, /* sin(0.11960) */
-  0.6836304903, /* sin(0.11980) */
-  0.6845470795, /* sin(0.12000) */
-  0.6854625878, /* sin(0.12020) */
-  0.6863770136, /* sin(0.12040) */
-  0.6872903555, /* sin(0.12060) */
-  0.6882026121, /* sin(0.12080) */
-  0.6891137819, /* sin(0.12100) */
-  0.6900238635, /* sin(0.12120) */
-  0.6909328555, /* sin(0.12140) */
-  0.6918407564, /* sin(0.12160) */
-  0.6927475648, /* sin(0.12180) */
-  0.6936532793, /* sin(0.12200) */
-  0.6945578984, /* sin(0.12220) */
-  0.6954614206, /* sin(0.12240) */
-  0.6963638447, /* sin(0.12260) */
-  0.6972651691, /* sin(0.12280) */
-  0.6981653924, /* sin(0.12300) */
-  0.6990645132, /* sin(0.12320) */
-  0.6999625301, /* sin(0.12340) */
-  0.7008594417, /* sin(0.12360) */
-  0.7017552465, /* sin(0.12380) */
-  0.7026499432, /* sin(0.12400) */
-  0.7035435302, /* sin(0.12420) */
-  0.7044360063, /* sin(0.12440) */
-  0.7053273700, /* sin(0.12460) */
-  0.7062176198, /* sin(0.12480) */
-  0.7071067545, /* sin(0.12500) */
-  0.7079947725, /* sin(0.12520) */
-  0.7088816725, /* sin(0.12540) */
-  0.7097674531, /* sin(0.12560) */
-  0.7106521129, /* sin(0.12580) */
-  0.7115356505, /* sin(0.12600) */
-  0.7124180644, /* sin(0.12620) */
-  0.7132993534, /* sin(0.12640) */
-  0.7141795159, /* sin(0.12660) */
-  0.7150585507, /* sin(0.12680) */
-  0.7159364562, /* sin(0.12700) */
-  0.7168132313, /* sin(0.12720) */
-  0.7176888743, /* sin(0.12740) */
-  0.7185633841, /* sin(0.12760) */
-  0.7194367591, /* sin(0.12780) */
-  0.7203089981, /* sin(0.12800) */
-  0.7211800996, /* sin(0.12820) */
-  0.7220500622, /* sin(0.12840) */
-  0.7229188846, /* sin(0.12860) */
-  0.7237865655, /* sin(0.12880) */
-  0.7246531033, /* sin(0.12900) */
-  0.7255184969, /* sin(0.12920) */
-  0.7263827448, /* sin(0.12940) */
-  0.7272458456, /* sin(0.12960) */
-  0.7281077979, /* sin(0.12980) */
-  0.7289686005, /* sin(0.13000) */
-  0.7298282520, /* sin(0.13020) */
-  0.7306867510, /* sin(0.13040) */
-  0.7315440961, /* sin(0.13060) */
-  0.7324002860, /* sin(0.13080) */
-  0.7332553193, /* sin(0.13100) */
-  0.7341091948, /* sin(0.13120) */
-  0.7349619109, /* sin(0.13140) */
-  0.7358134665, /* sin(0.13160) */
-  0.7366638601, /* sin(0.13180) */
-  0.7375130904, /* sin(0.13200) */
-  0.7383611561, /* sin(0.13220) */
-  0.7392080558, /* sin(0.13240) */
-  0.7400537883, /* sin(0.13260) */
-  0.7408983520, /* sin(0.13280) */
-  0.7417417458, /* sin(0.13300) */
-  0.7425839683, /* sin(0.13320) */
-  0.7434250181, /* sin(0.13340) */
-  0.7442648940, /* sin(0.13360) */
-  0.7451035945, /* sin(0.13380) */
-  0.7459411185, /* sin(0.13400) */
-  0.7467774645, /* sin(0.13420) */
-  0.7476126312, /* sin(0.13440) */
-  0.7484466174, /* sin(0.13460) */
-  0.7492794216, /* sin(0.13480) */
-  0.7501110427, /* sin(0.13500) */
-  0.7509414792, /* sin(0.13520) */
-  0.7517707299, /* sin(0.13540) */
-  0.7525987934, /* sin(0.13560) */
-  0.7534256685, /* sin(0.13580) */
-  0.7542513538, /* sin(0.13600) */
-  0.7550758480, /* sin(0.13620) */
-  0.7558991499, /* sin(0.13640) */
-  0.7567212581, /* sin(0.13660) */
-  0.7575421713, /* sin(0.13680) */
-  0.7583618883, /* sin(0.13700) */
-  0.7591804077, /* sin(0.13720) */
-  0.7599977283, /* sin(0.13740) */
-  0.7608138488, /* sin(0.13760) */
-  0.7616287678, /* sin(0.13780) */
-  0.7624424840, /* sin(0.13800) */
-  0.7632549963, /* sin(0.13820) */
-  0.7640663033, /* sin(0.13840) */
-  0.7648764038, /* sin(0.13860) */
-  0.7656852964, /* sin(0.13880) */
-  0.7664929798, /* sin(0.13900) */
-  0.7672994529, /* sin(0.13920) */
-  0.7681047143, /* sin(0.13940) */
-  0.7689087628, /* sin(0.13960) */
-  0.7697115971, /* sin(0.13980) */
-  0.7705132158, /* sin(0.14000) */
-  0.7713136179, /* sin(0.14020) */
-  0.7721128019, /* sin(0.14040) */
-  0.7729107666, /* sin(0.14060) */
-  0.7737075108, /* sin(0.14080) */
-  0.7745030333, /* sin(0.14100) */
-  0.7752973326, /* sin(0.14120) */
-  0.7760904077, /* sin(0.14140) */
-  0.7768822573, /* sin(0.14160) */
-  0.7776728800, /* sin(0.14180) */
-  0.7784622746, /* sin(0.14200) */
-  0.7792504400, /* sin(0.14220) */
-  0.7800373749, /* sin(0.14240) */
-  0.7808230779, /* sin(0.14260) */
-  0.7816075479, /* sin(0.14280) */
-  0.7823907837, /* sin(0.14300) */
-  0.7831727839, /* sin(0.14320) */
-  0.7839535475, /* sin(0.14340) */
-  0.7847330730, /* sin(0.14360) */
-  0.7855113593, /* sin(0.14380) */
-  0.7862884053, /* sin(0.14400) */
-  0.7870642095, /* sin(0.14420) */
-  0.7878387709, /* sin(0.14440) */
-  0.7886120882, /* sin(0.14460) */
-  0.7893841601, /* sin(0.14480) */
-  0.7901549855, /* sin(0.14500) */
-  0.7909245632, /* sin(0.14520) */
-  0.7916928918, /* sin(0.14540) */
-  0.7924599703, /* sin(0.14560) */
-  0.7932257974, /* sin(0.14580) */
-  0.7939903718, /* sin(0.14600) */
-  0.7947536925, /* sin(0.14620) */
-  0.7955157581, /* sin(0.14640) */
-  0.7962765675, /* sin(0.14660) */
-  0.7970361194, /* sin(0.14680) */
-  0.7977944128, /* sin(0.14700) */
-  0.7985514463, /* sin(0.14720) */
-  0.7993072188, /* sin(0.14740) */
-  0.8000617290, /* sin(0.14760) */
-  0.8008149759, /* sin(0.14780) */
-  0.8015669581, /* sin(0.14800) */
-  0.8023176746, /* sin(0.14820) */
-  0.8030671241, /* sin(0.14840) */
-  0.8038153055, /* sin(0.14860) */
-  0.8045622175, /* sin(0.14880) */
-  0.8053078590, /* sin(0.14900) */
-  0.8060522289, /* sin(0.14920) */
-  0.8067953258, /* sin(0.14940) */
-  0.8075371487, /* sin(0.14960) */
-  0.8082776964, /* sin(0.14980) */
-  0.8090169677, /* sin(0.15000) */
-  0.8097549615, /* sin(0.15020) */
-  0.8104916766, /* sin(0.15040) */
-  0.8112271118, /* sin(0.15060) */
-  0.8119612659, /* sin(0.15080) */
-  0.8126941379, /* sin(0.15100) */
-  0.8134257265, /* sin(0.15120) */
-  0.8141560305, /* sin(0.15140) */
-  0.8148850490, /* sin(0.15160) */
-  0.8156127806, /* sin(0.15180) */
-  0.8163392242, /* sin(0.15200) */
-  0.8170643787, /* sin(0.15220) */
-  0.8177882430, /* sin(0.15240) */
-  0.8185108159, /* sin(0.15260) */
-  0.8192320962, /* sin(0.15280) */
-  0.8199520829, /* sin(0.15300) */
-  0.8206707747, /* sin(0.15320) */
-  0.8213881706, /* sin(0.15340) */
-  0.8221042694, /* sin(0.15360) */
-  0.8228190700, /* sin(0.15380) */
-  0.8235325712, /* sin(0.15400) */
-  0.8242447720, /* sin(0.15420) */
-  0.8249556712, /* sin(0.15440) */
-  0.8256652677, /* sin(0.15460) */
-  0.8263735603, /* sin(0.15480) */
-  0.8270805480, /* sin(0.15500) */
-  0.8277862296, /* sin(0.15520) */
-  0.8284906040, /* sin(0.15540) */
-  0.8291936701, /* sin(0.15560) */
-  0.8298954268, /* sin(0.15580) */
-  0.8305958730, /* sin(0.15600) */
-  0.8312950075, /* sin(0.15620) */
-  0.8319928293, /* sin(0.15640) */
-  0.8326893373, /* sin(0.15660) */
-  0.8333845304, /* sin(0.15680) */
-  0.8340784075, /* sin(0.15700) */
-  0.8347709674, /* sin(0.15720) */
-  0.8354622091, /* sin(0.15740) */
-  0.8361521315, /* sin(0.15760) */
-  0.8368407335, /* sin(0.15780) */
-  0.8375280140, /* sin(0.15800) */
-  0.8382139719, /* sin(0.15820) */
-  0.8388986062, /* sin(0.15840) */
-  0.8395819157, /* sin(0.15860) */
-  0.8402638995, /* sin(0.15880) */
-  0.8409445563, /* sin(0.15900) */
-  0.8416238852, /* sin(0.15920) */
-  0.8423018850, /* sin(0.15940) */
-  0.8429785548, /* sin(0.15960) */
-  0.8436538933, /* sin(0.15980) */
-  0.8443278996, /* sin(0.16000) */
-  0.8450005726, /* sin(0.16020) */
-  0.8456719112, /* sin(0.16040) */
-  0.8463419144, /* sin(0.16060) */
-  0.8470105811, /* sin(0.16080) */
-  0.8476779103, /* sin(0.16100) */
-  0.8483439009, /* sin(0.16120) */
-  0.8490085518, /* sin(0.16140) */
-  0.8496718620, /* sin(0.16160) */
-  0.8503338304, /* sin(0.16180) */
-  0.8509944561, /* sin(0.16200) */
-  0.8516537379, /* sin(0.16220) */
-  0.8523116749, /* sin(0.16240) */
-  0.8529682659, /* sin(0.16260) */
-  0.8536235100, /* sin(0.16280) */
-  0.8542774061, /* sin(0.16300) */
-  0.8549299532, /* sin(0.16320) */
-  0.8555811502, /* sin(0.16340) */
-  0.8562309962, /* sin(0.16360) */
-  0.8568794900, /* sin(0.16380) */
-  0.8575266307, /* sin(0.16400) */
-  0.8581724173, /* sin(0.16420) */
-  0.8588168487, /* sin(0.16440) */
-  0.8594599239, /* sin(0.16460) */
-  0.8601016419, /* sin(0.16480) */
-  0.8607420016, /* sin(0.16500) */
-  0.8613810022, /* sin(0.16520) */
-  0.8620186425, /* sin(0.16540) */
-  0.8626549216, /* sin(0.16560) */
-  0.8632898384, /* sin(0.16580) */
-  0.8639233919, /* sin(0.16600) */
-  0.8645555813, /* sin(0.16620) */
-  0.8651864053, /* sin(0.16640) */
-  0.8658158631, /* sin(0.16660) */
-  0.8664439537, /* sin(0.16680) */
-  0.8670706760, /* sin(0.16700) */
-  0.8676960292, /* sin(0.16720) */
-  0.8683200121, /* sin(0.16740) */
-  0.8689426238, /* sin(0.16760) */
-  0.8695638633, /* sin(0.16780) */
-  0.8701837297, /* sin(0.16800) */
-  0.8708022219, /* sin(0.16820) */
-  0.8714193390, /* sin(0.16840) */
-  0.8720350800, /* sin(0.16860) */
-  0.8726494440, /* sin(0.16880) */
-  0.8732624299, /* sin(0.16900) */
-  0.8738740369, /* sin(0.16920) */
-  0.8744842638, /* sin(0.16940) */
-  0.8750931099, /* sin(0.16960) */
-  0.8757005740, /* sin(0.16980) */
-  0.8763066553, /* sin(0.17000) */
-  0.8769113528, /* sin(0.17020) */
-  0.8775146655, /* sin(0.17040) */
-  0.8781165925, /* sin(0.17060) */
-  0.8787171329, /* sin(0.17080) */
-  0.8793162856, /* sin(0.17100) */
-  0.8799140498, /* sin(0.17120) */
-  0.8805104244, /* sin(0.17140) */
-  0.8811054086, /* sin(0.17160) */
-  0.8816990015, /* sin(0.17180) */
-  0.8822912020, /* sin(0.17200) */
-  0.8828820092, /* sin(0.17220) */
-  0.8834714223, /* sin(0.17240) */
-  0.8840594402, /* sin(0.17260) */
-  0.8846460621, /* sin(0.17280) */
-  0.8852312870, /* sin(0.17300) */
-  0.8858151140, /* sin(0.17320) */
-  0.8863975422, /* sin(0.17340) */
-  0.8869785707, /* sin(0.17360) */
-  0.8875581985, /* sin(0.17380) */
-  0.8881364247, /* sin(0.17400) */
-  0.8887132484, /* sin(0.17420) */
-  0.8892886687, /* sin(0.17440) */
-  0.8898626847, /* sin(0.17460) */
-  0.8904352955, /* sin(0.17480) */
-  0.8910065002, /* sin(0.17500) */
-  0.8915762979, /* sin(0.17520) */
-  0.8921446876, /* sin(0.17540) */
-  0.8927116685, /* sin(0.17560) */
-  0.8932772397, /* sin(0.17580) */
-  0.8938414003, /* sin(0.17600) */
-  0.8944041494, /* sin(0.17620) */
-  0.8949654861, /* sin(0.17640) */
-  0.8955254096, /* sin(0.17660) */
-  0.8960839189, /* sin(0.17680) */
-  0.8966410131, /* sin(0.17700) */
-  0.8971966914, /* sin(0.17720) */
-  0.8977509530, /* sin(0.17740) */
-  0.8983037968, /* sin(0.17760) */
-  0.8988552222, /* sin(0.17780) */
-  0.8994052281, /* sin(0.17800) */
-  0.8999538137, /* sin(0.17820) */
-  0.9005009782, /* sin(0.17840) */
-  0.9010467206, /* sin(0.17860) */
-  0.9015910402, /* sin(0.17880) */
-  0.9021339360, /* sin(0.17900) */
-  0.9026754073, /* sin(0.17920) */
-  0.9032154531, /* sin(0.17940) */
-  0.9037540726, /* sin(0.17960) */
-  0.9042912650, /* sin(0.17980) */
-  0.9048270293, /* sin(0.18000) */
-  0.9053613648, /* sin(0.18020) */
-  0.9058942707, /* sin(0.18040) */
-  0.9064257459, /* sin(0.18060) */
-  0.9069557899, /* sin(0.18080) */
-  0.9074844016, /* sin(0.18100) */
-  0.9080115803, /* sin(0.18120) */
-  0.9085373250, /* sin(0.18140) */
-  0.9090616351, /* sin(0.18160) */
-  0.9095845097, /* sin(0.18180) */
-  0.9101059479, /* sin(0.18200) */
-  0.9106259489, /* sin(0.18220) */
-  0.9111445120, /* sin(0.18240) */
-  0.9116616362, /* sin(0.18260) */
-  0.9121773207, /* sin(0.18280) */
-  0.9126915648, /* sin(0.18300) */
-  0.9132043677, /* sin(0.18320) */
-  0.9137157284, /* sin(0.18340) */
-  0.9142256463, /* sin(0.18360) */
-  0.9147341205, /* sin(0.18380) */
-  0.9152411502, /* sin(0.18400) */
-  0.9157467347, /* sin(0.18420) */
-  0.9162508730, /* sin(0.18440) */
-  0.9167535644, /* sin(0.18460) */
-  0.9172548082, /* sin(0.18480) */
-  0.9177546035, /* sin(0.18500) */
-  0.9182529495, /* sin(0.18520) */
-  0.9187498455, /* sin(0.18540) */
-  0.9192452907, /* sin(0.18560) */
-  0.9197392842, /* sin(0.18580) */
-  0.9202318254, /* sin(0.18600) */
-  0.9207229134, /* sin(0.18620) */
-  0.9212125474, /* sin(0.18640) */
-  0.9217007267, /* sin(0.18660) */
-  0.9221874505, /* sin(0.18680) */
-  0.9226727181, /* sin(0.18700) */
-  0.9231565286, /* sin(0.18720) */
-  0.9236388814, /* sin(0.18740) */
-  0.9241197756, /* sin(0.18760) */
-  0.9245992105, /* sin(0.18780) */
-  0.9250771853, /* sin(0.18800) */
-  0.9255536993, /* sin(0.18820) */
-  0.9260287517, /* sin(0.18840) */
-  0.9265023418, /* sin(0.18860) */
-  0.9269744688, /* sin(0.18880) */
-  0.9274451320, /* sin(0.18900) */
-  0.9279143306, /* sin(0.18920) */
-  0.9283820640, /* sin(0.18940) */
-  0.9288483313, /* sin(0.18960) */
-  0.9293131318, /* sin(0.18980) */
-  0.9297764648, /* sin(0.19000) */
-  0.9302383295, /* sin(0.19020) */
-  0.9306987253, /* sin(0.19040) */
-  0.9311576514, /* sin(0.19060) */
-  0.9316151071, /* sin(0.19080) */
-  0.9320710916, /* sin(0.19100) */
-  0.9325256042, /* sin(0.19120) */
-  0.9329786443, /* sin(0.19140) */
-  0.9334302110, /* sin(0.19160) */
-  0.9338803038, /* sin(0.19180) */
-  0.9343289218, /* sin(0.19200) */
-  0.9347760644, /* sin(0.19220) */
-  0.9352217308, /* sin(0.19240) */
-  0.9356659204, /* sin(0.19260) */
-  0.9361086325, /* sin(0.19280) */
-  0.9365498663, /* sin(0.19300) */
-  0.9369896212, /* sin(0.19320) */
-  0.9374278964, /* sin(0.19340) */
-  0.9378646914, /* sin(0.19360) */
-  0.9383000053, /* sin(0.19380) */
-  0.9387338375, /* sin(0.19400) */
-  0.9391661873, /* sin(0.19420) */
-  0.9395970540, /* sin(0.19440) */
-  0.9400264370, /* sin(0.19460) */
-  0.9404543356, /* sin(0.19480) */
-  0.9408807490, /* sin(0.19500) */
-  0.9413056767, /* sin(0.19520) */
-  0.9417291179, /* sin(0.19540) */
-  0.9421510720, /* sin(0.19560) */
-  0.9425715383, /* sin(0.19580) */
-  0.9429905162, /* sin(0.19600) */
-  0.9434080050, /* sin(0.19620) */
-  0.9438240039, /* sin(0.19640) */
-  0.9442385125, /* sin(0.19660) */
-  0.9446515300, /* sin(0.19680) */
-  0.9450630557, /* sin(0.19700) */
-  0.9454730891, /* sin(0.19720) */
-  0.9458816294, /* sin(0.19740) */
-  0.9462886761, /* sin(0.19760) */
-  0.9466942284, /* sin(0.19780) */
-  0.9470982858, /* sin(0.19800) */
-  0.9475008476, /* sin(0.19820) */
-  0.9479019131, /* sin(0.19840) */
-  0.9483014818, /* sin(0.19860) */
-  0.9486995530, /* sin(0.19880) */
-  0.9490961261, /* sin(0.19900) */
-  0.9494912004, /* sin(0.19920) */
-  0.9498847753, /* sin(0.19940) */
-  0.9502768502, /* sin(0.19960) */
-  0.9506674245, /* sin(0.19980) */
-  0.9510564976, /* sin(0.20000) */
-  0.9514440689, /* sin(0.20020) */
-  0.9518301376, /* sin(0.20040) */
-  0.9522147033, /* sin(0.20060) */
-  0.9525977654, /* sin(0.20080) */
-  0.9529793231, /* sin(0.20100) */
-  0.9533593760, /* sin(0.20120) */
-  0.9537379234, /* sin(0.20140) */
-  0.9541149647, /* sin(0.20160) */
-  0.9544904993, /* sin(0.20180) */
-  0.9548645266, /* sin(0.20200) */
-  0.9552370461, /* sin(0.20220) */
-  0.9556080572, /* sin(0.20240) */
-  0.9559775592, /* sin(0.20260) */
-  0.9563455515, /* sin(0.20280) */
-  0.9567120337, /* sin(0.20300) */
-  0.9570770051, /* sin(0.20320) */
-  0.9574404652, /* sin(0.20340) */
-  0.9578024133, /* sin(0.20360) */
-  0.9581628489, /* sin(0.20380) */
-  0.9585217715, /* sin(0.20400) */
-  0.9588791804, /* sin(0.20420) */
-  0.9592350751, /* sin(0.20440) */
-  0.9595894550, /* sin(0.20460) */
-  0.9599423197, /* sin(0.20480) */
-  0.9602936684, /* sin(0.20500) */
-  0.9606435007, /* sin(0.20520) */
-  0.9609918160, /* sin(0.20540) */
-  0.9613386138, /* sin(0.20560) */
-  0.9616838935, /* sin(0.20580) */
-  0.9620276546, /* sin(0.20600) */
-  0.9623698965, /* sin(0.20620) */
-  0.9627106187, /* sin(0.20640) */
-  0.9630498206, /* sin(0.20660) */
-  0.9633875018, /* sin(0.20680) */
-  0.9637236616, /* sin(0.20700) */
-  0.9640582996, /* sin(0.20720) */
-  0.9643914152, /* sin(0.20740) */
-  0.9647230079, /* sin(0.20760) */
-  0.9650530771, /* sin(0.20780) */
-  0.9653816224, /* sin(0.20800) */
-  0.9657086433, /* sin(0.20820) */
-  0.9660341392, /* sin(0.20840) */
-  0.9663581095, /* sin(0.20860) */
-  0.9666805539, /* sin(0.20880) */
-  0.9670014717, /* sin(0.20900) */
-  0.9673208625, /* sin(0.20920) */
-  0.9676387257, /* sin(0.20940) */
-  0.9679550610, /* sin(0.20960) */
-  0.9682698677, /* sin(0.20980) */
-  0.9685831454, /* sin(0.21000) */
-  0.9688948935, /* sin(0.21020) */
-  0.9692051116, /* sin(0.21040) */
-  0.9695137993, /* sin(0.21060) */
-  0.9698209559, /* sin(0.21080) */
-  0.9701265810, /* sin(0.21100) */
-  0.9704306742, /* sin(0.21120) */
-  0.9707332350, /* sin(0.21140) */
-  0.9710342628, /* sin(0.21160) */
-  0.9713337572, /* sin(0.21180) */
-  0.9716317178, /* sin(0.21200) */
-  0.9719281440, /* sin(0.21220) */
-  0.9722230354, /* sin(0.21240) */
-  0.9725163915, /* sin(0.21260) */
-  0.9728082120, /* sin(0.21280) */
-  0.9730984962, /* sin(0.21300) */
-  0.9733872437, /* sin(0.21320) */
-  0.9736744542, /* sin(0.21340) */
-  0.9739601270, /* sin(0.21360) */
-  0.9742442619, /* sin(0.21380) */
-  0.9745268583, /* sin(0.21400) */
-  0.9748079158, /* sin(0.21420) */
-  0.9750874339, /* sin(0.21440) */
-  0.9753654122, /* sin(0.21460) */
-  0.9756418503, /* sin(0.21480) */
-  0.9759167478, /* sin(0.21500) */
-  0.9761901041, /* sin(0.21520) */
-  0.9764619189, /* sin(0.21540) */
-  0.9767321917, /* sin(0.21560) */
-  0.9770009221, /* sin(0.21580) */
-  0.9772681097, /* sin(0.21600) */
-  0.9775337541, /* sin(0.21620) */
-  0.9777978548, /* sin(0.21640) */
-  0.9780604115, /* sin(0.21660) */
-  0.9783214236, /* sin(0.21680) */
-  0.9785808908, /* sin(0.21700) */
-  0.9788388128, /* sin(0.21720) */
-  0.9790951890, /* sin(0.21740) */
-  0.9793500191, /* sin(0.21760) */
-  0.9796033026, /* sin(0.21780) */
-  0.9798550392, /* sin(0.21800) */
-  0.9801052285, /* sin(0.21820) */
-  0.9803538701, /* sin(0.21840) */
-  0.9806009636, /* sin(0.21860) */
-  0.9808465086, /* sin(0.21880) */
-  0.9810905046, /* sin(0.21900) */
-  0.9813329514, /* sin(0.21920) */
-  0.9815738486, /* sin(0.21940) */
-  0.9818131957, /* sin(0.21960) */
-  0.9820509924, /* sin(0.21980) */
-  0.9822872383, /* sin(0.22000) */
-  0.9825219330, /* sin(0.22020) */
-  0.9827550762, /* sin(0.22040) */
-  0.9829866675, /* sin(0.22060) */
-  0.9832167065, /* sin(0.22080) */
-  0.9834451929, /* sin(0.22100) */
-  0.9836721263, /* sin(0.22120) */
-  0.9838975063, /* sin(0.22140) */
-  0.9841213327, /* sin(0.22160) */
-  0.9843436049, /* sin(0.22180) */
-  0.9845643228, /* sin(0.22200) */
-  0.9847834859, /* sin(0.22220) */
-  0.9850010939, /* sin(0.22240) */
-  0.9852171464, /* sin(0.22260) */
-  0.9854316432, /* sin(0.22280) */
-  0.9856445838, /* sin(0.22300) */
-  0.9858559679, /* sin(0.22320) */
-  0.9860657953, /* sin(0.22340) */
-  0.9862740655, /* sin(0.22360) */
-  0.9864807782, /* sin(0.22380) */
-  0.9866859332, /* sin(0.22400) */
-  0.9868895301, /* sin(0.22420) */
-  0.9870915685, /* sin(0.22440) */
-  0.9872920481, /* sin(0.22460) */
-  0.9874909687, /* sin(0.22480) */
-  0.9876883300, /* sin(0.22500) */
-  0.9878841315, /* sin(0.22520) */
-  0.9880783730, /* sin(0.22540) */
-  0.9882710542, /* sin(0.22560) */
-  0.9884621748, /* sin(0.22580) */
-  0.9886517345, /* sin(0.22600) */
-  0.9888397329, /* sin(0.22620) */
-  0.9890261699, /* sin(0.22640) */
-  0.9892110450, /* sin(0.22660) */
-  0.9893943581, /* sin(0.22680) */
-  0.9895761087, /* sin(0.22700) */
-  0.9897562967, /* sin(0.22720) */
-  0.9899349217, /* sin(0.22740) */
-  0.9901119835, /* sin(0.22760) */
-  0.9902874818, /* sin(0.22780) */
-  0.9904614162, /* sin(0.22800) */
-  0.9906337866, /* sin(0.22820) */
-  0.9908045926, /* sin(0.22840) */
-  0.9909738340, /* sin(0.22860) */
-  0.9911415106, /* sin(0.22880) */
-  0.9913076220, /* sin(0.22900) */
-  0.9914721680, /* sin(0.22920) */
-  0.9916351483, /* sin(0.22940) */
-  0.9917965626, /* sin(0.22960) */
-  0.9919564108, /* sin(0.22980) */
-  0.9921146926, /* sin(0.23000) */
-  0.9922714077, /* sin(0.23020) */
-  0.9924265558, /* sin(0.23040) */
-  0.9925801368, /* sin(0.23060) */
-  0.9927321504, /* sin(0.23080) */
-  0.9928825963, /* sin(0.23100) */
-  0.9930314743, /* sin(0.23120) */
-  0.9931787841, /* sin(0.23140) */
-  0.9933245256, /* sin(0.23160) */
-  0.9934686985, /* sin(0.23180) */
-  0.9936113026, /* sin(0.23200) */
-  0.9937523376, /* sin(0.23220) */
-  0.9938918034, /* sin(0.23240) */
-  0.9940296997, /* sin(0.23260) */
-  0.9941660263, /* sin(0.23280) */
-  0.9943007829, /* sin(0.23300) */
-  0.9944339694, /* sin(0.23320) */
-  0.9945655856, /* sin(0.23340) */
-  0.9946956312, /* sin(0.23360) */
-  0.9948241060, /* sin(0.23380) */
-  0.9949510099, /* sin(0.23400) */
-  0.9950763426, /* sin(0.23420) */
-  0.9952001040, /* sin(0.23440) */
-  0.9953222938, /* sin(0.23460) */
-  0.9954429118, /* sin(0.23480) */
-  0.9955619579, /* sin(0.23500) */
-  0.9956794319, /* sin(0.23520) */
-  0.9957953336, /* sin(0.23540) */
-  0.9959096627, /* sin(0.23560) */
-  0.9960224192, /* sin(0.23580) */
-  0.9961336029, /* sin(0.23600) */
-  0.9962432135, /* sin(0.23620) */
-  0.9963512509, /* sin(0.23640) */
-  0.9964577149, /* sin(0.23660) */
-  0.9965626054, /* sin(0.23680) */
-  0.9966659222, /* sin(0.23700) */
-  0.9967676651, /* sin(0.23720) */
-  0.9968678340, /* sin(0.23740) */
-  0.9969664287, /* sin(0.23760) */
-  0.9970634490, /* sin(0.23780) */
-  0.9971588948, /* sin(0.23800) */
-  0.9972527660, /* sin(0.23820) */
-  0.9973450624, /* sin(0.23840) */
-  0.9974357839, /* sin(0.23860) */
-  0.9975249302, /* sin(0.23880) */
-  0.9976125014, /* sin(0.23900) */
-  0.9976984971, /* sin(0.23920) */
-  0.9977829174, /* sin(0.23940) */
-  0.9978657620, /* sin(0.23960) */
-  0.9979470309, /* sin(0.23980) */
-  0.9980267239, /* sin(0.24000) */
-  0.9981048408, /* sin(0.24020) */
-  0.9981813816, /* sin(0.24040) */
-  0.9982563462, /* sin(0.24060) */
-  0.9983297343, /* sin(0.24080) */
-  0.9984015460, /* sin(0.24100) */
-  0.9984717810, /* sin(0.24120) */
-  0.9985404394, /* sin(0.24140) */
-  0.9986075209, /* sin(0.24160) */
-  0.9986730254, /* sin(0.24180) */
-  0.9987369529, /* sin(0.24200) */
-  0.9987993033, /* sin(0.24220) */
-  0.9988600764, /* sin(0.24240) */
-  0.9989192722, /* sin(0.24260) */
-  0.9989768906, /* sin(0.24280) */
-  0.9990329315, /* sin(0.24300) */
-  0.9990873947, /* sin(0.24320) */
-  0.9991402802, /* sin(0.24340) */
-  0.9991915880, /* sin(0.24360) */
-  0.9992413179, /* sin(0.24380) */
-  0.9992894699, /* sin(0.24400) */
-  0.9993360438, /* sin(0.24420) */
-  0.9993810397, /* sin(0.24440) */
-  0.9994244574, /* sin(0.24460) */
-  0.9994662969, /* sin(0.24480) */
-  0.9995065580, /* sin(0.24500) */
-  0.9995452409, /* sin(0.24520) */
-  0.9995823453, /* sin(0.24540) */
-  0.9996178712, /* sin(0.24560) */
-  0.9996518186, /* sin(0.24580) */
-  0.9996841874, /* sin(0.24600) */
-  0.9997149776, /* sin(0.24620) */
-  0.9997441891, /* sin(0.24640) */
-  0.9997718218, /* sin(0.24660) */
-  0.9997978758, /* sin(0.24680) */
-  0.9998223510, /* sin(0.24700) */
-  0.9998452473, /* sin(0.24720) */
-  0.9998665647, /* sin(0.24740) */
-  0.9998863032, /* sin(0.24760) */
-  0.9999044627, /* sin(0.24780) */
-  0.9999210433, /* sin(0.24800) */
-  0.9999360448, /* sin(0.24820) */
-  0.9999494673, /* sin(0.24840) */
-  0.9999613107, /* sin(0.24860) */
-  0.9999715751, /* sin(0.24880) */
-  0.9999802604, /* sin(0.24900) */
-  0.9999873666, /* sin(0.24920) */
-  0.9999928936, /* sin(0.24940) */
-  0.9999968415, /* sin(0.24960) */
-  0.9999992103, /* sin(0.24980) */
-  1.0000000000, /* sin(0.25000) */
-  0.9999992105, /* sin(0.25020) */
-  0.9999968419, /* sin(0.25040) */
-  0.9999928942, /* sin(0.25060) */
-  0.9999873673, /* sin(0.25080) */
-  0.9999802613, /* sin(0.25100) */
-  0.9999715762, /* sin(0.25120) */
-  0.9999613121, /* sin(0.25140) */
-  0.9999494688, /* sin(0.25160) */
-  0.9999360465, /* sin(0.25180) */
-  0.9999210452, /* sin(0.25200) */
-  0.9999044648, /* sin(0.25220) */
-  0.9998863055, /* sin(0.25240) */
-  0.9998665672, /* sin(0.25260) */
-  0.9998452499, /* sin(0.25280) */
-  0.9998223538, /* sin(0.25300) */
-  0.9997978788, /* sin(0.25320) */
-  0.9997718251, /* sin(0.25340) */
-  0.9997441925, /* sin(0.25360) */
-  0.9997149812, /* sin(0.25380) */
-  0.9996841912, /* sin(0.25400) */
-  0.9996518226, /* sin(0.25420) */
-  0.9996178754, /* sin(0.25440) */
-  0.9995823496, /* sin(0.25460) */
-  0.9995452454, /* sin(0.25480) */
-  0.9995065628, /* sin(0.25500) */
-  0.9994663018, /* sin(0.25520) */
-  0.9994244625, /* sin(0.25540) */
-  0.9993810450, /* sin(0.25560) */
-  0.9993360493, /* sin(0.25580) */
-  0.9992894756, /* sin(0.25600) */
-  0.9992413238, /* sin(0.25620) */
-  0.9991915941, /* sin(0.25640) */
-  0.9991402865, /* sin(0.25660) */
-  0.9990874011, /* sin(0.25680) */
-  0.9990329381, /* sin(0.25700) */
-  0.9989768974, /* sin(0.25720) */
-  0.9989192793, /* sin(0.25740) */
-  0.9988600836, /* sin(0.25760) */
-  0.9987993107, /* sin(0.25780) */
-  0.9987369605, /* sin(0.25800) */
-  0.9986730332, /* sin(0.25820) */
-  0.9986075288, /* sin(0.25840) */
-  0.9985404475, /* sin(0.25860) */
-  0.9984717894, /* sin(0.25880) */
-  0.9984015545, /* sin(0.25900) */
-  0.9983297431, /* sin(0.25920) */
-  0.9982563551, /* sin(0.25940) */
-  0.9981813907, /* sin(0.25960) */
-  0.9981048501, /* sin(0.25980) */
-  0.9980267334, /* sin(0.26000) */
-  0.9979470406, /* sin(0.26020) */
-  0.9978657719, /* sin(0.26040) */
-  0.9977829275, /* sin(0.26060) */
-  0.9976985074, /* sin(0.26080) */
-  0.9976125118, /* sin(0.26100) */
-  0.9975249409, /* sin(0.26120) */
-  0.9974357947, /* sin(0.26140) */
-  0.9973450734, /* sin(0.26160) */
-  0.9972527772, /* sin(0.26180) */
-  0.9971589062, /* sin(0.26200) */
-  0.9970634606, /* sin(0.26220) */
-  0.9969664404, /* sin(0.26240) */
-  0.9968678459, /* sin(0.26260) */
-  0.9967676772, /* sin(0.26280) */
-  0.9966659345, /* sin(0.26300) */
-  0.9965626179, /* sin(0.26320) */
-  0.9964577276, /* sin(0.26340) */
-  0.9963512638, /* sin(0.26360) */
-  0.9962432266, /* sin(0.26380) */
-  0.9961336161, /* sin(0.26400) */
-  0.9960224327, /* sin(0.26420) */
-  0.9959096764, /* sin(0.26440) */
-  0.9957953474, /* sin(0.26460) */
-  0.9956794459, /* sin(0.26480) */
-  0.9955619721, /* sin(0.26500) */
-  0.9954429262, /* sin(0.26520) */
-  0.9953223084, /* sin(0.26540) */
-  0.9952001187, /* sin(0.26560) */
-  0.9950763576, /* sin(0.26580) */
-  0.9949510250, /* sin(0.26600) */
-  0.9948241214, /* sin(0.26620) */
-  0.9946956467, /* sin(0.26640) */
-  0.9945656013, /* sin(0.26660) */
-  0.9944339853, /* sin(0.26680) */
-  0.9943007990, /* sin(0.26700) */
-  0.9941660425, /* sin(0.26720) */
-  0.9940297162, /* sin(0.26740) */
-  0.9938918201, /* sin(0.26760) */
-  0.9937523545, /* sin(0.26780) */
-  0.9936113197, /* sin(0.26800) */
-  0.9934687158, /* sin(0.26820) */
-  0.9933245430, /* sin(0.26840) */
-  0.9931788017, /* sin(0.26860) */
-  0.9930314921, /* sin(0.26880) */
-  0.9928826142, /* sin(0.26900) */
-  0.9927321685, /* sin(0.26920) */
-  0.9925801552, /* sin(0.26940) */
-  0.9924265744, /* sin(0.26960) */
-  0.9922714264, /* sin(0.26980) */
-  0.9921147115, /* sin(0.27000) */
-  0.9919564300, /* sin(0.27020) */
-  0.9917965819, /* sin(0.27040) */
-  0.9916351677, /* sin(0.27060) */
-  0.9914721876, /* sin(0.27080) */
-  0.9913076418, /* sin(0.27100) */
-  0.9911415306, /* sin(0.27120) */
-  0.9909738543, /* sin(0.27140) */
-  0.9908046131, /* sin(0.27160) */
-  0.9906338072, /* sin(0.27180) */
-  0.9904614370, /* sin(0.27200) */
-  0.9902875027, /* sin(0.27220) */
-  0.9901120047, /* sin(0.27240) */
-  0.9899349431, /* sin(0.27260) */
-  0.9897563183, /* sin(0.27280) */
-  0.9895761305, /* sin(0.27300) */
-  0.9893943800, /* sin(0.27320) */
-  0.9892110672, /* sin(0.27340) */
-  0.9890261922, /* sin(0.27360) */
-  0.9888397554, /* sin(0.27380) */
-  0.9886517572, /* sin(0.27400) */
-  0.9884621977, /* sin(0.27420) */
-  0.9882710773, /* sin(0.27440) */
-  0.9880783963, /* sin(0.27460) */
-  0.9878841549, /* sin(0.27480) */
-  0.9876883536, /* sin(0.27500) */
-  0.9874909926, /* sin(0.27520) */
-  0.9872920721, /* sin(0.27540) */
-  0.9870915927, /* sin(0.27560) */
-  0.9868895544, /* sin(0.27580) */
-  0.9866859578, /* sin(0.27600) */
-  0.9864808030, /* sin(0.27620) */
-  0.9862740904, /* sin(0.27640) */
-  0.9860658204, /* sin(0.27660) */
-  0.9858559932, /* sin(0.27680) */
-  0.9856446093, /* sin(0.27700) */
-  0.9854316688, /* sin(0.27720) */
-  0.9852171723, /* sin(0.27740) */
-  0.9850011199, /* sin(0.27760) */
-  0.9847835121, /* sin(0.27780) */
-  0.9845643492, /* sin(0.27800) */
-  0.9843436316, /* sin(0.27820) */
-  0.9841213595, /* sin(0.27840) */
-  0.9838975333, /* sin(0.27860) */
-  0.9836721535, /* sin(0.27880) */
-  0.9834452203, /* sin(0.27900) */
-  0.9832167341, /* sin(0.27920) */
-  0.9829866952, /* sin(0.27940) */
-  0.9827551041, /* sin(0.27960) */
-  0.9825219611, /* sin(0.27980) */
-  0.9822872666, /* sin(0.28000) */
-  0.9820510209, /* sin(0.28020) */
-  0.9818132244, /* sin(0.28040) */
-  0.9815738774, /* sin(0.28060) */
-  0.9813329805, /* sin(0.28080) */
-  0.9810905339, /* sin(0.28100) */
-  0.9808465380, /* sin(0.28120) */
-  0.9806009932, /* sin(0.28140) */
-  0.9803538999, /* sin(0.28160) */
-  0.9801052585, /* sin(0.28180) */
-  0.9798550694, /* sin(0.28200) */
-  0.9796033329, /* sin(0.28220) */
-  0.9793500496, /* sin(0.28240) */
-  0.9790952197, /* sin(0.28260) */
-  0.9788388437, /* sin(0.28280) */
-  0.9785809219, /* sin(0.28300) */
-  0.9783214549, /* sin(0.28320) */
-  0.9780604429, /* sin(0.28340) */
-  0.9777978865, /* sin(0.28360) */
-  0.9775337859, /* sin(0.28380) */
-  0.9772681418, /* sin(0.28400) */
-  0.9770009543, /* sin(0.28420) */
-  0.9767322241, /* sin(0.28440) */
-  0.9764619515, /* sin(0.28460) */
-  0.9761901369, /* sin(0.28480) */
-  0.9759167807, /* sin(0.28500) */
-  0.9756418835, /* sin(0.28520) */
-  0.9753654456, /* sin(0.28540) */
-  0.9750874674, /* sin(0.28560) */
-  0.9748079495, /* sin(0.28580) */
-  0.9745268922, /* sin(0.28600) */
-  0.9742442959, /* sin(0.28620) */
-  0.9739601613, /* sin(0.28640) */
-  0.9736744886, /* sin(0.28660) */
-  0.9733872783, /* sin(0.28680) */
-  0.9730985310, /* sin(0.28700) */
-  0.9728082469, /* sin(0.28720) */
-  0.9725164267, /* sin(0.28740) */
-  0.9722230707, /* sin(0.28760) */
-  0.9719281795, /* sin(0.28780) */
-  0.9716317535, /* sin(0.28800) */
-  0.9713337931, /* sin(0.28820) */
-  0.9710342989, /* sin(0.28840) */
-  0.9707332712, /* sin(0.28860) */
-  0.9704307107, /* sin(0.28880) */
-  0.9701266177, /* sin(0.28900) */
-  0.9698209927, /* sin(0.28920) */
-  0.9695138363, /* sin(0.28940) */
-  0.9692051488, /* sin(0.28960) */
-  0.9688949309, /* sin(0.28980) */
-  0.9685831829, /* sin(0.29000) */
-  0.9682699054, /* sin(0.29020) */
-  0.9679550989, /* sin(0.29040) */
-  0.9676387639, /* sin(0.29060) */
-  0.9673209008, /* sin(0.29080) */
-  0.9670015102, /* sin(0.29100) */
-  0.9666805925, /* sin(0.29120) */
-  0.9663581483, /* sin(0.29140) */
-  0.9660341782, /* sin(0.29160) */
-  0.9657086825, /* sin(0.29180) */
-  0.9653816618, /* sin(0.29200) */
-  0.9650531167, /* sin(0.29220) */
-  0.9647230476, /* sin(0.29240) */
-  0.9643914551, /* sin(0.29260) */
-  0.9640583397, /* sin(0.29280) */
-  0.9637237019, /* sin(0.29300) */
-  0.9633875423, /* sin(0.29320) */
-  0.9630498613, /* sin(0.29340) */
-  0.9627106595, /* sin(0.29360) */
-  0.9623699375, /* sin(0.29380) */
-  0.9620276958, /* sin(0.29400) */
-  0.9616839349, /* sin(0.29420) */
-  0.9613386554, /* sin(0.29440) */
-  0.9609918578, /* sin(0.29460) */
-  0.9606435427, /* sin(0.29480) */
-  0.9602937105, /* sin(0.29500) */
-  0.9599423620, /* sin(0.29520) */
-  0.9595894975, /* sin(0.29540) */
-  0.9592351178, /* sin(0.29560) */
-  0.9588792232, /* sin(0.29580) */
-  0.9585218145, /* sin(0.29600) */
-  0.9581628921, /* sin(0.29620) */
-  0.9578024567, /* sin(0.29640) */
-  0.9574405088, /* sin(0.29660) */
-  0.9570770489, /* sin(0.29680) */
-  0.9567120777, /* sin(0.29700) */
-  0.9563455957, /* sin(0.29720) */
-  0.9559776035, /* sin(0.29740) */
-  0.9556081016, /* sin(0.29760) */
-  0.9552370908, /* sin(0.29780) */
-  0.9548645715, /* sin(0.29800) */
-  0.9544905443, /* sin(0.29820) */
-  0.9541150099, /* sin(0.29840) */
-  0.9537379688, /* sin(0.29860) */
-  0.9533594216, /* sin(0.29880) */
-  0.9529793689, /* sin(0.29900) */
-  0.9525978113, /* sin(0.29920) */
-  0.9522147495, /* sin(0.29940) */
-  0.9518301839, /* sin(0.29960) */
-  0.9514441153, /* sin(0.29980) */
-  0.9510565443, /* sin(0.30000) */
-  0.9506674714, /* sin(0.30020) */
-  0.9502768973, /* sin(0.30040) */
-  0.9498848225, /* sin(0.30060) */
-  0.9494912477, /* sin(0.30080) */
-  0.9490961736, /* sin(0.30100) */
-  0.9486996007, /* sin(0.30120) */
-  0.9483015297, /* sin(0.30140) */
-  0.9479019612, /* sin(0.30160) */
-  0.9475008959, /* sin(0.30180) */
-  0.9470983343, /* sin(0.30200) */
-  0.9466942771, /* sin(0.30220) */
-  0.9462887249, /* sin(0.30240) */
-  0.9458816784, /* sin(0.30260) */
-  0.9454731383, /* sin(0.30280) */
-  0.9450631051, /* sin(0.30300) */
-  0.9446515795, /* sin(0.30320) */
-  0.9442385622, /* sin(0.30340) */
-  0.9438240538, /* sin(0.30360) */
-  0.9434080550, /* sin(0.30380) */
-  0.9429905664, /* sin(0.30400) */
-  0.9425715888, /* sin(0.30420) */
-  0.9421511226, /* sin(0.30440) */
-  0.9417291687, /* sin(0.30460) */
-  0.9413057276, /* sin(0.30480) */
-  0.9408808002, /* sin(0.30500) */
-  0.9404543869, /* sin(0.30520) */
-  0.9400264885, /* sin(0.30540) */
-  0.9395971057, /* sin(0.30560) */
-  0.9391662391, /* sin(0.30580) */
-  0.9387338895, /* sin(0.30600) */
-  0.9383000575, /* sin(0.30620) */
-  0.9378647438, /* sin(0.30640) */
-  0.9374279490, /* sin(0.30660) */
-  0.9369896739, /* sin(0.30680) */
-  0.9365499192, /* sin(0.30700) */
-  0.9361086856, /* sin(0.30720) */
-  0.9356659737, /* sin(0.30740) */
-  0.9352217843, /* sin(0.30760) */
-  0.9347761180, /* sin(0.30780) */
-  0.9343289756, /* sin(0.30800) */
-  0.9338803578, /* sin(0.30820) */
-  0.9334302652, /* sin(0.30840) */
-  0.9329786986, /* sin(0.30860) */
-  0.9325256587, /* sin(0.30880) */
-  0.9320711463, /* sin(0.30900) */
-  0.9316151619, /* sin(0.30920) */
-  0.9311577064, /* sin(0.30940) */
-  0.9306987805, /* sin(0.30960) */
-  0.9302383849, /* sin(0.30980) */
-  0.9297765204, /* sin(0.31000) */
-  0.9293131875, /* sin(0.31020) */
-  0.9288483872, /* sin(0.31040) */
-  0.9283821201, /* sin(0.31060) */
-  0.9279143869, /* sin(0.31080) */
-  0.9274451885, /* sin(0.31100) */
-  0.9269745254, /* sin(0.31120) */
-  0.9265023986, /* sin(0.31140) */
-  0.9260288087, /* sin(0.31160) */
-  0.9255537564, /* sin(0.31180) */
-  0.9250772426, /* sin(0.31200) */
-  0.9245992680, /* sin(0.31220) */
-  0.9241198333, /* sin(0.31240) */
-  0.9236389392, /* sin(0.31260) */
-  0.9231565867, /* sin(0.31280) */
-  0.9226727763, /* sin(0.31300) */
-  0.9221875089, /* sin(0.31320) */
-  0.9217007853, /* sin(0.31340) */
-  0.9212126061, /* sin(0.31360) */
-  0.9207229723, /* sin(0.31380) */
-  0.9202318845, /* sin(0.31400) */
-  0.9197393435, /* sin(0.31420) */
-  0.9192453501, /* sin(0.31440) */
-  0.9187499051, /* sin(0.31460) */
-  0.9182530093, /* sin(0.31480) */
-  0.9177546635, /* sin(0.31500) */
-  0.9172548683, /* sin(0.31520) */
-  0.9167536247, /* sin(0.31540) */
-  0.9162509335, /* sin(0.31560) */
-  0.9157467953, /* sin(0.31580) */
-  0.9152412111, /* sin(0.31600) */
-  0.9147341815, /* sin(0.31620) */
-  0.9142257075, /* sin(0.31640) */
-  0.9137157898, /* sin(0.31660) */
-  0.9132044292, /* sin(0.31680) */
-  0.9126916265, /* sin(0.31700) */
-  0.9121773826, /* sin(0.31720) */
-  0.9116616982, /* sin(0.31740) */
-  0.9111445742, /* sin(0.31760) */
-  0.9106260113, /* sin(0.31780) */
-  0.9101060105, /* sin(0.31800) */
-  0.9095845724, /* sin(0.31820) */
-  0.9090616981, /* sin(0.31840) */
-  0.9085373881, /* sin(0.31860) */
-  0.9080116435, /* sin(0.31880) */
-  0.9074844650, /* sin(0.31900) */
-  0.9069558535, /* sin(0.31920) */
-  0.9064258097, /* sin(0.31940) */
-  0.9058943346, /* sin(0.31960) */
-  0.9053614290, /* sin(0.31980) */
-  0.9048270936, /* sin(0.32000) */
-  0.9042913294, /* sin(0.32020) */
-  0.9037541372, /* sin(0.32040) */
-  0.9032155179, /* sin(0.32060) */
-  0.9026754723, /* sin(0.32080) */
-  0.9021340012, /* sin(0.32100) */
-  0.9015911055, /* sin(0.32120) */
-  0.9010467861, /* sin(0.32140) */
-  0.9005010438, /* sin(0.32160) */
-  0.8999538795, /* sin(0.32180) */
-  0.8994052941, /* sin(0.32200) */
-  0.8988552883, /* sin(0.32220) */
-  0.8983038632, /* sin(0.32240) */
-  0.8977510195, /* sin(0.32260) */
-  0.8971967581, /* sin(0.32280) */
-  0.8966410800, /* sin(0.32300) */
-  0.8960839859, /* sin(0.32320) */
-  0.8955254768, /* sin(0.32340) */
-  0.8949655535, /* sin(0.32360) */
-  0.8944042170, /* sin(0.32380) */
-  0.8938414680, /* sin(0.32400) */
-  0.8932773076, /* sin(0.32420) */
-  0.8927117366, /* sin(0.32440) */
-  0.8921447558, /* sin(0.32460) */
-  0.8915763662, /* sin(0.32480) */
-  0.8910065687, /* sin(0.32500) */
-  0.8904353642, /* sin(0.32520) */
-  0.8898627536, /* sin(0.32540) */
-  0.8892887378, /* sin(0.32560) */
-  0.8887133176, /* sin(0.32580) */
-  0.8881364941, /* sin(0.32600) */
-  0.8875582680, /* sin(0.32620) */
-  0.8869786404, /* sin(0.32640) */
-  0.8863976121, /* sin(0.32660) */
-  0.8858151841, /* sin(0.32680) */
-  0.8852313573, /* sin(0.32700) */
-  0.8846461325, /* sin(0.32720) */
-  0.8840595108, /* sin(0.32740) */
-  0.8834714930, /* sin(0.32760) */
-  0.8828820801, /* sin(0.32780) */
-  0.8822912731, /* sin(0.32800) */
-  0.8816990727, /* sin(0.32820) */
-  0.8811054801, /* sin(0.32840) */
-  0.8805104960, /* sin(0.32860) */
-  0.8799141215, /* sin(0.32880) */
-  0.8793163575, /* sin(0.32900) */
-  0.8787172049, /* sin(0.32920) */
-  0.8781166648, /* sin(0.32940) */
-  0.8775147379, /* sin(0.32960) */
-  0.8769114254, /* sin(0.32980) */
-  0.8763067281, /* sin(0.33000) */
-  0.8757006469, /* sin(0.33020) */
-  0.8750931829, /* sin(0.33040) */
-  0.8744843371, /* sin(0.33060) */
-  0.8738741103, /* sin(0.33080) */
-  0.8732625035, /* sin(0.33100) */
-  0.8726495177, /* sin(0.33120) */
-  0.8720351540, /* sin(0.33140) */
-  0.8714194131, /* sin(0.33160) */
-  0.8708022961, /* sin(0.33180) */
-  0.8701838041, /* sin(0.33200) */
-  0.8695639379, /* sin(0.33220) */
-  0.8689426985, /* sin(0.33240) */
-  0.8683200870, /* sin(0.33260) */
-  0.8676961042, /* sin(0.33280) */
-  0.8670707513, /* sin(0.33300) */
-  0.8664440291, /* sin(0.33320) */
-  0.8658159387, /* sin(0.33340) */
-  0.8651864810, /* sin(0.33360) */
-  0.8645556571, /* sin(0.33380) */
-  0.8639234680, /* sin(0.33400) */
-  0.8632899146, /* sin(0.33420) */
-  0.8626549979, /* sin(0.33440) */
-  0.8620187190, /* sin(0.33460) */
-  0.8613810789, /* sin(0.33480) */
-  0.8607420785, /* sin(0.33500) */
-  0.8601017189, /* sin(0.33520) */
-  0.8594600011, /* sin(0.33540) */
-  0.8588169260, /* sin(0.33560) */
-  0.8581724948, /* sin(0.33580) */
-  0.8575267084, /* sin(0.33600) */
-  0.8568795678, /* sin(0.33620) */
-  0.8562310742, /* sin(0.33640) */
-  0.8555812284, /* sin(0.33660) */
-  0.8549300315, /* sin(0.33680) */
-  0.8542774846, /* sin(0.33700) */
-  0.8536235887, /* sin(0.33720) */
-  0.8529683447, /* sin(0.33740) */
-  0.8523117539, /* sin(0.33760) */
-  0.8516538171, /* sin(0.33780) */
-  0.8509945354, /* sin(0.33800) */
-  0.8503339099, /* sin(0.33820) */
-  0.8496719416, /* sin(0.33840) */
-  0.8490086315, /* sin(0.33860) */
-  0.8483439808, /* sin(0.33880) */
-  0.8476779904, /* sin(0.33900) */
-  0.8470106614, /* sin(0.33920) */
-  0.8463419949, /* sin(0.33940) */
-  0.8456719918, /* sin(0.33960) */
-  0.8450006534, /* sin(0.33980) */
-  0.8443279805, /* sin(0.34000) */
-  0.8436539744, /* sin(0.34020) */
-  0.8429786360, /* sin(0.34040) */
-  0.8423019664, /* sin(0.34060) */
-  0.8416239667, /* sin(0.34080) */
-  0.8409446380, /* sin(0.34100) */
-  0.8402639813, /* sin(0.34120) */
-  0.8395819978, /* sin(0.34140) */
-  0.8388986884, /* sin(0.34160) */
-  0.8382140543, /* sin(0.34180) */
-  0.8375280965, /* sin(0.34200) */
-  0.8368408161, /* sin(0.34220) */
-  0.8361522143, /* sin(0.34240) */
-  0.8354622921, /* sin(0.34260) */
-  0.8347710505, /* sin(0.34280) */
-  0.8340784908, /* sin(0.34300) */
-  0.8333846139, /* sin(0.34320) */
-  0.8326894210, /* sin(0.34340) */
-  0.8319929131, /* sin(0.34360) */
-  0.8312950914, /* sin(0.34380) */
-  0.8305959570, /* sin(0.34400) */
-  0.8298955110, /* sin(0.34420) */
-  0.8291937545, /* sin(0.34440) */
-  0.8284906885, /* sin(0.34460) */
-  0.8277863143, /* sin(0.34480) */
-  0.8270806328, /* sin(0.34500) */
-  0.8263736453, /* sin(0.34520) */
-  0.8256653529, /* sin(0.34540) */
-  0.8249557565, /* sin(0.34560) */
-  0.8242448575, /* sin(0.34580) */
-  0.8235326569, /* sin(0.34600) */
-  0.8228191558, /* sin(0.34620) */
-  0.8221043554, /* sin(0.34640) */
-  0.8213882567, /* sin(0.34660) */
-  0.8206708610, /* sin(0.34680) */
-  0.8199521693, /* sin(0.34700) */
-  0.8192321828, /* sin(0.34720) */
-  0.8185109026, /* sin(0.34740) */
-  0.8177883299, /* sin(0.34760) */
-  0.8170644658, /* sin(0.34780) */
-  0.8163393114, /* sin(0.34800) */
-  0.8156128679, /* sin(0.34820) */
-  0.8148851365, /* sin(0.34840) */
-  0.8141561182, /* sin(0.34860) */
-  0.8134258143, /* sin(0.34880) */
-  0.8126942258, /* sin(0.34900) */
-  0.8119613541, /* sin(0.34920) */
-  0.8112272001, /* sin(0.34940) */
-  0.8104917650, /* sin(0.34960) */
-  0.8097550501, /* sin(0.34980) */
-  0.8090170565, /* sin(0.35000) */
-  0.8082777853, /* sin(0.35020) */
-  0.8075372378, /* sin(0.35040) */
-  0.8067954150, /* sin(0.35060) */
-  0.8060523182, /* sin(0.35080) */
-  0.8053079486, /* sin(0.35100) */
-  0.8045623072, /* sin(0.35120) */
-  0.8038153953, /* sin(0.35140) */
-  0.8030672141, /* sin(0.35160) */
-  0.8023177648, /* sin(0.35180) */
-  0.8015670484, /* sin(0.35200) */
-  0.8008150663, /* sin(0.35220) */
-  0.8000618196, /* sin(0.35240) */
-  0.7993073095, /* sin(0.35260) */
-  0.7985515372, /* sin(0.35280) */
-  0.7977945038, /* sin(0.35300) */
-  0.7970362106, /* sin(0.35320) */
-  0.7962766588, /* sin(0.35340) */
-  0.7955158496, /* sin(0.35360) */
-  0.7947537841, /* sin(0.35380) */
-  0.7939904636, /* sin(0.35400) */
-  0.7932258893, /* sin(0.35420) */
-  0.7924600624, /* sin(0.35440) */
-  0.7916929841, /* sin(0.35460) */
-  0.7909246556, /* sin(0.35480) */
-  0.7901550781, /* sin(0.35500) */
-  0.7893842528, /* sin(0.35520) */
-  0.7886121810, /* sin(0.35540) */
-  0.7878388639, /* sin(0.35560) */
-  0.7870643027, /* sin(0.35580) */
-  0.7862884986, /* sin(0.35600) */
-  0.7855114528, /* sin(0.35620) */
-  0.7847331666, /* sin(0.35640) */
-  0.7839536412, /* sin(0.35660) */
-  0.7831728778, /* sin(0.35680) */
-  0.7823908777, /* sin(0.35700) */
-  0.7816076421, /* sin(0.35720) */
-  0.7808231722, /* sin(0.35740) */
-  0.7800374693, /* sin(0.35760) */
-  0.7792505347, /* sin(0.35780) */
-  0.7784623694, /* sin(0.35800) */
-  0.7776729749, /* sin(0.35820) */
-  0.7768823523, /* sin(0.35840) */
-  0.7760905029, /* sin(0.35860) */
-  0.7752974280, /* sin(0.35880) */
-  0.7745031288, /* sin(0.35900) */
-  0.7737076065, /* sin(0.35920) */
-  0.7729108624, /* sin(0.35940) */
-  0.7721128978, /* sin(0.35960) */
-  0.7713137140, /* sin(0.35980) */
-  0.7705133121, /* sin(0.36000) */
-  0.7697116934, /* sin(0.36020) */
-  0.7689088593, /* sin(0.36040) */
-  0.7681048110, /* sin(0.36060) */
-  0.7672995498, /* sin(0.36080) */
-  0.7664930768, /* sin(0.36100) */
-  0.7656853935, /* sin(0.36120) */
-  0.7648765010, /* sin(0.36140) */
-  0.7640664008, /* sin(0.36160) */
-  0.7632550939, /* sin(0.36180) */
-  0.7624425817, /* sin(0.36200) */
-  0.7616288656, /* sin(0.36220) */
-  0.7608139467, /* sin(0.36240) */
-  0.7599978265, /* sin(0.36260) */
-  0.7591805060, /* sin(0.36280) */
-  0.7583619867, /* sin(0.36300) */
-  0.7575422699, /* sin(0.36320) */
-  0.7567213568, /* sin(0.36340) */
-  0.7558992487, /* sin(0.36360) */
-  0.7550759470, /* sin(0.36380) */
-  0.7542514529, /* sin(0.36400) */
-  0.7534257677, /* sin(0.36420) */
-  0.7525988928, /* sin(0.36440) */
-  0.7517708294, /* sin(0.36460) */
-  0.7509415789, /* sin(0.36480) */
-  0.7501111425, /* sin(0.36500) */
-  0.7492795216, /* sin(0.36520) */
-  0.7484467175, /* sin(0.36540) */
-  0.7476127315, /* sin(0.36560) */
-  0.7467775649, /* sin(0.36580) */
-  0.7459412190, /* sin(0.36600) */
-  0.7451036952, /* sin(0.36620) */
-  0.7442649948, /* sin(0.36640) */
-  0.7434251191, /* sin(0.36660) */
-  0.7425840694, /* sin(0.36680) */
-  0.7417418471, /* sin(0.36700) */
-  0.7408984534, /* sin(0.36720) */
-  0.7400538898, /* sin(0.36740) */
-  0.7392081575, /* sin(0.36760) */
-  0.7383612580, /* sin(0.36780) */
-  0.7375131924, /* sin(0.36800) */
-  0.7366639622, /* sin(0.36820) */
-  0.7358135687, /* sin(0.36840) */
-  0.7349620133, /* sin(0.36860) */
-  0.7341092973, /* sin(0.36880) */
-  0.7332554220, /* sin(0.36900) */
-  0.7324003888, /* sin(0.36920) */
-  0.7315441990, /* sin(0.36940) */
-  0.7306868541, /* sin(0.36960) */
-  0.7298283552, /* sin(0.36980) */
-  0.7289687039, /* sin(0.37000) */
-  0.7281079014, /* sin(0.37020) */
-  0.7272459492, /* sin(0.37040) */
-  0.7263828485, /* sin(0.37060) */
-  0.7255186008, /* sin(0.37080) */
-  0.7246532074, /* sin(0.37100) */
-  0.7237866697, /* sin(0.37120) */
-  0.7229189890, /* sin(0.37140) */
-  0.7220501667, /* sin(0.37160) */
-  0.7211802042, /* sin(0.37180) */
-  0.7203091028, /* sin(0.37200) */
-  0.7194368640, /* sin(0.37220) */
-  0.7185634891, /* sin(0.37240) */
-  0.7176889795, /* sin(0.37260) */
-  0.7168133366, /* sin(0.37280) */
-  0.7159365617, /* sin(0.37300) */
-  0.7150586562, /* sin(0.37320) */
-  0.7141796216, /* sin(0.37340) */
-  0.7132994592, /* sin(0.37360) */
-  0.7124181704, /* sin(0.37380) */
-  0.7115357566, /* sin(0.37400) */
-  0.7106522191, /* sin(0.37420) */
-  0.7097675595, /* sin(0.37440) */
-  0.7088817790, /* sin(0.37460) */
-  0.7079948792, /* sin(0.37480) */
-  0.7071068613, /* sin(0.37500) */
-  0.7062177267, /* sin(0.37520) */
-  0.7053274770, /* sin(0.37540) */
-  0.7044361135, /* sin(0.37560) */
-  0.7035436375, /* sin(0.37580) */
-  0.7026500506, /* sin(0.37600) */
-  0.7017553541, /* sin(0.37620) */
-  0.7008595494, /* sin(0.37640) */
-  0.6999626380, /* sin(0.37660) */
-  0.6990646212, /* sin(0.37680) */
-  0.6981655005, /* sin(0.37700) */
-  0.6972652773, /* sin(0.37720) */
-  0.6963639531, /* sin(0.37740) */
-  0.6954615291, /* sin(0.37760) */
-  0.6945580070, /* sin(0.37780) */
-  0.6936533880, /* sin(0.37800) */
-  0.6927476737, /* sin(0.37820) */
-  0.6918408655, /* sin(0.37840) */
-  0.6909329647, /* sin(0.37860) */
-  0.6900239728, /* sin(0.37880) */
-  0.6891138913, /* sin(0.37900) */
-  0.6882027216, /* sin(0.37920) */
-  0.6872904652, /* sin(0.37940) */
-  0.6863771234, /* sin(0.37960) */
-  0.6854626977, /* sin(0.37980) */
-  0.6845471896, /* sin(0.38000) */
-  0.6836306005, /* sin(0.38020) */
-  0.6827129318, /* sin(0.38040) */
-  0.6817941851, /* sin(0.38060) */
-  0.6808743617, /* sin(0.38080) */
-  0.6799534631, /* sin(0.38100) */
-  0.6790314908, /* sin(0.38120) */
-  0.6781084462, /* sin(0.38140) */
-  0.6771843307, /* sin(0.38160) */
-  0.6762591459, /* sin(0.38180) */
-  0.6753328932, /* sin(0.38200) */
-  0.6744055740, /* sin(0.38220) */
-  0.6734771899, /* sin(0.38240) */
-  0.6725477423, /* sin(0.38260) */
-  0.6716172326, /* sin(0.38280) */
-  0.6706856623, /* sin(0.38300) */
-  0.6697530330, /* sin(0.38320) */
-  0.6688193460, /* sin(0.38340) */
-  0.6678846028, /* sin(0.38360) */
-  0.6669488050, /* sin(0.38380) */
-  0.6660119539, /* sin(0.38400) */
-  0.6650740512, /* sin(0.38420) */
-  0.6641350982, /* sin(0.38440) */
-  0.6631950964, /* sin(0.38460) */
-  0.6622540474, /* sin(0.38480) */
-  0.6613119525, /* sin(0.38500) */
-  0.6603688134, /* sin(0.38520) */
-  0.6594246315, /* sin(0.38540) */
-  0.6584794082, /* sin(0.38560) */
-  0.6575331451, /* sin(0.38580) */
-  0.6565858437, /* sin(0.38600) */
-  0.6556375054, /* sin(0.38620) */
-  0.6546881318, /* sin(0.38640) */
-  0.6537377244, /* sin(0.38660) */
-  0.6527862846, /* sin(0.38680) */
-  0.6518338139, /* sin(0.38700) */
-  0.6508803140, /* sin(0.38720) */
-  0.6499257862, /* sin(0.38740) */
-  0.6489702321, /* sin(0.38760) */
-  0.6480136531, /* sin(0.38780) */
-  0.6470560509, /* sin(0.38800) */
-  0.6460974269, /* sin(0.38820) */
-  0.6451377826, /* sin(0.38840) */
-  0.6441771195, /* sin(0.38860) */
-  0.6432154392, /* sin(0.38880) */
-  0.6422527432, /* sin(0.38900) */
-  0.6412890330, /* sin(0.38920) */
-  0.6403243101, /* sin(0.38940) */
-  0.6393585760, /* sin(0.38960) */
-  0.6383918323, /* sin(0.38980) */
-  0.6374240805, /* sin(0.39000) */
-  0.6364553221, /* sin(0.39020) */
-  0.6354855587, /* sin(0.39040) */
-  0.6345147917, /* sin(0.39060) */
-  0.6335430228, /* sin(0.39080) */
-  0.6325702534, /* sin(0.39100) */
-  0.6315964851, /* sin(0.39120) */
-  0.6306217194, /* sin(0.39140) */
-  0.6296459578, /* sin(0.39160) */
-  0.6286692020, /* sin(0.39180) */
-  0.6276914534, /* sin(0.39200) */
-  0.6267127137, /* sin(0.39220) */
-  0.6257329842, /* sin(0.39240) */
-  0.6247522666, /* sin(0.39260) */
-  0.6237705625, /* sin(0.39280) */
-  0.6227878733, /* sin(0.39300) */
-  0.6218042007, /* sin(0.39320) */
-  0.6208195462, /* sin(0.39340) */
-  0.6198339113, /* sin(0.39360) */
-  0.6188472976, /* sin(0.39380) */
-  0.6178597066, /* sin(0.39400) */
-  0.6168711400, /* sin(0.39420) */
-  0.6158815993, /* sin(0.39440) */
-  0.6148910860, /* sin(0.39460) */
-  0.6138996016, /* sin(0.39480) */
-  0.6129071479, /* sin(0.39500) */
-  0.6119137263, /* sin(0.39520) */
-  0.6109193384, /* sin(0.39540) */
-  0.6099239858, /* sin(0.39560) */
-  0.6089276700, /* sin(0.39580) */
-  0.6079303926, /* sin(0.39600) */
-  0.6069321553, /* sin(0.39620) */
-  0.6059329595, /* sin(0.39640) */
-  0.6049328069, /* sin(0.39660) */
-  0.6039316989, /* sin(0.39680) */
-  0.6029296373, /* sin(0.39700) */
-  0.6019266236, /* sin(0.39720) */
-  0.6009226594, /* sin(0.39740) */
-  0.5999177462, /* sin(0.39760) */
-  0.5989118857, /* sin(0.39780) */
-  0.5979050794, /* sin(0.39800) */
-  0.5968973289, /* sin(0.39820) */
-  0.5958886359, /* sin(0.39840) */
-  0.5948790019, /* sin(0.39860) */
-  0.5938684284, /* sin(0.39880) */
-  0.5928569172, /* sin(0.39900) */
-  0.5918444698, /* sin(0.39920) */
-  0.5908310877, /* sin(0.39940) */
-  0.5898167727, /* sin(0.39960) */
-  0.5888015263, /* sin(0.39980) */
-  0.5877853500, /* sin(0.40000) */
-  0.5867682456, /* sin(0.40020) */
-  0.5857502146, /* sin(0.40040) */
-  0.5847312586, /* sin(0.40060) */
-  0.5837113792, /* sin(0.40080) */
-  0.5826905781, /* sin(0.40100) */
-  0.5816688568, /* sin(0.40120) */
-  0.5806462170, /* sin(0.40140) */
-  0.5796226603, /* sin(0.40160) */
-  0.5785981882, /* sin(0.40180) */
-  0.5775728025, /* sin(0.40200) */
-  0.5765465047, /* sin(0.40220) */
-  0.5755192965, /* sin(0.40240) */
-  0.5744911795, /* sin(0.40260) */
-  0.5734621552, /* sin(0.40280) */
-  0.5724322254, /* sin(0.40300) */
-  0.5714013916, /* sin(0.40320) */
-  0.5703696555, /* sin(0.40340) */
-  0.5693370187, /* sin(0.40360) */
-  0.5683034829, /* sin(0.40380) */
-  0.5672690496, /* sin(0.40400) */
-  0.5662337205, /* sin(0.40420) */
-  0.5651974973, /* sin(0.40440) */
-  0.5641603815, /* sin(0.40460) */
-  0.5631223749, /* sin(0.40480) */
-  0.5620834790, /* sin(0.40500) */
-  0.5610436955, /* sin(0.40520) */
-  0.5600030261, /* sin(0.40540) */
-  0.5589614723, /* sin(0.40560) */
-  0.5579190358, /* sin(0.40580) */
-  0.5568757183, /* sin(0.40600) */
-  0.5558315215, /* sin(0.40620) */
-  0.5547864469, /* sin(0.40640) */
-  0.5537404962, /* sin(0.40660) */
-  0.5526936710, /* sin(0.40680) */
-  0.5516459731, /* sin(0.40700) */
-  0.5505974041, /* sin(0.40720) */
-  0.5495479656, /* sin(0.40740) */
-  0.5484976593, /* sin(0.40760) */
-  0.5474464869, /* sin(0.40780) */
-  0.5463944499, /* sin(0.40800) */
-  0.5453415501, /* sin(0.40820) */
-  0.5442877892, /* sin(0.40840) */
-  0.5432331688, /* sin(0.40860) */
-  0.5421776905, /* sin(0.40880) */
-  0.5411213560, /* sin(0.40900) */
-  0.5400641670, /* sin(0.40920) */
-  0.5390061252, /* sin(0.40940) */
-  0.5379472323, /* sin(0.40960) */
-  0.5368874898, /* sin(0.40980) */
-  0.5358268995, /* sin(0.41000) */
-  0.5347654631, /* sin(0.41020) */
-  0.5337031822, /* sin(0.41040) */
-  0.5326400585, /* sin(0.41060) */
-  0.5315760937, /* sin(0.41080) */
-  0.5305112895, /* sin(0.41100) */
-  0.5294456475, /* sin(0.41120) */
-  0.5283791695, /* sin(0.41140) */
-  0.5273118571, /* sin(0.41160) */
-  0.5262437120, /* sin(0.41180) */
-  0.5251747358, /* sin(0.41200) */
-  0.5241049304, /* sin(0.41220) */
-  0.5230342973, /* sin(0.41240) */
-  0.5219628383, /* sin(0.41260) */
-  0.5208905550, /* sin(0.41280) */
-  0.5198174492, /* sin(0.41300) */
-  0.5187435225, /* sin(0.41320) */
-  0.5176687766, /* sin(0.41340) */
-  0.5165932133, /* sin(0.41360) */
-  0.5155168342, /* sin(0.41380) */
-  0.5144396410, /* sin(0.41400) */
-  0.5133616354, /* sin(0.41420) */
-  0.5122828192, /* sin(0.41440) */
-  0.5112031941, /* sin(0.41460) */
-  0.5101227616, /* sin(0.41480) */
-  0.5090415236, /* sin(0.41500) */
-  0.5079594818, /* sin(0.41520) */
-  0.5068766378, /* sin(0.41540) */
-  0.5057929934, /* sin(0.41560) */
-  0.5047085503, /* sin(0.41580) */
-  0.5036233102, /* sin(0.41600) */
-  0.5025372748, /* sin(0.41620) */
-  0.5014504458, /* sin(0.41640) */
-  0.5003628249, /* sin(0.41660) */
-  0.4992744139, /* sin(0.41680) */
-  0.4981852145, /* sin(0.41700) */
-  0.4970952284, /* sin(0.41720) */
-  0.4960044573, /* sin(0.41740) */
-  0.4949129030, /* sin(0.41760) */
-  0.4938205671, /* sin(0.41780) */
-  0.4927274514, /* sin(0.41800) */
-  0.4916335576, /* sin(0.41820) */
-  0.4905388875, /* sin(0.41840) */
-  0.4894434427, /* sin(0.41860) */
-  0.4883472251, /* sin(0.41880) */
-  0.4872502362, /* sin(0.41900) */
-  0.4861524780, /* sin(0.41920) */
-  0.4850539520, /* sin(0.41940) */
-  0.4839546601, /* sin(0.41960) */
-  0.4828546039, /* sin(0.41980) */
-  0.4817537852, /* sin(0.42000) */
-  0.4806522058, /* sin(0.42020) */
-  0.4795498674, /* sin(0.42040) */
-  0.4784467717, /* sin(0.42060) */
-  0.4773429205, /* sin(0.42080) */
-  0.4762383155, /* sin(0.42100) */
-  0.4751329584, /* sin(0.42120) */
-  0.4740268510, /* sin(0.42140) */
-  0.4729199951, /* sin(0.42160) */
-  0.4718123924, /* sin(0.42180) */
-  0.4707040446, /* sin(0.42200) */
-  0.4695949535, /* sin(0.42220) */
-  0.4684851209, /* sin(0.42240) */
-  0.4673745484, /* sin(0.42260) */
-  0.4662632379, /* sin(0.42280) */
-  0.4651511912, /* sin(0.42300) */
-  0.4640384098, /* sin(0.42320) */
-  0.4629248957, /* sin(0.42340) */
-  0.4618106506, /* sin(0.42360) */
-  0.4606956762, /* sin(0.42380) */
-  0.4595799743, /* sin(0.42400) */
-  0.4584635467, /* sin(0.42420) */
-  0.4573463951, /* sin(0.42440) */
-  0.4562285213, /* sin(0.42460) */
-  0.4551099270, /* sin(0.42480) */
-  0.4539906141, /* sin(0.42500) */
-  0.4528705842, /* sin(0.42520) */
-  0.4517498392, /* sin(0.42540) */
-  0.4506283809, /* sin(0.42560) */
-  0.4495062109, /* sin(0.42580) */
-  0.4483833311, /* sin(0.42600) */
-  0.4472597432, /* sin(0.42620) */
-  0.4461354491, /* sin(0.42640) */
-  0.4450104504, /* sin(0.42660) */
-  0.4438847490, /* sin(0.42680) */
-  0.4427583467, /* sin(0.42700) */
-  0.4416312451, /* sin(0.42720) */
-  0.4405034462, /* sin(0.42740) */
-  0.4393749517, /* sin(0.42760) */
-  0.4382457633, /* sin(0.42780) */
-  0.4371158829, /* sin(0.42800) */
-  0.4359853122, /* sin(0.42820) */
-  0.4348540531, /* sin(0.42840) */
-  0.4337221072, /* sin(0.42860) */
-  0.4325894764, /* sin(0.42880) */
-  0.4314561626, /* sin(0.42900) */
-  0.4303221673, /* sin(0.42920) */
-  0.4291874926, /* sin(0.42940) */
-  0.4280521401, /* sin(0.42960) */
-  0.4269161117, /* sin(0.42980) */
-  0.4257794091, /* sin(0.43000) */
-  0.4246420341, /* sin(0.43020) */
-  0.4235039886, /* sin(0.43040) */
-  0.4223652743, /* sin(0.43060) */
-  0.4212258930, /* sin(0.43080) */
-  0.4200858465, /* sin(0.43100) */
-  0.4189451367, /* sin(0.43120) */
-  0.4178037653, /* sin(0.43140) */
-  0.4166617341, /* sin(0.43160) */
-  0.4155190450, /* sin(0.43180) */
-  0.4143756997, /* sin(0.43200) */
-  0.4132317001, /* sin(0.43220) */
-  0.4120870479, /* sin(0.43240) */
-  0.4109417449, /* sin(0.43260) */
-  0.4097957931, /* sin(0.43280) */
-  0.4086491941, /* sin(0.43300) */
-  0.4075019498, /* sin(0.43320) */
-  0.4063540620, /* sin(0.43340) */
-  0.4052055325, /* sin(0.43360) */
-  0.4040563631, /* sin(0.43380) */
-  0.4029065557, /* sin(0.43400) */
-  0.4017561120, /* sin(0.43420) */
-  0.4006050339, /* sin(0.43440) */
-  0.3994533232, /* sin(0.43460) */
-  0.3983009817, /* sin(0.43480) */
-  0.3971480112, /* sin(0.43500) */
-  0.3959944136, /* sin(0.43520) */
-  0.3948401906, /* sin(0.43540) */
-  0.3936853442, /* sin(0.43560) */
-  0.3925298760, /* sin(0.43580) */
-  0.3913737880, /* sin(0.43600) */
-  0.3902170820, /* sin(0.43620) */
-  0.3890597597, /* sin(0.43640) */
-  0.3879018231, /* sin(0.43660) */
-  0.3867432739, /* sin(0.43680) */
-  0.3855841140, /* sin(0.43700) */
-  0.3844243453, /* sin(0.43720) */
-  0.3832639694, /* sin(0.43740) */
-  0.3821029884, /* sin(0.43760) */
-  0.3809414039, /* sin(0.43780) */
-  0.3797792179, /* sin(0.43800) */
-  0.3786164321, /* sin(0.43820) */
-  0.3774530485, /* sin(0.43840) */
-  0.3762890688, /* sin(0.43860) */
-  0.3751244950, /* sin(0.43880) */
-  0.3739593287, /* sin(0.43900) */
-  0.3727935719, /* sin(0.43920) */
-  0.3716272264, /* sin(0.43940) */
-  0.3704602941, /* sin(0.43960) */
-  0.3692927767, /* sin(0.43980) */
-  0.3681246762, /* sin(0.44000) */
-  0.3669559944, /* sin(0.44020) */
-  0.3657867331, /* sin(0.44040) */
-  0.3646168942, /* sin(0.44060) */
-  0.3634464795, /* sin(0.44080) */
-  0.3622754908, /* sin(0.44100) */
-  0.3611039301, /* sin(0.44120) */
-  0.3599317992, /* sin(0.44140) */
-  0.3587590998, /* sin(0.44160) */
-  0.3575858340, /* sin(0.44180) */
-  0.3564120034, /* sin(0.44200) */
-  0.3552376101, /* sin(0.44220) */
-  0.3540626557, /* sin(0.44240) */
-  0.3528871423, /* sin(0.44260) */
-  0.3517110716, /* sin(0.44280) */
-  0.3505344455, /* sin(0.44300) */
-  0.3493572658, /* sin(0.44320) */
-  0.3481795345, /* sin(0.44340) */
-  0.3470012534, /* sin(0.44360) */
-  0.3458224243, /* sin(0.44380) */
-  0.3446430490, /* sin(0.44400) */
-  0.3434631296, /* sin(0.44420) */
-  0.3422826678, /* sin(0.44440) */
-  0.3411016654, /* sin(0.44460) */
-  0.3399201244, /* sin(0.44480) */
-  0.3387380467, /* sin(0.44500) */
-  0.3375554340, /* sin(0.44520) */
-  0.3363722883, /* sin(0.44540) */
-  0.3351886114, /* sin(0.44560) */
-  0.3340044052, /* sin(0.44580) */
-  0.3328196715, /* sin(0.44600) */
-  0.3316344123, /* sin(0.44620) */
-  0.3304486294, /* sin(0.44640) */
-  0.3292623247, /* sin(0.44660) */
-  0.3280755000, /* sin(0.44680) */
-  0.3268881572, /* sin(0.44700) */
-  0.3257002983, /* sin(0.44720) */
-  0.3245119250, /* sin(0.44740) */
-  0.3233230392, /* sin(0.44760) */
-  0.3221336429, /* sin(0.44780) */
-  0.3209437379, /* sin(0.44800) */
-  0.3197533261, /* sin(0.44820) */
-  0.3185624094, /* sin(0.44840) */
-  0.3173709896, /* sin(0.44860) */
-  0.3161790686, /* sin(0.44880) */
-  0.3149866483, /* sin(0.44900) */
-  0.3137937307, /* sin(0.44920) */
-  0.3126003175, /* sin(0.44940) */
-  0.3114064107, /* sin(0.44960) */
-  0.3102120121, /* sin(0.44980) */
-  0.3090171236, /* sin(0.45000) */
-  0.3078217472, /* sin(0.45020) */
-  0.3066258847, /* sin(0.45040) */
-  0.3054295379, /* sin(0.45060) */
-  0.3042327089, /* sin(0.45080) */
-  0.3030353994, /* sin(0.45100) */
-  0.3018376114, /* sin(0.45120) */
-  0.3006393468, /* sin(0.45140) */
-  0.2994406074, /* sin(0.45160) */
-  0.2982413951, /* sin(0.45180) */
-  0.2970417119, /* sin(0.45200) */
-  0.2958415596, /* sin(0.45220) */
-  0.2946409402, /* sin(0.45240) */
-  0.2934398554, /* sin(0.45260) */
-  0.2922383073, /* sin(0.45280) */
-  0.2910362977, /* sin(0.45300) */
-  0.2898338285, /* sin(0.45320) */
-  0.2886309016, /* sin(0.45340) */
-  0.2874275190, /* sin(0.45360) */
-  0.2862236824, /* sin(0.45380) */
-  0.2850193939, /* sin(0.45400) */
-  0.2838146553, /* sin(0.45420) */
-  0.2826094685, /* sin(0.45440) */
-  0.2814038354, /* sin(0.45460) */
-  0.2801977579, /* sin(0.45480) */
-  0.2789912380, /* sin(0.45500) */
-  0.2777842775, /* sin(0.45520) */
-  0.2765768783, /* sin(0.45540) */
-  0.2753690424, /* sin(0.45560) */
-  0.2741607717, /* sin(0.45580) */
-  0.2729520680, /* sin(0.45600) */
-  0.2717429333, /* sin(0.45620) */
-  0.2705333694, /* sin(0.45640) */
-  0.2693233784, /* sin(0.45660) */
-  0.2681129621, /* sin(0.45680) */
-  0.2669021223, /* sin(0.45700) */
-  0.2656908611, /* sin(0.45720) */
-  0.2644791804, /* sin(0.45740) */
-  0.2632670819, /* sin(0.45760) */
-  0.2620545678, /* sin(0.45780) */
-  0.2608416398, /* sin(0.45800) */
-  0.2596282999, /* sin(0.45820) */
-  0.2584145501, /* sin(0.45840) */
-  0.2572003921, /* sin(0.45860) */
-  0.2559858280, /* sin(0.45880) */
-  0.2547708597, /* sin(0.45900) */
-  0.2535554891, /* sin(0.45920) */
-  0.2523397180, /* sin(0.45940) */
-  0.2511235485, /* sin(0.45960) */
-  0.2499069824, /* sin(0.45980) */
-  0.2486900217, /* sin(0.46000) */
-  0.2474726683, /* sin(0.46020) */
-  0.2462549241, /* sin(0.46040) */
-  0.2450367910, /* sin(0.46060) */
-  0.2438182709, /* sin(0.46080) */
-  0.2425993659, /* sin(0.46100) */
-  0.2413800777, /* sin(0.46120) */
-  0.2401604084, /* sin(0.46140) */
-  0.2389403598, /* sin(0.46160) */
-  0.2377199339, /* sin(0.46180) */
-  0.2364991326, /* sin(0.46200) */
-  0.2352779578, /* sin(0.46220) */
-  0.2340564115, /* sin(0.46240) */
-  0.2328344956, /* sin(0.46260) */
-  0.2316122121, /* sin(0.46280) */
-  0.2303895627, /* sin(0.46300) */
-  0.2291665496, /* sin(0.46320) */
-  0.2279431746, /* sin(0.46340) */
-  0.2267194396, /* sin(0.46360) */
-  0.2254953466, /* sin(0.46380) */
-  0.2242708975, /* sin(0.46400) */
-  0.2230460943, /* sin(0.46420) */
-  0.2218209388, /* sin(0.46440) */
-  0.2205954331, /* sin(0.46460) */
-  0.2193695790, /* sin(0.46480) */
-  0.2181433784, /* sin(0.46500) */
-  0.2169168334, /* sin(0.46520) */
-  0.2156899459, /* sin(0.46540) */
-  0.2144627178, /* sin(0.46560) */
-  0.2132351510, /* sin(0.46580) */
-  0.2120072475, /* sin(0.46600) */
-  0.2107790091, /* sin(0.46620) */
-  0.2095504380, /* sin(0.46640) */
-  0.2083215359, /* sin(0.46660) */
-  0.2070923048, /* sin(0.46680) */
-  0.2058627468, /* sin(0.46700) */
-  0.2046328636, /* sin(0.46720) */
-  0.2034026573, /* sin(0.46740) */
-  0.2021721298, /* sin(0.46760) */
-  0.2009412831, /* sin(0.46780) */
-  0.1997101190, /* sin(0.46800) */
-  0.1984786396, /* sin(0.46820) */
-  0.1972468467, /* sin(0.46840) */
-  0.1960147424, /* sin(0.46860) */
-  0.1947823285, /* sin(0.46880) */
-  0.1935496070, /* sin(0.46900) */
-  0.1923165799, /* sin(0.46920) */
-  0.1910832491, /* sin(0.46940) */
-  0.1898496166, /* sin(0.46960) */
-  0.1886156842, /* sin(0.46980) */
-  0.1873814540, /* sin(0.47000) */
-  0.1861469279, /* sin(0.47020) */
-  0.1849121079, /* sin(0.47040) */
-  0.1836769958, /* sin(0.47060) */
-  0.1824415937, /* sin(0.47080) */
-  0.1812059035, /* sin(0.47100) */
-  0.1799699272, /* sin(0.47120) */
-  0.1787336666, /* sin(0.47140) */
-  0.1774971238, /* sin(0.47160) */
-  0.1762603007, /* sin(0.47180) */
-  0.1750231993, /* sin(0.47200) */
-  0.1737858215, /* sin(0.47220) */
-  0.1725481693, /* sin(0.47240) */
-  0.1713102445, /* sin(0.47260) */
-  0.1700720493, /* sin(0.47280) */
-  0.1688335855, /* sin(0.47300) */
-  0.1675948551, /* sin(0.47320) */
-  0.1663558600, /* sin(0.47340) */
-  0.1651166022, /* sin(0.47360) */
-  0.1638770837, /* sin(0.47380) */
-  0.1626373064, /* sin(0.47400) */
-  0.1613972723, /* sin(0.47420) */
-  0.1601569833, /* sin(0.47440) */
-  0.1589164414, /* sin(0.47460) */
-  0.1576756486, /* sin(0.47480) */
-  0.1564346067, /* sin(0.47500) */
-  0.1551933178, /* sin(0.47520) */
-  0.1539517839, /* sin(0.47540) */
-  0.1527100068, /* sin(0.47560) */
-  0.1514679886, /* sin(0.47580) */
-  0.1502257312, /* sin(0.47600) */
-  0.1489832366, /* sin(0.47620) */
-  0.1477405067, /* sin(0.47640) */
-  0.1464975435, /* sin(0.47660) */
-  0.1452543490, /* sin(0.47680) */
-  0.1440109251, /* sin(0.47700) */
-  0.1427672738, /* sin(0.47720) */
-  0.1415233970, /* sin(0.47740) */
-  0.1402792968, /* sin(0.47760) */
-  0.1390349750, /* sin(0.47780) */
-  0.1377904337, /* sin(0.47800) */
-  0.1365456747, /* sin(0.47820) */
-  0.1353007002, /* sin(0.47840) */
-  0.1340555120, /* sin(0.47860) */
-  0.1328101121, /* sin(0.47880) */
-  0.1315645025, /* sin(0.47900) */
-  0.1303186851, /* sin(0.47920) */
-  0.1290726619, /* sin(0.47940) */
-  0.1278264350, /* sin(0.47960) */
-  0.1265800061, /* sin(0.47980) */
-  0.1253333774, /* sin(0.48000) */
-  0.1240865507, /* sin(0.48020) */
-  0.1228395281, /* sin(0.48040) */
-  0.1215923115, /* sin(0.48060) */
-  0.1203449030, /* sin(0.48080) */
-  0.1190973043, /* sin(0.48100) */
-  0.1178495176, /* sin(0.48120) */
-  0.1166015448, /* sin(0.48140) */
-  0.1153533879, /* sin(0.48160) */
-  0.1141050488, /* sin(0.48180) */
-  0.1128565295, /* sin(0.48200) */
-  0.1116078320, /* sin(0.48220) */
-  0.1103589583, /* sin(0.48240) */
-  0.1091099103, /* sin(0.48260) */
-  0.1078606899, /* sin(0.48280) */
-  0.1066112993, /* sin(0.48300) */
-  0.1053617403, /* sin(0.48320) */
-  0.1041120149, /* sin(0.48340) */
-  0.1028621252, /* sin(0.48360) */
-  0.1016120729, /* sin(0.48380) */
-  0.1003618603, /* sin(0.48400) */
-  0.0991114891, /* sin(0.48420) */
-  0.0978609615, /* sin(0.48440) */
-  0.0966102792, /* sin(0.48460) */
-  0.0953594445, /* sin(0.48480) */
-  0.0941084591, /* sin(0.48500) */
-  0.0928573252, /* sin(0.48520) */
-  0.0916060446, /* sin(0.48540) */
-  0.0903546193, /* sin(0.48560) */
-  0.0891030514, /* sin(0.48580) */
-  0.0878513428, /* sin(0.48600) */
-  0.0865994954, /* sin(0.48620) */
-  0.0853475113, /* sin(0.48640) */
-  0.0840953924, /* sin(0.48660) */
-  0.0828431407, /* sin(0.48680) */
-  0.0815907581, /* sin(0.48700) */
-  0.0803382468, /* sin(0.48720) */
-  0.0790856086, /* sin(0.48740) */
-  0.0778328455, /* sin(0.48760) */
-  0.0765799594, /* sin(0.48780) */
-  0.0753269525, /* sin(0.48800) */
-  0.0740738266, /* sin(0.48820) */
-  0.0728205837, /* sin(0.48840) */
-  0.0715672258, /* sin(0.48860) */
-  0.0703137550, /* sin(0.48880) */
-  0.0690601730, /* sin(0.48900) */
-  0.0678064821, /* sin(0.48920) */
-  0.0665526840, /* sin(0.48940) */
-  0.0652987809, /* sin(0.48960) */
-  0.0640447746, /* sin(0.48980) */
-  0.0627906672, /* sin(0.49000) */
-  0.0615364607, /* sin(0.49020) */
-  0.0602821569, /* sin(0.49040) */
-  0.0590277580, /* sin(0.49060) */
-  0.0577732659, /* sin(0.49080) */
-  0.0565186825, /* sin(0.49100) */
-  0.0552640099, /* sin(0.49120) */
-  0.0540092500, /* sin(0.49140) */
-  0.0527544049, /* sin(0.49160) */
-  0.0514994764, /* sin(0.49180) */
-  0.0502444666, /* sin(0.49200) */
-  0.0489893774, /* sin(0.49220) */
-  0.0477342109, /* sin(0.49240) */
-  0.0464789690, /* sin(0.49260) */
-  0.0452236538, /* sin(0.49280) */
-  0.0439682671, /* sin(0.49300) */
-  0.0427128109, /* sin(0.49320) */
-  0.0414572873, /* sin(0.49340) */
-  0.0402016983, /* sin(0.49360) */
-  0.0389460458, /* sin(0.49380) */
-  0.0376903317, /* sin(0.49400) */
-  0.0364345582, /* sin(0.49420) */
-  0.0351787271, /* sin(0.49440) */
-  0.0339228405, /* sin(0.49460) */
-  0.0326669003, /* sin(0.49480) */
-  0.0314109085, /* sin(0.49500) */
-  0.0301548671, /* sin(0.49520) */
-  0.0288987781, /* sin(0.49540) */
-  0.0276426434, /* sin(0.49560) */
-  0.0263864651, /* sin(0.49580) */
-  0.0251302452, /* sin(0.49600) */
-  0.0238739855, /* sin(0.49620) */
-  0.0226176882, /* sin(0.49640) */
-  0.0213613551, /* sin(0.49660) */
-  0.0201049883, /* sin(0.49680) */
-  0.0188485898, /* sin(0.49700) */
-  0.0175921615, /* sin(0.49720) */
-  0.0163357054, /* sin(0.49740) */
-  0.0150792235, /* sin(0.49760) */
-  0.0138227178, /* sin(0.49780) */
-  0.0125661903, /* sin(0.49800) */
-  0.0113096429, /* sin(0.49820) */
-  0.0100530777, /* sin(0.49840) */
-  0.0087964966, /* sin(0.49860) */
-  0.0075399016, /* sin(0.49880) */
-  0.0062832947, /* sin(0.49900) */
-  0.0050266778, /* sin(0.49920) */
-  0.0037700531, /* sin(0.49940) */
-  0.0025134224, /* sin(0.49960) */
-  0.0012567877, /* sin(0.49980) */
-  0.0000001510, /* sin(0.50000) */
-  -0.0012564857, /* sin(0.50020) */
-  -0.0025131204, /* sin(0.50040) */
-  -0.0037697511, /* sin(0.50060) */
-  -0.0050263758, /* sin(0.50080) */
-  -0.0062829927, /* sin(0.50100) */
-  -0.0075395996, /* sin(0.50120) */
-  -0.0087961946, /* sin(0.50140) */
-  -0.0100527757, /* sin(0.50160) */
-  -0.0113093409, /* sin(0.50180) */
-  -0.0125658883, /* sin(0.50200) */
-  -0.0138224158, /* sin(0.50220) */
-  -0.0150789215, /* sin(0.50240) */
-  -0.0163354034, /* sin(0.50260) */
-  -0.0175918595, /* sin(0.50280) */
-  -0.0188482878, /* sin(0.50300) */
-  -0.0201046864, /* sin(0.50320) */
-  -0.0213610532, /* sin(0.50340) */
-  -0.0226173863, /* sin(0.50360) */
-  -0.0238736836, /* sin(0.50380) */
-  -0.0251299433, /* sin(0.50400) */
-  -0.0263861633, /* sin(0.50420) */
-  -0.0276423416, /* sin(0.50440) */
-  -0.0288984762, /* sin(0.50460) */
-  -0.0301545652, /* sin(0.50480) */
-  -0.0314106066, /* sin(0.50500) */
-  -0.0326665984, /* sin(0.50520) */
-  -0.0339225387, /* sin(0.50540) */
-  -0.0351784253, /* sin(0.50560) */
-  -0.0364342564, /* sin(0.50580) */
-  -0.0376900300, /* sin(0.50600) */
-  -0.0389457440, /* sin(0.50620) */
-  -0.0402013966, /* sin(0.50640) */
-  -0.0414569856, /* sin(0.50660) */
-  -0.0427125092, /* sin(0.50680) */
-  -0.0439679654, /* sin(0.50700) */
-  -0.0452233521, /* sin(0.50720) */
-  -0.0464786674, /* sin(0.50740) */
-  -0.0477339093, /* sin(0.50760) */
-  -0.0489890758, /* sin(0.50780) */
-  -0.0502441650, /* sin(0.50800) */
-  -0.0514991748, /* sin(0.50820) */
-  -0.0527541033, /* sin(0.50840) */
-  -0.0540089485, /* sin(0.50860) */
-  -0.0552637084, /* sin(0.50880) */
-  -0.0565183810, /* sin(0.50900) */
-  -0.0577729644, /* sin(0.50920) */
-  -0.0590274566, /* sin(0.50940) */
-  -0.0602818555, /* sin(0.50960) */
-  -0.0615361592, /* sin(0.50980) */
-  -0.0627903658, /* sin(0.51000) */
-  -0.0640444732, /* sin(0.51020) */
-  -0.0652984795, /* sin(0.51040) */
-  -0.0665523827, /* sin(0.51060) */
-  -0.0678061808, /* sin(0.51080) */
-  -0.0690598718, /* sin(0.51100) */
-  -0.0703134537, /* sin(0.51120) */
-  -0.0715669246, /* sin(0.51140) */
-  -0.0728202825, /* sin(0.51160) */
-  -0.0740735254, /* sin(0.51180) */
-  -0.0753266513, /* sin(0.51200) */
-  -0.0765796583, /* sin(0.51220) */
-  -0.0778325444, /* sin(0.51240) */
-  -0.0790853075, /* sin(0.51260) */
-  -0.0803379458, /* sin(0.51280) */
-  -0.0815904572, /* sin(0.51300) */
-  -0.0828428397, /* sin(0.51320) */
-  -0.0840950914, /* sin(0.51340) */
-  -0.0853472104, /* sin(0.51360) */
-  -0.0865991945, /* sin(0.51380) */
-  -0.0878510419, /* sin(0.51400) */
-  -0.0891027506, /* sin(0.51420) */
-  -0.0903543186, /* sin(0.51440) */
-  -0.0916057439, /* sin(0.51460) */
-  -0.0928570245, /* sin(0.51480) */
-  -0.0941081585, /* sin(0.51500) */
-  -0.0953591439, /* sin(0.51520) */
-  -0.0966099787, /* sin(0.51540) */
-  -0.0978606609, /* sin(0.51560) */
-  -0.0991111886, /* sin(0.51580) */
-  -0.1003615598, /* sin(0.51600) */
-  -0.1016117725, /* sin(0.51620) */
-  -0.1028618248, /* sin(0.51640) */
-  -0.1041117146, /* sin(0.51660) */
-  -0.1053614400, /* sin(0.51680) */
-  -0.1066109990, /* sin(0.51700) */
-  -0.1078603897, /* sin(0.51720) */
-  -0.1091096101, /* sin(0.51740) */
-  -0.1103586581, /* sin(0.51760) */
-  -0.1116075319, /* sin(0.51780) */
-  -0.1128562294, /* sin(0.51800) */
-  -0.1141047488, /* sin(0.51820) */
-  -0.1153530879, /* sin(0.51840) */
-  -0.1166012449, /* sin(0.51860) */
-  -0.1178492177, /* sin(0.51880) */
-  -0.1190970045, /* sin(0.51900) */
-  -0.1203446032, /* sin(0.51920) */
-  -0.1215920118, /* sin(0.51940) */
-  -0.1228392284, /* sin(0.51960) */
-  -0.1240862511, /* sin(0.51980) */
-  -0.1253330778, /* sin(0.52000) */
-  -0.1265797065, /* sin(0.52020) */
-  -0.1278261354, /* sin(0.52040) */
-  -0.1290723625, /* sin(0.52060) */
-  -0.1303183857, /* sin(0.52080) */
-  -0.1315642031, /* sin(0.52100) */
-  -0.1328098128, /* sin(0.52120) */
-  -0.1340552127, /* sin(0.52140) */
-  -0.1353004010, /* sin(0.52160) */
-  -0.1365453756, /* sin(0.52180) */
-  -0.1377901345, /* sin(0.52200) */
-  -0.1390346759, /* sin(0.52220) */
-  -0.1402789978, /* sin(0.52240) */
-  -0.1415230981, /* sin(0.52260) */
-  -0.1427669749, /* sin(0.52280) */
-  -0.1440106263, /* sin(0.52300) */
-  -0.1452540502, /* sin(0.52320) */
-  -0.1464972448, /* sin(0.52340) */
-  -0.1477402080, /* sin(0.52360) */
-  -0.1489829380, /* sin(0.52380) */
-  -0.1502254327, /* sin(0.52400) */
-  -0.1514676901, /* sin(0.52420) */
-  -0.1527097084, /* sin(0.52440) */
-  -0.1539514855, /* sin(0.52460) */
-  -0.1551930195, /* sin(0.52480) */
-  -0.1564343084, /* sin(0.52500) */
-  -0.1576753503, /* sin(0.52520) */
-  -0.1589161433, /* sin(0.52540) */
-  -0.1601566852, /* sin(0.52560) */
-  -0.1613969743, /* sin(0.52580) */
-  -0.1626370085, /* sin(0.52600) */
-  -0.1638767858, /* sin(0.52620) */
-  -0.1651163044, /* sin(0.52640) */
-  -0.1663555622, /* sin(0.52660) */
-  -0.1675945574, /* sin(0.52680) */
-  -0.1688332878, /* sin(0.52700) */
-  -0.1700717517, /* sin(0.52720) */
-  -0.1713099470, /* sin(0.52740) */
-  -0.1725478718, /* sin(0.52760) */
-  -0.1737855241, /* sin(0.52780) */
-  -0.1750229020, /* sin(0.52800) */
-  -0.1762600035, /* sin(0.52820) */
-  -0.1774968266, /* sin(0.52840) */
-  -0.1787333695, /* sin(0.52860) */
-  -0.1799696301, /* sin(0.52880) */
-  -0.1812056065, /* sin(0.52900) */
-  -0.1824412968, /* sin(0.52920) */
-  -0.1836766990, /* sin(0.52940) */
-  -0.1849118111, /* sin(0.52960) */
-  -0.1861466312, /* sin(0.52980) */
-  -0.1873811574, /* sin(0.53000) */
-  -0.1886153876, /* sin(0.53020) */
-  -0.1898493201, /* sin(0.53040) */
-  -0.1910829527, /* sin(0.53060) */
-  -0.1923162835, /* sin(0.53080) */
-  -0.1935493107, /* sin(0.53100) */
-  -0.1947820323, /* sin(0.53120) */
-  -0.1960144462, /* sin(0.53140) */
-  -0.1972465506, /* sin(0.53160) */
-  -0.1984783436, /* sin(0.53180) */
-  -0.1997098231, /* sin(0.53200) */
-  -0.2009409872, /* sin(0.53220) */
-  -0.2021718341, /* sin(0.53240) */
-  -0.2034023616, /* sin(0.53260) */
-  -0.2046325680, /* sin(0.53280) */
-  -0.2058624513, /* sin(0.53300) */
-  -0.2070920094, /* sin(0.53320) */
-  -0.2083212405, /* sin(0.53340) */
-  -0.2095501427, /* sin(0.53360) */
-  -0.2107787139, /* sin(0.53380) */
-  -0.2120069523, /* sin(0.53400) */
-  -0.2132348559, /* sin(0.53420) */
-  -0.2144624228, /* sin(0.53440) */
-  -0.2156896510, /* sin(0.53460) */
-  -0.2169165386, /* sin(0.53480) */
-  -0.2181430837, /* sin(0.53500) */
-  -0.2193692843, /* sin(0.53520) */
-  -0.2205951385, /* sin(0.53540) */
-  -0.2218206443, /* sin(0.53560) */
-  -0.2230457999, /* sin(0.53580) */
-  -0.2242706032, /* sin(0.53600) */
-  -0.2254950524, /* sin(0.53620) */
-  -0.2267191455, /* sin(0.53640) */
-  -0.2279428805, /* sin(0.53660) */
-  -0.2291662556, /* sin(0.53680) */
-  -0.2303892689, /* sin(0.53700) */
-  -0.2316119183, /* sin(0.53720) */
-  -0.2328342019, /* sin(0.53740) */
-  -0.2340561179, /* sin(0.53760) */
-  -0.2352776643, /* sin(0.53780) */
-  -0.2364988392, /* sin(0.53800) */
-  -0.2377196405, /* sin(0.53820) */
-  -0.2389400665, /* sin(0.53840) */
-  -0.2401601152, /* sin(0.53860) */
-  -0.2413797846, /* sin(0.53880) */
-  -0.2425990729, /* sin(0.53900) */
-  -0.2438179780, /* sin(0.53920) */
-  -0.2450364982, /* sin(0.53940) */
-  -0.2462546314, /* sin(0.53960) */
-  -0.2474723757, /* sin(0.53980) */
-  -0.2486897292, /* sin(0.54000) */
-  -0.2499066900, /* sin(0.54020) */
-  -0.2511232562, /* sin(0.54040) */
-  -0.2523394258, /* sin(0.54060) */
-  -0.2535551970, /* sin(0.54080) */
-  -0.2547705677, /* sin(0.54100) */
-  -0.2559855361, /* sin(0.54120) */
-  -0.2572001003, /* sin(0.54140) */
-  -0.2584142583, /* sin(0.54160) */
-  -0.2596280083, /* sin(0.54180) */
-  -0.2608413483, /* sin(0.54200) */
-  -0.2620542763, /* sin(0.54220) */
-  -0.2632667906, /* sin(0.54240) */
-  -0.2644788891, /* sin(0.54260) */
-  -0.2656905700, /* sin(0.54280) */
-  -0.2669018313, /* sin(0.54300) */
-  -0.2681126711, /* sin(0.54320) */
-  -0.2693230876, /* sin(0.54340) */
-  -0.2705330787, /* sin(0.54360) */
-  -0.2717426427, /* sin(0.54380) */
-  -0.2729517775, /* sin(0.54400) */
-  -0.2741604813, /* sin(0.54420) */
-  -0.2753687521, /* sin(0.54440) */
-  -0.2765765881, /* sin(0.54460) */
-  -0.2777839874, /* sin(0.54480) */
-  -0.2789909480, /* sin(0.54500) */
-  -0.2801974680, /* sin(0.54520) */
-  -0.2814035456, /* sin(0.54540) */
-  -0.2826091788, /* sin(0.54560) */
-  -0.2838143657, /* sin(0.54580) */
-  -0.2850191044, /* sin(0.54600) */
-  -0.2862233931, /* sin(0.54620) */
-  -0.2874272297, /* sin(0.54640) */
-  -0.2886306125, /* sin(0.54660) */
-  -0.2898335395, /* sin(0.54680) */
-  -0.2910360088, /* sin(0.54700) */
-  -0.2922380185, /* sin(0.54720) */
-  -0.2934395667, /* sin(0.54740) */
-  -0.2946406516, /* sin(0.54760) */
-  -0.2958412712, /* sin(0.54780) */
-  -0.2970414236, /* sin(0.54800) */
-  -0.2982411069, /* sin(0.54820) */
-  -0.2994403193, /* sin(0.54840) */
-  -0.3006390588, /* sin(0.54860) */
-  -0.3018373235, /* sin(0.54880) */
-  -0.3030351116, /* sin(0.54900) */
-  -0.3042324212, /* sin(0.54920) */
-  -0.3054292504, /* sin(0.54940) */
-  -0.3066255972, /* sin(0.54960) */
-  -0.3078214599, /* sin(0.54980) */
-  -0.3090168364, /* sin(0.55000) */
-  -0.3102117250, /* sin(0.55020) */
-  -0.3114061237, /* sin(0.55040) */
-  -0.3126000306, /* sin(0.55060) */
-  -0.3137934439, /* sin(0.55080) */
-  -0.3149863617, /* sin(0.55100) */
-  -0.3161787821, /* sin(0.55120) */
-  -0.3173707032, /* sin(0.55140) */
-  -0.3185621231, /* sin(0.55160) */
-  -0.3197530400, /* sin(0.55180) */
-  -0.3209434519, /* sin(0.55200) */
-  -0.3221333570, /* sin(0.55220) */
-  -0.3233227535, /* sin(0.55240) */
-  -0.3245116393, /* sin(0.55260) */
-  -0.3257000127, /* sin(0.55280) */
-  -0.3268878718, /* sin(0.55300) */
-  -0.3280752147, /* sin(0.55320) */
-  -0.3292620395, /* sin(0.55340) */
-  -0.3304483444, /* sin(0.55360) */
-  -0.3316341274, /* sin(0.55380) */
-  -0.3328193868, /* sin(0.55400) */
-  -0.3340041205, /* sin(0.55420) */
-  -0.3351883269, /* sin(0.55440) */
-  -0.3363720039, /* sin(0.55460) */
-  -0.3375551497, /* sin(0.55480) */
-  -0.3387377625, /* sin(0.55500) */
-  -0.3399198404, /* sin(0.55520) */
-  -0.3411013816, /* sin(0.55540) */
-  -0.3422823840, /* sin(0.55560) */
-  -0.3434628460, /* sin(0.55580) */
-  -0.3446427656, /* sin(0.55600) */
-  -0.3458221409, /* sin(0.55620) */
-  -0.3470009701, /* sin(0.55640) */
-  -0.3481792514, /* sin(0.55660) */
-  -0.3493569829, /* sin(0.55680) */
-  -0.3505341627, /* sin(0.55700) */
-  -0.3517107889, /* sin(0.55720) */
-  -0.3528868597, /* sin(0.55740) */
-  -0.3540623733, /* sin(0.55760) */
-  -0.3552373278, /* sin(0.55780) */
-  -0.3564117213, /* sin(0.55800) */
-  -0.3575855519, /* sin(0.55820) */
-  -0.3587588179, /* sin(0.55840) */
-  -0.3599315174, /* sin(0.55860) */
-  -0.3611036485, /* sin(0.55880) */
-  -0.3622752094, /* sin(0.55900) */
-  -0.3634461981, /* sin(0.55920) */
-  -0.3646166130, /* sin(0.55940) */
-  -0.3657864520, /* sin(0.55960) */
-  -0.3669557135, /* sin(0.55980) */
-  -0.3681243954, /* sin(0.56000) */
-  -0.3692924961, /* sin(0.56020) */
-  -0.3704600136, /* sin(0.56040) */
-  -0.3716269461, /* sin(0.56060) */
-  -0.3727932917, /* sin(0.56080) */
-  -0.3739590486, /* sin(0.56100) */
-  -0.3751242150, /* sin(0.56120) */
-  -0.3762887890, /* sin(0.56140) */
-  -0.3774527689, /* sin(0.56160) */
-  -0.3786161526, /* sin(0.56180) */
-  -0.3797789385, /* sin(0.56200) */
-  -0.3809411247, /* sin(0.56220) */
-  -0.3821027093, /* sin(0.56240) */
-  -0.3832636905, /* sin(0.56260) */
-  -0.3844240665, /* sin(0.56280) */
-  -0.3855838354, /* sin(0.56300) */
-  -0.3867429954, /* sin(0.56320) */
-  -0.3879015448, /* sin(0.56340) */
-  -0.3890594815, /* sin(0.56360) */
-  -0.3902168039, /* sin(0.56380) */
-  -0.3913735101, /* sin(0.56400) */
-  -0.3925295983, /* sin(0.56420) */
-  -0.3936850665, /* sin(0.56440) */
-  -0.3948399132, /* sin(0.56460) */
-  -0.3959941363, /* sin(0.56480) */
-  -0.3971477340, /* sin(0.56500) */
-  -0.3983007047, /* sin(0.56520) */
-  -0.3994530463, /* sin(0.56540) */
-  -0.4006047572, /* sin(0.56560) */
-  -0.4017558354, /* sin(0.56580) */
-  -0.4029062793, /* sin(0.56600) */
-  -0.4040560869, /* sin(0.56620) */
-  -0.4052052564, /* sin(0.56640) */
-  -0.4063537860, /* sin(0.56660) */
-  -0.4075016740, /* sin(0.56680) */
-  -0.4086489185, /* sin(0.56700) */
-  -0.4097955176, /* sin(0.56720) */
-  -0.4109414696, /* sin(0.56740) */
-  -0.4120867727, /* sin(0.56760) */
-  -0.4132314251, /* sin(0.56780) */
-  -0.4143754249, /* sin(0.56800) */
-  -0.4155187703, /* sin(0.56820) */
-  -0.4166614596, /* sin(0.56840) */
-  -0.4178034909, /* sin(0.56860) */
-  -0.4189448625, /* sin(0.56880) */
-  -0.4200855725, /* sin(0.56900) */
-  -0.4212256191, /* sin(0.56920) */
-  -0.4223650005, /* sin(0.56940) */
-  -0.4235037150, /* sin(0.56960) */
-  -0.4246417607, /* sin(0.56980) */
-  -0.4257791358, /* sin(0.57000) */
-  -0.4269158386, /* sin(0.57020) */
-  -0.4280518672, /* sin(0.57040) */
-  -0.4291872198, /* sin(0.57060) */
-  -0.4303218947, /* sin(0.57080) */
-  -0.4314558901, /* sin(0.57100) */
-  -0.4325892042, /* sin(0.57120) */
-  -0.4337218351, /* sin(0.57140) */
-  -0.4348537811, /* sin(0.57160) */
-  -0.4359850404, /* sin(0.57180) */
-  -0.4371156113, /* sin(0.57200) */
-  -0.4382454919, /* sin(0.57220) */
-  -0.4393746804, /* sin(0.57240) */
-  -0.4405031751, /* sin(0.57260) */
-  -0.4416309742, /* sin(0.57280) */
-  -0.4427580759, /* sin(0.57300) */
-  -0.4438844784, /* sin(0.57320) */
-  -0.4450101800, /* sin(0.57340) */
-  -0.4461351788, /* sin(0.57360) */
-  -0.4472594731, /* sin(0.57380) */
-  -0.4483830611, /* sin(0.57400) */
-  -0.4495059411, /* sin(0.57420) */
-  -0.4506281113, /* sin(0.57440) */
-  -0.4517495698, /* sin(0.57460) */
-  -0.4528703150, /* sin(0.57480) */
-  -0.4539903450, /* sin(0.57500) */
-  -0.4551096581, /* sin(0.57520) */
-  -0.4562282526, /* sin(0.57540) */
-  -0.4573461266, /* sin(0.57560) */
-  -0.4584632783, /* sin(0.57580) */
-  -0.4595797061, /* sin(0.57600) */
-  -0.4606954082, /* sin(0.57620) */
-  -0.4618103828, /* sin(0.57640) */
-  -0.4629246281, /* sin(0.57660) */
-  -0.4640381423, /* sin(0.57680) */
-  -0.4651509238, /* sin(0.57700) */
-  -0.4662629708, /* sin(0.57720) */
-  -0.4673742815, /* sin(0.57740) */
-  -0.4684848541, /* sin(0.57760) */
-  -0.4695946869, /* sin(0.57780) */
-  -0.4707037782, /* sin(0.57800) */
-  -0.4718121261, /* sin(0.57820) */
-  -0.4729197290, /* sin(0.57840) */
-  -0.4740265851, /* sin(0.57860) */
-  -0.4751326927, /* sin(0.57880) */
-  -0.4762380499, /* sin(0.57900) */
-  -0.4773426551, /* sin(0.57920) */
-  -0.4784465065, /* sin(0.57940) */
-  -0.4795496024, /* sin(0.57960) */
-  -0.4806519410, /* sin(0.57980) */
-  -0.4817535206, /* sin(0.58000) */
-  -0.4828543394, /* sin(0.58020) */
-  -0.4839543958, /* sin(0.58040) */
-  -0.4850536879, /* sin(0.58060) */
-  -0.4861522141, /* sin(0.58080) */
-  -0.4872499725, /* sin(0.58100) */
-  -0.4883469615, /* sin(0.58120) */
-  -0.4894431794, /* sin(0.58140) */
-  -0.4905386243, /* sin(0.58160) */
-  -0.4916332946, /* sin(0.58180) */
-  -0.4927271886, /* sin(0.58200) */
-  -0.4938203045, /* sin(0.58220) */
-  -0.4949126406, /* sin(0.58240) */
-  -0.4960041951, /* sin(0.58260) */
-  -0.4970949664, /* sin(0.58280) */
-  -0.4981849527, /* sin(0.58300) */
-  -0.4992741523, /* sin(0.58320) */
-  -0.5003625635, /* sin(0.58340) */
-  -0.5014501845, /* sin(0.58360) */
-  -0.5025370137, /* sin(0.58380) */
-  -0.5036230493, /* sin(0.58400) */
-  -0.5047082896, /* sin(0.58420) */
-  -0.5057927329, /* sin(0.58440) */
-  -0.5068763775, /* sin(0.58460) */
-  -0.5079592217, /* sin(0.58480) */
-  -0.5090412637, /* sin(0.58500) */
-  -0.5101225019, /* sin(0.58520) */
-  -0.5112029345, /* sin(0.58540) */
-  -0.5122825599, /* sin(0.58560) */
-  -0.5133613763, /* sin(0.58580) */
-  -0.5144393820, /* sin(0.58600) */
-  -0.5155165754, /* sin(0.58620) */
-  -0.5165929547, /* sin(0.58640) */
-  -0.5176685182, /* sin(0.58660) */
-  -0.5187432643, /* sin(0.58680) */
-  -0.5198171912, /* sin(0.58700) */
-  -0.5208902972, /* sin(0.58720) */
-  -0.5219625807, /* sin(0.58740) */
-  -0.5230340399, /* sin(0.58760) */
-  -0.5241046732, /* sin(0.58780) */
-  -0.5251744788, /* sin(0.58800) */
-  -0.5262434552, /* sin(0.58820) */
-  -0.5273116005, /* sin(0.58840) */
-  -0.5283789131, /* sin(0.58860) */
-  -0.5294453914, /* sin(0.58880) */
-  -0.5305110335, /* sin(0.58900) */
-  -0.5315758380, /* sin(0.58920) */
-  -0.5326398029, /* sin(0.58940) */
-  -0.5337029268, /* sin(0.58960) */
-  -0.5347652079, /* sin(0.58980) */
-  -0.5358266445, /* sin(0.59000) */
-  -0.5368872350, /* sin(0.59020) */
-  -0.5379469777, /* sin(0.59040) */
-  -0.5390058709, /* sin(0.59060) */
-  -0.5400639129, /* sin(0.59080) */
-  -0.5411211020, /* sin(0.59100) */
-  -0.5421774367, /* sin(0.59120) */
-  -0.5432329152, /* sin(0.59140) */
-  -0.5442875359, /* sin(0.59160) */
-  -0.5453412970, /* sin(0.59180) */
-  -0.5463941970, /* sin(0.59200) */
-  -0.5474462342, /* sin(0.59220) */
-  -0.5484974068, /* sin(0.59240) */
-  -0.5495477133, /* sin(0.59260) */
-  -0.5505971520, /* sin(0.59280) */
-  -0.5516457213, /* sin(0.59300) */
-  -0.5526934194, /* sin(0.59320) */
-  -0.5537402447, /* sin(0.59340) */
-  -0.5547861956, /* sin(0.59360) */
-  -0.5558312704, /* sin(0.59380) */
-  -0.5568754675, /* sin(0.59400) */
-  -0.5579187852, /* sin(0.59420) */
-  -0.5589612219, /* sin(0.59440) */
-  -0.5600027759, /* sin(0.59460) */
-  -0.5610434455, /* sin(0.59480) */
-  -0.5620832292, /* sin(0.59500) */
-  -0.5631221253, /* sin(0.59520) */
-  -0.5641601322, /* sin(0.59540) */
-  -0.5651972482, /* sin(0.59560) */
-  -0.5662334716, /* sin(0.59580) */
-  -0.5672688009, /* sin(0.59600) */
-  -0.5683032344, /* sin(0.59620) */
-  -0.5693367705, /* sin(0.59640) */
-  -0.5703694075, /* sin(0.59660) */
-  -0.5714011438, /* sin(0.59680) */
-  -0.5724319778, /* sin(0.59700) */
-  -0.5734619078, /* sin(0.59720) */
-  -0.5744909323, /* sin(0.59740) */
-  -0.5755190495, /* sin(0.59760) */
-  -0.5765462580, /* sin(0.59780) */
-  -0.5775725560, /* sin(0.59800) */
-  -0.5785979419, /* sin(0.59820) */
-  -0.5796224142, /* sin(0.59840) */
-  -0.5806459711, /* sin(0.59860) */
-  -0.5816686112, /* sin(0.59880) */
-  -0.5826903327, /* sin(0.59900) */
-  -0.5837111340, /* sin(0.59920) */
-  -0.5847310136, /* sin(0.59940) */
-  -0.5857499698, /* sin(0.59960) */
-  -0.5867680011, /* sin(0.59980) */
-  -0.5877851057, /* sin(0.60000) */
-  -0.5888012822, /* sin(0.60020) */
-  -0.5898165288, /* sin(0.60040) */
-  -0.5908308441, /* sin(0.60060) */
-  -0.5918442263, /* sin(0.60080) */
-  -0.5928566740, /* sin(0.60100) */
-  -0.5938681855, /* sin(0.60120) */
-  -0.5948787591, /* sin(0.60140) */
-  -0.5958883934, /* sin(0.60160) */
-  -0.5968970866, /* sin(0.60180) */
-  -0.5979048373, /* sin(0.60200) */
-  -0.5989116439, /* sin(0.60220) */
-  -0.5999175046, /* sin(0.60240) */
-  -0.6009224180, /* sin(0.60260) */
-  -0.6019263825, /* sin(0.60280) */
-  -0.6029293964, /* sin(0.60300) */
-  -0.6039314582, /* sin(0.60320) */
-  -0.6049325664, /* sin(0.60340) */
-  -0.6059327193, /* sin(0.60360) */
-  -0.6069319153, /* sin(0.60380) */
-  -0.6079301529, /* sin(0.60400) */
-  -0.6089274305, /* sin(0.60420) */
-  -0.6099237465, /* sin(0.60440) */
-  -0.6109190993, /* sin(0.60460) */
-  -0.6119134875, /* sin(0.60480) */
-  -0.6129069093, /* sin(0.60500) */
-  -0.6138993633, /* sin(0.60520) */
-  -0.6148908478, /* sin(0.60540) */
-  -0.6158813613, /* sin(0.60560) */
-  -0.6168709023, /* sin(0.60580) */
-  -0.6178594692, /* sin(0.60600) */
-  -0.6188470604, /* sin(0.60620) */
-  -0.6198336743, /* sin(0.60640) */
-  -0.6208193094, /* sin(0.60660) */
-  -0.6218039642, /* sin(0.60680) */
-  -0.6227876371, /* sin(0.60700) */
-  -0.6237703265, /* sin(0.60720) */
-  -0.6247520308, /* sin(0.60740) */
-  -0.6257327486, /* sin(0.60760) */
-  -0.6267124783, /* sin(0.60780) */
-  -0.6276912184, /* sin(0.60800) */
-  -0.6286689672, /* sin(0.60820) */
-  -0.6296457232, /* sin(0.60840) */
-  -0.6306214850, /* sin(0.60860) */
-  -0.6315962509, /* sin(0.60880) */
-  -0.6325700195, /* sin(0.60900) */
-  -0.6335427891, /* sin(0.60920) */
-  -0.6345145583, /* sin(0.60940) */
-  -0.6354853255, /* sin(0.60960) */
-  -0.6364550892, /* sin(0.60980) */
-  -0.6374238478, /* sin(0.61000) */
-  -0.6383915999, /* sin(0.61020) */
-  -0.6393583438, /* sin(0.61040) */
-  -0.6403240781, /* sin(0.61060) */
-  -0.6412888013, /* sin(0.61080) */
-  -0.6422525117, /* sin(0.61100) */
-  -0.6432152080, /* sin(0.61120) */
-  -0.6441768886, /* sin(0.61140) */
-  -0.6451375519, /* sin(0.61160) */
-  -0.6460971964, /* sin(0.61180) */
-  -0.6470558207, /* sin(0.61200) */
-  -0.6480134231, /* sin(0.61220) */
-  -0.6489700023, /* sin(0.61240) */
-  -0.6499255567, /* sin(0.61260) */
-  -0.6508800847, /* sin(0.61280) */
-  -0.6518335849, /* sin(0.61300) */
-  -0.6527860558, /* sin(0.61320) */
-  -0.6537374958, /* sin(0.61340) */
-  -0.6546879035, /* sin(0.61360) */
-  -0.6556372774, /* sin(0.61380) */
-  -0.6565856159, /* sin(0.61400) */
-  -0.6575329176, /* sin(0.61420) */
-  -0.6584791809, /* sin(0.61440) */
-  -0.6594244044, /* sin(0.61460) */
-  -0.6603685866, /* sin(0.61480) */
-  -0.6613117260, /* sin(0.61500) */
-  -0.6622538211, /* sin(0.61520) */
-  -0.6631948704, /* sin(0.61540) */
-  -0.6641348724, /* sin(0.61560) */
-  -0.6650738257, /* sin(0.61580) */
-  -0.6660117287, /* sin(0.61600) */
-  -0.6669485800, /* sin(0.61620) */
-  -0.6678843780, /* sin(0.61640) */
-  -0.6688191215, /* sin(0.61660) */
-  -0.6697528087, /* sin(0.61680) */
-  -0.6706854383, /* sin(0.61700) */
-  -0.6716170088, /* sin(0.61720) */
-  -0.6725475188, /* sin(0.61740) */
-  -0.6734769667, /* sin(0.61760) */
-  -0.6744053511, /* sin(0.61780) */
-  -0.6753326705, /* sin(0.61800) */
-  -0.6762589234, /* sin(0.61820) */
-  -0.6771841085, /* sin(0.61840) */
-  -0.6781082242, /* sin(0.61860) */
-  -0.6790312691, /* sin(0.61880) */
-  -0.6799532417, /* sin(0.61900) */
-  -0.6808741405, /* sin(0.61920) */
-  -0.6817939642, /* sin(0.61940) */
-  -0.6827127112, /* sin(0.61960) */
-  -0.6836303801, /* sin(0.61980) */
-  -0.6845469694, /* sin(0.62000) */
-  -0.6854624778, /* sin(0.62020) */
-  -0.6863769037, /* sin(0.62040) */
-  -0.6872902458, /* sin(0.62060) */
-  -0.6882025025, /* sin(0.62080) */
-  -0.6891136725, /* sin(0.62100) */
-  -0.6900237542, /* sin(0.62120) */
-  -0.6909327464, /* sin(0.62140) */
-  -0.6918406474, /* sin(0.62160) */
-  -0.6927474559, /* sin(0.62180) */
-  -0.6936531705, /* sin(0.62200) */
-  -0.6945577897, /* sin(0.62220) */
-  -0.6954613121, /* sin(0.62240) */
-  -0.6963637363, /* sin(0.62260) */
-  -0.6972650608, /* sin(0.62280) */
-  -0.6981652843, /* sin(0.62300) */
-  -0.6990644053, /* sin(0.62320) */
-  -0.6999624223, /* sin(0.62340) */
-  -0.7008593340, /* sin(0.62360) */
-  -0.7017551389, /* sin(0.62380) */
-  -0.7026498357, /* sin(0.62400) */
-  -0.7035434229, /* sin(0.62420) */
-  -0.7044358991, /* sin(0.62440) */
-  -0.7053272629, /* sin(0.62460) */
-  -0.7062175129, /* sin(0.62480) */
-  -0.7071066477, /* sin(0.62500) */
-  -0.7079946659, /* sin(0.62520) */
-  -0.7088815660, /* sin(0.62540) */
-  -0.7097673468, /* sin(0.62560) */
-  -0.7106520067, /* sin(0.62580) */
-  -0.7115355444, /* sin(0.62600) */
-  -0.7124179585, /* sin(0.62620) */
-  -0.7132992475, /* sin(0.62640) */
-  -0.7141794102, /* sin(0.62660) */
-  -0.7150584451, /* sin(0.62680) */
-  -0.7159363508, /* sin(0.62700) */
-  -0.7168131260, /* sin(0.62720) */
-  -0.7176887692, /* sin(0.62740) */
-  -0.7185632791, /* sin(0.62760) */
-  -0.7194366543, /* sin(0.62780) */
-  -0.7203088933, /* sin(0.62800) */
-  -0.7211799950, /* sin(0.62820) */
-  -0.7220499577, /* sin(0.62840) */
-  -0.7229187803, /* sin(0.62860) */
-  -0.7237864613, /* sin(0.62880) */
-  -0.7246529993, /* sin(0.62900) */
-  -0.7255183930, /* sin(0.62920) */
-  -0.7263826410, /* sin(0.62940) */
-  -0.7272457419, /* sin(0.62960) */
-  -0.7281076944, /* sin(0.62980) */
-  -0.7289684972, /* sin(0.63000) */
-  -0.7298281488, /* sin(0.63020) */
-  -0.7306866479, /* sin(0.63040) */
-  -0.7315439931, /* sin(0.63060) */
-  -0.7324001832, /* sin(0.63080) */
-  -0.7332552167, /* sin(0.63100) */
-  -0.7341090922, /* sin(0.63120) */
-  -0.7349618085, /* sin(0.63140) */
-  -0.7358133642, /* sin(0.63160) */
-  -0.7366637580, /* sin(0.63180) */
-  -0.7375129885, /* sin(0.63200) */
-  -0.7383610543, /* sin(0.63220) */
-  -0.7392079542, /* sin(0.63240) */
-  -0.7400536867, /* sin(0.63260) */
-  -0.7408982506, /* sin(0.63280) */
-  -0.7417416445, /* sin(0.63300) */
-  -0.7425838671, /* sin(0.63320) */
-  -0.7434249171, /* sin(0.63340) */
-  -0.7442647931, /* sin(0.63360) */
-  -0.7451034938, /* sin(0.63380) */
-  -0.7459410179, /* sin(0.63400) */
-  -0.7467773641, /* sin(0.63420) */
-  -0.7476125309, /* sin(0.63440) */
-  -0.7484465172, /* sin(0.63460) */
-  -0.7492793216, /* sin(0.63480) */
-  -0.7501109428, /* sin(0.63500) */
-  -0.7509413795, /* sin(0.63520) */
-  -0.7517706303, /* sin(0.63540) */
-  -0.7525986940, /* sin(0.63560) */
-  -0.7534255692, /* sin(0.63580) */
-  -0.7542512546, /* sin(0.63600) */
-  -0.7550757490, /* sin(0.63620) */
-  -0.7558990510, /* sin(0.63640) */
-  -0.7567211594, /* sin(0.63660) */
-  -0.7575420728, /* sin(0.63680) */
-  -0.7583617899, /* sin(0.63700) */
-  -0.7591803095, /* sin(0.63720) */
-  -0.7599976302, /* sin(0.63740) */
-  -0.7608137508, /* sin(0.63760) */
-  -0.7616286699, /* sin(0.63780) */
-  -0.7624423863, /* sin(0.63800) */
-  -0.7632548988, /* sin(0.63820) */
-  -0.7640662059, /* sin(0.63840) */
-  -0.7648763065, /* sin(0.63860) */
-  -0.7656851993, /* sin(0.63880) */
-  -0.7664928829, /* sin(0.63900) */
-  -0.7672993561, /* sin(0.63920) */
-  -0.7681046176, /* sin(0.63940) */
-  -0.7689086663, /* sin(0.63960) */
-  -0.7697115007, /* sin(0.63980) */
-  -0.7705131196, /* sin(0.64000) */
-  -0.7713135218, /* sin(0.64020) */
-  -0.7721127059, /* sin(0.64040) */
-  -0.7729106708, /* sin(0.64060) */
-  -0.7737074152, /* sin(0.64080) */
-  -0.7745029377, /* sin(0.64100) */
-  -0.7752972373, /* sin(0.64120) */
-  -0.7760903125, /* sin(0.64140) */
-  -0.7768821622, /* sin(0.64160) */
-  -0.7776727851, /* sin(0.64180) */
-  -0.7784621799, /* sin(0.64200) */
-  -0.7792503454, /* sin(0.64220) */
-  -0.7800372804, /* sin(0.64240) */
-  -0.7808229836, /* sin(0.64260) */
-  -0.7816074537, /* sin(0.64280) */
-  -0.7823906896, /* sin(0.64300) */
-  -0.7831726900, /* sin(0.64320) */
-  -0.7839534537, /* sin(0.64340) */
-  -0.7847329794, /* sin(0.64360) */
-  -0.7855112659, /* sin(0.64380) */
-  -0.7862883120, /* sin(0.64400) */
-  -0.7870641164, /* sin(0.64420) */
-  -0.7878386779, /* sin(0.64440) */
-  -0.7886119953, /* sin(0.64460) */
-  -0.7893840674, /* sin(0.64480) */
-  -0.7901548930, /* sin(0.64500) */
-  -0.7909244708, /* sin(0.64520) */
-  -0.7916927996, /* sin(0.64540) */
-  -0.7924598782, /* sin(0.64560) */
-  -0.7932257054, /* sin(0.64580) */
-  -0.7939902800, /* sin(0.64600) */
-  -0.7947536008, /* sin(0.64620) */
-  -0.7955156666, /* sin(0.64640) */
-  -0.7962764761, /* sin(0.64660) */
-  -0.7970360283, /* sin(0.64680) */
-  -0.7977943217, /* sin(0.64700) */
-  -0.7985513554, /* sin(0.64720) */
-  -0.7993071280, /* sin(0.64740) */
-  -0.8000616384, /* sin(0.64760) */
-  -0.8008148855, /* sin(0.64780) */
-  -0.8015668679, /* sin(0.64800) */
-  -0.8023175845, /* sin(0.64820) */
-  -0.8030670342, /* sin(0.64840) */
-  -0.8038152157, /* sin(0.64860) */
-  -0.8045621279, /* sin(0.64880) */
-  -0.8053077695, /* sin(0.64900) */
-  -0.8060521395, /* sin(0.64920) */
-  -0.8067952366, /* sin(0.64940) */
-  -0.8075370597, /* sin(0.64960) */
-  -0.8082776075, /* sin(0.64980) */
-  -0.8090168790, /* sin(0.65000) */
-  -0.8097548729, /* sin(0.65020) */
-  -0.8104915881, /* sin(0.65040) */
-  -0.8112270235, /* sin(0.65060) */
-  -0.8119611778, /* sin(0.65080) */
-  -0.8126940499, /* sin(0.65100) */
-  -0.8134256386, /* sin(0.65120) */
-  -0.8141559429, /* sin(0.65140) */
-  -0.8148849614, /* sin(0.65160) */
-  -0.8156126932, /* sin(0.65180) */
-  -0.8163391370, /* sin(0.65200) */
-  -0.8170642917, /* sin(0.65220) */
-  -0.8177881561, /* sin(0.65240) */
-  -0.8185107291, /* sin(0.65260) */
-  -0.8192320096, /* sin(0.65280) */
-  -0.8199519964, /* sin(0.65300) */
-  -0.8206706884, /* sin(0.65320) */
-  -0.8213880845, /* sin(0.65340) */
-  -0.8221041834, /* sin(0.65360) */
-  -0.8228189842, /* sin(0.65380) */
-  -0.8235324856, /* sin(0.65400) */
-  -0.8242446865, /* sin(0.65420) */
-  -0.8249555859, /* sin(0.65440) */
-  -0.8256651825, /* sin(0.65460) */
-  -0.8263734753, /* sin(0.65480) */
-  -0.8270804631, /* sin(0.65500) */
-  -0.8277861448, /* sin(0.65520) */
-  -0.8284905194, /* sin(0.65540) */
-  -0.8291935857, /* sin(0.65560) */
-  -0.8298953425, /* sin(0.65580) */
-  -0.8305957889, /* sin(0.65600) */
-  -0.8312949236, /* sin(0.65620) */
-  -0.8319927456, /* sin(0.65640) */
-  -0.8326892537, /* sin(0.65660) */
-  -0.8333844470, /* sin(0.65680) */
-  -0.8340783242, /* sin(0.65700) */
-  -0.8347708842, /* sin(0.65720) */
-  -0.8354621261, /* sin(0.65740) */
-  -0.8361520486, /* sin(0.65760) */
-  -0.8368406508, /* sin(0.65780) */
-  -0.8375279315, /* sin(0.65800) */
-  -0.8382138896, /* sin(0.65820) */
-  -0.8388985240, /* sin(0.65840) */
-  -0.8395818337, /* sin(0.65860) */
-  -0.8402638176, /* sin(0.65880) */
-  -0.8409444746, /* sin(0.65900) */
-  -0.8416238036, /* sin(0.65920) */
-  -0.8423018036, /* sin(0.65940) */
-  -0.8429784735, /* sin(0.65960) */
-  -0.8436538122, /* sin(0.65980) */
-  -0.8443278187, /* sin(0.66000) */
-  -0.8450004919, /* sin(0.66020) */
-  -0.8456718306, /* sin(0.66040) */
-  -0.8463418340, /* sin(0.66060) */
-  -0.8470105009, /* sin(0.66080) */
-  -0.8476778302, /* sin(0.66100) */
-  -0.8483438209, /* sin(0.66120) */
-  -0.8490084720, /* sin(0.66140) */
-  -0.8496717823, /* sin(0.66160) */
-  -0.8503337510, /* sin(0.66180) */
-  -0.8509943768, /* sin(0.66200) */
-  -0.8516536588, /* sin(0.66220) */
-  -0.8523115959, /* sin(0.66240) */
-  -0.8529681871, /* sin(0.66260) */
-  -0.8536234314, /* sin(0.66280) */
-  -0.8542773276, /* sin(0.66300) */
-  -0.8549298749, /* sin(0.66320) */
-  -0.8555810720, /* sin(0.66340) */
-  -0.8562309182, /* sin(0.66360) */
-  -0.8568794122, /* sin(0.66380) */
-  -0.8575265530, /* sin(0.66400) */
-  -0.8581723398, /* sin(0.66420) */
-  -0.8588167713, /* sin(0.66440) */
-  -0.8594598467, /* sin(0.66460) */
-  -0.8601015648, /* sin(0.66480) */
-  -0.8607419248, /* sin(0.66500) */
-  -0.8613809255, /* sin(0.66520) */
-  -0.8620185660, /* sin(0.66540) */
-  -0.8626548452, /* sin(0.66560) */
-  -0.8632897622, /* sin(0.66580) */
-  -0.8639233159, /* sin(0.66600) */
-  -0.8645555054, /* sin(0.66620) */
-  -0.8651863296, /* sin(0.66640) */
-  -0.8658157876, /* sin(0.66660) */
-  -0.8664438783, /* sin(0.66680) */
-  -0.8670706008, /* sin(0.66700) */
-  -0.8676959541, /* sin(0.66720) */
-  -0.8683199372, /* sin(0.66740) */
-  -0.8689425490, /* sin(0.66760) */
-  -0.8695637887, /* sin(0.66780) */
-  -0.8701836553, /* sin(0.66800) */
-  -0.8708021477, /* sin(0.66820) */
-  -0.8714192650, /* sin(0.66840) */
-  -0.8720350061, /* sin(0.66860) */
-  -0.8726493703, /* sin(0.66880) */
-  -0.8732623564, /* sin(0.66900) */
-  -0.8738739635, /* sin(0.66920) */
-  -0.8744841906, /* sin(0.66940) */
-  -0.8750930368, /* sin(0.66960) */
-  -0.8757005011, /* sin(0.66980) */
-  -0.8763065826, /* sin(0.67000) */
-  -0.8769112802, /* sin(0.67020) */
-  -0.8775145931, /* sin(0.67040) */
-  -0.8781165203, /* sin(0.67060) */
-  -0.8787170608, /* sin(0.67080) */
-  -0.8793162137, /* sin(0.67100) */
-  -0.8799139780, /* sin(0.67120) */
-  -0.8805103529, /* sin(0.67140) */
-  -0.8811053372, /* sin(0.67160) */
-  -0.8816989302, /* sin(0.67180) */
-  -0.8822911309, /* sin(0.67200) */
-  -0.8828819383, /* sin(0.67220) */
-  -0.8834713516, /* sin(0.67240) */
-  -0.8840593697, /* sin(0.67260) */
-  -0.8846459917, /* sin(0.67280) */
-  -0.8852312168, /* sin(0.67300) */
-  -0.8858150440, /* sin(0.67320) */
-  -0.8863974723, /* sin(0.67340) */
-  -0.8869785009, /* sin(0.67360) */
-  -0.8875581289, /* sin(0.67380) */
-  -0.8881363553, /* sin(0.67400) */
-  -0.8887131792, /* sin(0.67420) */
-  -0.8892885996, /* sin(0.67440) */
-  -0.8898626158, /* sin(0.67460) */
-  -0.8904352268, /* sin(0.67480) */
-  -0.8910064316, /* sin(0.67500) */
-  -0.8915762295, /* sin(0.67520) */
-  -0.8921446194, /* sin(0.67540) */
-  -0.8927116005, /* sin(0.67560) */
-  -0.8932771718, /* sin(0.67580) */
-  -0.8938413326, /* sin(0.67600) */
-  -0.8944040819, /* sin(0.67620) */
-  -0.8949654188, /* sin(0.67640) */
-  -0.8955253424, /* sin(0.67660) */
-  -0.8960838518, /* sin(0.67680) */
-  -0.8966409463, /* sin(0.67700) */
-  -0.8971966248, /* sin(0.67720) */
-  -0.8977508865, /* sin(0.67740) */
-  -0.8983037305, /* sin(0.67760) */
-  -0.8988551560, /* sin(0.67780) */
-  -0.8994051621, /* sin(0.67800) */
-  -0.8999537479, /* sin(0.67820) */
-  -0.9005009125, /* sin(0.67840) */
-  -0.9010466551, /* sin(0.67860) */
-  -0.9015909749, /* sin(0.67880) */
-  -0.9021338709, /* sin(0.67900) */
-  -0.9026753423, /* sin(0.67920) */
-  -0.9032153883, /* sin(0.67940) */
-  -0.9037540080, /* sin(0.67960) */
-  -0.9042912005, /* sin(0.67980) */
-  -0.9048269650, /* sin(0.68000) */
-  -0.9053613007, /* sin(0.68020) */
-  -0.9058942067, /* sin(0.68040) */
-  -0.9064256822, /* sin(0.68060) */
-  -0.9069557263, /* sin(0.68080) */
-  -0.9074843381, /* sin(0.68100) */
-  -0.9080115170, /* sin(0.68120) */
-  -0.9085372620, /* sin(0.68140) */
-  -0.9090615722, /* sin(0.68160) */
-  -0.9095844470, /* sin(0.68180) */
-  -0.9101058853, /* sin(0.68200) */
-  -0.9106258865, /* sin(0.68220) */
-  -0.9111444497, /* sin(0.68240) */
-  -0.9116615741, /* sin(0.68260) */
-  -0.9121772588, /* sin(0.68280) */
-  -0.9126915031, /* sin(0.68300) */
-  -0.9132043061, /* sin(0.68320) */
-  -0.9137156671, /* sin(0.68340) */
-  -0.9142255851, /* sin(0.68360) */
-  -0.9147340595, /* sin(0.68380) */
-  -0.9152410894, /* sin(0.68400) */
-  -0.9157466740, /* sin(0.68420) */
-  -0.9162508125, /* sin(0.68440) */
-  -0.9167535041, /* sin(0.68460) */
-  -0.9172547481, /* sin(0.68480) */
-  -0.9177545435, /* sin(0.68500) */
-  -0.9182528897, /* sin(0.68520) */
-  -0.9187497859, /* sin(0.68540) */
-  -0.9192452312, /* sin(0.68560) */
-  -0.9197392250, /* sin(0.68580) */
-  -0.9202317663, /* sin(0.68600) */
-  -0.9207228544, /* sin(0.68620) */
-  -0.9212124887, /* sin(0.68640) */
-  -0.9217006681, /* sin(0.68660) */
-  -0.9221873921, /* sin(0.68680) */
-  -0.9226726599, /* sin(0.68700) */
-  -0.9231564706, /* sin(0.68720) */
-  -0.9236388235, /* sin(0.68740) */
-  -0.9241197179, /* sin(0.68760) */
-  -0.9245991529, /* sin(0.68780) */
-  -0.9250771279, /* sin(0.68800) */
-  -0.9255536421, /* sin(0.68820) */
-  -0.9260286947, /* sin(0.68840) */
-  -0.9265022850, /* sin(0.68860) */
-  -0.9269744121, /* sin(0.68880) */
-  -0.9274450755, /* sin(0.68900) */
-  -0.9279142743, /* sin(0.68920) */
-  -0.9283820078, /* sin(0.68940) */
-  -0.9288482753, /* sin(0.68960) */
-  -0.9293130760, /* sin(0.68980) */
-  -0.9297764092, /* sin(0.69000) */
-  -0.9302382741, /* sin(0.69020) */
-  -0.9306986701, /* sin(0.69040) */
-  -0.9311575963, /* sin(0.69060) */
-  -0.9316150522, /* sin(0.69080) */
-  -0.9320710369, /* sin(0.69100) */
-  -0.9325255497, /* sin(0.69120) */
-  -0.9329785899, /* sin(0.69140) */
-  -0.9334301569, /* sin(0.69160) */
-  -0.9338802498, /* sin(0.69180) */
-  -0.9343288680, /* sin(0.69200) */
-  -0.9347760107, /* sin(0.69220) */
-  -0.9352216774, /* sin(0.69240) */
-  -0.9356658672, /* sin(0.69260) */
-  -0.9361085794, /* sin(0.69280) */
-  -0.9365498134, /* sin(0.69300) */
-  -0.9369895684, /* sin(0.69320) */
-  -0.9374278439, /* sin(0.69340) */
-  -0.9378646390, /* sin(0.69360) */
-  -0.9382999530, /* sin(0.69380) */
-  -0.9387337854, /* sin(0.69400) */
-  -0.9391661354, /* sin(0.69420) */
-  -0.9395970023, /* sin(0.69440) */
-  -0.9400263855, /* sin(0.69460) */
-  -0.9404542842, /* sin(0.69480) */
-  -0.9408806979, /* sin(0.69500) */
-  -0.9413056257, /* sin(0.69520) */
-  -0.9417290671, /* sin(0.69540) */
-  -0.9421510214, /* sin(0.69560) */
-  -0.9425714879, /* sin(0.69580) */
-  -0.9429904659, /* sin(0.69600) */
-  -0.9434079549, /* sin(0.69620) */
-  -0.9438239540, /* sin(0.69640) */
-  -0.9442384628, /* sin(0.69660) */
-  -0.9446514804, /* sin(0.69680) */
-  -0.9450630064, /* sin(0.69700) */
-  -0.9454730399, /* sin(0.69720) */
-  -0.9458815804, /* sin(0.69740) */
-  -0.9462886273, /* sin(0.69760) */
-  -0.9466941798, /* sin(0.69780) */
-  -0.9470982373, /* sin(0.69800) */
-  -0.9475007993, /* sin(0.69820) */
-  -0.9479018650, /* sin(0.69840) */
-  -0.9483014339, /* sin(0.69860) */
-  -0.9486995053, /* sin(0.69880) */
-  -0.9490960785, /* sin(0.69900) */
-  -0.9494911530, /* sin(0.69920) */
-  -0.9498847281, /* sin(0.69940) */
-  -0.9502768032, /* sin(0.69960) */
-  -0.9506673777, /* sin(0.69980) */
-  -0.9510564510, /* sin(0.70000) */
-  -0.9514440224, /* sin(0.70020) */
-  -0.9518300913, /* sin(0.70040) */
-  -0.9522146572, /* sin(0.70060) */
-  -0.9525977194, /* sin(0.70080) */
-  -0.9529792774, /* sin(0.70100) */
-  -0.9533593304, /* sin(0.70120) */
-  -0.9537378780, /* sin(0.70140) */
-  -0.9541149194, /* sin(0.70160) */
-  -0.9544904542, /* sin(0.70180) */
-  -0.9548644818, /* sin(0.70200) */
-  -0.9552370014, /* sin(0.70220) */
-  -0.9556080127, /* sin(0.70240) */
-  -0.9559775148, /* sin(0.70260) */
-  -0.9563455074, /* sin(0.70280) */
-  -0.9567119898, /* sin(0.70300) */
-  -0.9570769614, /* sin(0.70320) */
-  -0.9574404216, /* sin(0.70340) */
-  -0.9578023699, /* sin(0.70360) */
-  -0.9581628057, /* sin(0.70380) */
-  -0.9585217284, /* sin(0.70400) */
-  -0.9588791375, /* sin(0.70420) */
-  -0.9592350324, /* sin(0.70440) */
-  -0.9595894125, /* sin(0.70460) */
-  -0.9599422773, /* sin(0.70480) */
-  -0.9602936263, /* sin(0.70500) */
-  -0.9606434588, /* sin(0.70520) */
-  -0.9609917743, /* sin(0.70540) */
-  -0.9613385723, /* sin(0.70560) */
-  -0.9616838521, /* sin(0.70580) */
-  -0.9620276134, /* sin(0.70600) */
-  -0.9623698555, /* sin(0.70620) */
-  -0.9627105778, /* sin(0.70640) */
-  -0.9630497800, /* sin(0.70660) */
-  -0.9633874613, /* sin(0.70680) */
-  -0.9637236213, /* sin(0.70700) */
-  -0.9640582595, /* sin(0.70720) */
-  -0.9643913752, /* sin(0.70740) */
-  -0.9647229681, /* sin(0.70760) */
-  -0.9650530376, /* sin(0.70780) */
-  -0.9653815831, /* sin(0.70800) */
-  -0.9657086041, /* sin(0.70820) */
-  -0.9660341001, /* sin(0.70840) */
-  -0.9663580707, /* sin(0.70860) */
-  -0.9666805152, /* sin(0.70880) */
-  -0.9670014332, /* sin(0.70900) */
-  -0.9673208242, /* sin(0.70920) */
-  -0.9676386876, /* sin(0.70940) */
-  -0.9679550231, /* sin(0.70960) */
-  -0.9682698300, /* sin(0.70980) */
-  -0.9685831078, /* sin(0.71000) */
-  -0.9688948561, /* sin(0.71020) */
-  -0.9692050744, /* sin(0.71040) */
-  -0.9695137623, /* sin(0.71060) */
-  -0.9698209191, /* sin(0.71080) */
-  -0.9701265444, /* sin(0.71100) */
-  -0.9704306378, /* sin(0.71120) */
-  -0.9707331987, /* sin(0.71140) */
-  -0.9710342267, /* sin(0.71160) */
-  -0.9713337213, /* sin(0.71180) */
-  -0.9716316821, /* sin(0.71200) */
-  -0.9719281085, /* sin(0.71220) */
-  -0.9722230001, /* sin(0.71240) */
-  -0.9725163564, /* sin(0.71260) */
-  -0.9728081770, /* sin(0.71280) */
-  -0.9730984614, /* sin(0.71300) */
-  -0.9733872091, /* sin(0.71320) */
-  -0.9736744197, /* sin(0.71340) */
-  -0.9739600928, /* sin(0.71360) */
-  -0.9742442278, /* sin(0.71380) */
-  -0.9745268244, /* sin(0.71400) */
-  -0.9748078821, /* sin(0.71420) */
-  -0.9750874004, /* sin(0.71440) */
-  -0.9753653789, /* sin(0.71460) */
-  -0.9756418172, /* sin(0.71480) */
-  -0.9759167148, /* sin(0.71500) */
-  -0.9761900713, /* sin(0.71520) */
-  -0.9764618863, /* sin(0.71540) */
-  -0.9767321593, /* sin(0.71560) */
-  -0.9770008899, /* sin(0.71580) */
-  -0.9772680777, /* sin(0.71600) */
-  -0.9775337223, /* sin(0.71620) */
-  -0.9777978232, /* sin(0.71640) */
-  -0.9780603800, /* sin(0.71660) */
-  -0.9783213923, /* sin(0.71680) */
-  -0.9785808598, /* sin(0.71700) */
-  -0.9788387819, /* sin(0.71720) */
-  -0.9790951583, /* sin(0.71740) */
-  -0.9793499885, /* sin(0.71760) */
-  -0.9796032723, /* sin(0.71780) */
-  -0.9798550091, /* sin(0.71800) */
-  -0.9801051986, /* sin(0.71820) */
-  -0.9803538403, /* sin(0.71840) */
-  -0.9806009340, /* sin(0.71860) */
-  -0.9808464792, /* sin(0.71880) */
-  -0.9810904754, /* sin(0.71900) */
-  -0.9813329224, /* sin(0.71920) */
-  -0.9815738197, /* sin(0.71940) */
-  -0.9818131670, /* sin(0.71960) */
-  -0.9820509639, /* sin(0.71980) */
-  -0.9822872100, /* sin(0.72000) */
-  -0.9825219049, /* sin(0.72020) */
-  -0.9827550483, /* sin(0.72040) */
-  -0.9829866398, /* sin(0.72060) */
-  -0.9832166790, /* sin(0.72080) */
-  -0.9834451655, /* sin(0.72100) */
-  -0.9836720991, /* sin(0.72120) */
-  -0.9838974793, /* sin(0.72140) */
-  -0.9841213059, /* sin(0.72160) */
-  -0.9843435783, /* sin(0.72180) */
-  -0.9845642964, /* sin(0.72200) */
-  -0.9847834597, /* sin(0.72220) */
-  -0.9850010678, /* sin(0.72240) */
-  -0.9852171206, /* sin(0.72260) */
-  -0.9854316175, /* sin(0.72280) */
-  -0.9856445583, /* sin(0.72300) */
-  -0.9858559426, /* sin(0.72320) */
-  -0.9860657702, /* sin(0.72340) */
-  -0.9862740406, /* sin(0.72360) */
-  -0.9864807535, /* sin(0.72380) */
-  -0.9866859086, /* sin(0.72400) */
-  -0.9868895057, /* sin(0.72420) */
-  -0.9870915443, /* sin(0.72440) */
-  -0.9872920242, /* sin(0.72460) */
-  -0.9874909449, /* sin(0.72480) */
-  -0.9876883063, /* sin(0.72500) */
-  -0.9878841081, /* sin(0.72520) */
-  -0.9880783498, /* sin(0.72540) */
-  -0.9882710312, /* sin(0.72560) */
-  -0.9884621519, /* sin(0.72580) */
-  -0.9886517118, /* sin(0.72600) */
-  -0.9888397105, /* sin(0.72620) */
-  -0.9890261476, /* sin(0.72640) */
-  -0.9892110229, /* sin(0.72660) */
-  -0.9893943361, /* sin(0.72680) */
-  -0.9895760870, /* sin(0.72700) */
-  -0.9897562752, /* sin(0.72720) */
-  -0.9899349004, /* sin(0.72740) */
-  -0.9901119623, /* sin(0.72760) */
-  -0.9902874608, /* sin(0.72780) */
-  -0.9904613954, /* sin(0.72800) */
-  -0.9906337660, /* sin(0.72820) */
-  -0.9908045722, /* sin(0.72840) */
-  -0.9909738138, /* sin(0.72860) */
-  -0.9911414905, /* sin(0.72880) */
-  -0.9913076021, /* sin(0.72900) */
-  -0.9914721483, /* sin(0.72920) */
-  -0.9916351288, /* sin(0.72940) */
-  -0.9917965433, /* sin(0.72960) */
-  -0.9919563917, /* sin(0.72980) */
-  -0.9921146737, /* sin(0.73000) */
-  -0.9922713890, /* sin(0.73020) */
-  -0.9924265373, /* sin(0.73040) */
-  -0.9925801185, /* sin(0.73060) */
-  -0.9927321322, /* sin(0.73080) */
-  -0.9928825783, /* sin(0.73100) */
-  -0.9930314565, /* sin(0.73120) */
-  -0.9931787665, /* sin(0.73140) */
-  -0.9933245082, /* sin(0.73160) */
-  -0.9934686813, /* sin(0.73180) */
-  -0.9936112856, /* sin(0.73200) */
-  -0.9937523208, /* sin(0.73220) */
-  -0.9938917867, /* sin(0.73240) */
-  -0.9940296832, /* sin(0.73260) */
-  -0.9941660100, /* sin(0.73280) */
-  -0.9943007668, /* sin(0.73300) */
-  -0.9944339535, /* sin(0.73320) */
-  -0.9945655698, /* sin(0.73340) */
-  -0.9946956156, /* sin(0.73360) */
-  -0.9948240907, /* sin(0.73380) */
-  -0.9949509947, /* sin(0.73400) */
-  -0.9950763276, /* sin(0.73420) */
-  -0.9952000892, /* sin(0.73440) */
-  -0.9953222792, /* sin(0.73460) */
-  -0.9954428974, /* sin(0.73480) */
-  -0.9955619437, /* sin(0.73500) */
-  -0.9956794179, /* sin(0.73520) */
-  -0.9957953197, /* sin(0.73540) */
-  -0.9959096491, /* sin(0.73560) */
-  -0.9960224058, /* sin(0.73580) */
-  -0.9961335896, /* sin(0.73600) */
-  -0.9962432004, /* sin(0.73620) */
-  -0.9963512380, /* sin(0.73640) */
-  -0.9964577022, /* sin(0.73660) */
-  -0.9965625929, /* sin(0.73680) */
-  -0.9966659099, /* sin(0.73700) */
-  -0.9967676530, /* sin(0.73720) */
-  -0.9968678220, /* sin(0.73740) */
-  -0.9969664169, /* sin(0.73760) */
-  -0.9970634374, /* sin(0.73780) */
-  -0.9971588835, /* sin(0.73800) */
-  -0.9972527549, /* sin(0.73820) */
-  -0.9973450514, /* sin(0.73840) */
-  -0.9974357731, /* sin(0.73860) */
-  -0.9975249196, /* sin(0.73880) */
-  -0.9976124909, /* sin(0.73900) */
-  -0.9976984869, /* sin(0.73920) */
-  -0.9977829074, /* sin(0.73940) */
-  -0.9978657522, /* sin(0.73960) */
-  -0.9979470212, /* sin(0.73980) */
-  -0.9980267144, /* sin(0.74000) */
-  -0.9981048315, /* sin(0.74020) */
-  -0.9981813725, /* sin(0.74040) */
-  -0.9982563373, /* sin(0.74060) */
-  -0.9983297256, /* sin(0.74080) */
-  -0.9984015375, /* sin(0.74100) */
-  -0.9984717727, /* sin(0.74120) */
-  -0.9985404312, /* sin(0.74140) */
-  -0.9986075129, /* sin(0.74160) */
-  -0.9986730176, /* sin(0.74180) */
-  -0.9987369453, /* sin(0.74200) */
-  -0.9987992959, /* sin(0.74220) */
-  -0.9988600692, /* sin(0.74240) */
-  -0.9989192652, /* sin(0.74260) */
-  -0.9989768838, /* sin(0.74280) */
-  -0.9990329248, /* sin(0.74300) */
-  -0.9990873882, /* sin(0.74320) */
-  -0.9991402740, /* sin(0.74340) */
-  -0.9991915819, /* sin(0.74360) */
-  -0.9992413120, /* sin(0.74380) */
-  -0.9992894642, /* sin(0.74400) */
-  -0.9993360383, /* sin(0.74420) */
-  -0.9993810344, /* sin(0.74440) */
-  -0.9994244523, /* sin(0.74460) */
-  -0.9994662919, /* sin(0.74480) */
-  -0.9995065533, /* sin(0.74500) */
-  -0.9995452363, /* sin(0.74520) */
-  -0.9995823409, /* sin(0.74540) */
-  -0.9996178670, /* sin(0.74560) */
-  -0.9996518146, /* sin(0.74580) */
-  -0.9996841836, /* sin(0.74600) */
-  -0.9997149740, /* sin(0.74620) */
-  -0.9997441857, /* sin(0.74640) */
-  -0.9997718186, /* sin(0.74660) */
-  -0.9997978728, /* sin(0.74680) */
-  -0.9998223481, /* sin(0.74700) */
-  -0.9998452446, /* sin(0.74720) */
-  -0.9998665622, /* sin(0.74740) */
-  -0.9998863009, /* sin(0.74760) */
-  -0.9999044606, /* sin(0.74780) */
-  -0.9999210414, /* sin(0.74800) */
-  -0.9999360431, /* sin(0.74820) */
-  -0.9999494658, /* sin(0.74840) */
-  -0.9999613094, /* sin(0.74860) */
-  -0.9999715740, /* sin(0.74880) */
-  -0.9999802594, /* sin(0.74900) */
-  -0.9999873658, /* sin(0.74920) */
-  -0.9999928930, /* sin(0.74940) */
-  -0.9999968412, /* sin(0.74960) */
-  -0.9999992101, /* sin(0.74980) */
-  -1.0000000000, /* sin(0.75000) */
-  -0.9999992107, /* sin(0.75020) */
-  -0.9999968423, /* sin(0.75040) */
-  -0.9999928947, /* sin(0.75060) */
-  -0.9999873681, /* sin(0.75080) */
-  -0.9999802623, /* sin(0.75100) */
-  -0.9999715774, /* sin(0.75120) */
-  -0.9999613134, /* sin(0.75140) */
-  -0.9999494703, /* sin(0.75160) */
-  -0.9999360482, /* sin(0.75180) */
-  -0.9999210471, /* sin(0.75200) */
-  -0.9999044669, /* sin(0.75220) */
-  -0.9998863077, /* sin(0.75240) */
-  -0.9998665696, /* sin(0.75260) */
-  -0.9998452526, /* sin(0.75280) */
-  -0.9998223567, /* sin(0.75300) */
-  -0.9997978819, /* sin(0.75320) */
-  -0.9997718283, /* sin(0.75340) */
-  -0.9997441959, /* sin(0.75360) */
-  -0.9997149848, /* sin(0.75380) */
-  -0.9996841950, /* sin(0.75400) */
-  -0.9996518266, /* sin(0.75420) */
-  -0.9996178796, /* sin(0.75440) */
-  -0.9995823540, /* sin(0.75460) */
-  -0.9995452500, /* sin(0.75480) */
-  -0.9995065675, /* sin(0.75500) */
-  -0.9994663067, /* sin(0.75520) */
-  -0.9994244676, /* sin(0.75540) */
-  -0.9993810503, /* sin(0.75560) */
-  -0.9993360548, /* sin(0.75580) */
-  -0.9992894812, /* sin(0.75600) */
-  -0.9992413297, /* sin(0.75620) */
-  -0.9991916001, /* sin(0.75640) */
-  -0.9991402928, /* sin(0.75660) */
-  -0.9990874076, /* sin(0.75680) */
-  -0.9990329447, /* sin(0.75700) */
-  -0.9989769043, /* sin(0.75720) */
-  -0.9989192863, /* sin(0.75740) */
-  -0.9988600909, /* sin(0.75760) */
-  -0.9987993181, /* sin(0.75780) */
-  -0.9987369681, /* sin(0.75800) */
-  -0.9986730410, /* sin(0.75820) */
-  -0.9986075368, /* sin(0.75840) */
-  -0.9985404557, /* sin(0.75860) */
-  -0.9984717977, /* sin(0.75880) */
-  -0.9984015631, /* sin(0.75900) */
-  -0.9983297518, /* sin(0.75920) */
-  -0.9982563640, /* sin(0.75940) */
-  -0.9981813998, /* sin(0.75960) */
-  -0.9981048594, /* sin(0.75980) */
-  -0.9980267428, /* sin(0.76000) */
-  -0.9979470502, /* sin(0.76020) */
-  -0.9978657818, /* sin(0.76040) */
-  -0.9977829375, /* sin(0.76060) */
-  -0.9976985176, /* sin(0.76080) */
-  -0.9976125222, /* sin(0.76100) */
-  -0.9975249515, /* sin(0.76120) */
-  -0.9974358055, /* sin(0.76140) */
-  -0.9973450844, /* sin(0.76160) */
-  -0.9972527884, /* sin(0.76180) */
-  -0.9971589176, /* sin(0.76200) */
-  -0.9970634721, /* sin(0.76220) */
-  -0.9969664522, /* sin(0.76240) */
-  -0.9968678579, /* sin(0.76260) */
-  -0.9967676894, /* sin(0.76280) */
-  -0.9966659468, /* sin(0.76300) */
-  -0.9965626304, /* sin(0.76320) */
-  -0.9964577403, /* sin(0.76340) */
-  -0.9963512767, /* sin(0.76360) */
-  -0.9962432396, /* sin(0.76380) */
-  -0.9961336294, /* sin(0.76400) */
-  -0.9960224462, /* sin(0.76420) */
-  -0.9959096900, /* sin(0.76440) */
-  -0.9957953612, /* sin(0.76460) */
-  -0.9956794599, /* sin(0.76480) */
-  -0.9955619863, /* sin(0.76500) */
-  -0.9954429406, /* sin(0.76520) */
-  -0.9953223229, /* sin(0.76540) */
-  -0.9952001335, /* sin(0.76560) */
-  -0.9950763725, /* sin(0.76580) */
-  -0.9949510402, /* sin(0.76600) */
-  -0.9948241367, /* sin(0.76620) */
-  -0.9946956622, /* sin(0.76640) */
-  -0.9945656170, /* sin(0.76660) */
-  -0.9944340012, /* sin(0.76680) */
-  -0.9943008151, /* sin(0.76700) */
-  -0.9941660588, /* sin(0.76720) */
-  -0.9940297326, /* sin(0.76740) */
-  -0.9938918367, /* sin(0.76760) */
-  -0.9937523714, /* sin(0.76780) */
-  -0.9936113367, /* sin(0.76800) */
-  -0.9934687330, /* sin(0.76820) */
-  -0.9933245605, /* sin(0.76840) */
-  -0.9931788193, /* sin(0.76860) */
-  -0.9930315098, /* sin(0.76880) */
-  -0.9928826322, /* sin(0.76900) */
-  -0.9927321867, /* sin(0.76920) */
-  -0.9925801735, /* sin(0.76940) */
-  -0.9924265929, /* sin(0.76960) */
-  -0.9922714452, /* sin(0.76980) */
-  -0.9921147305, /* sin(0.77000) */
-  -0.9919564491, /* sin(0.77020) */
-  -0.9917966012, /* sin(0.77040) */
-  -0.9916351872, /* sin(0.77060) */
-  -0.9914722073, /* sin(0.77080) */
-  -0.9913076617, /* sin(0.77100) */
-  -0.9911415507, /* sin(0.77120) */
-  -0.9909738745, /* sin(0.77140) */
-  -0.9908046335, /* sin(0.77160) */
-  -0.9906338278, /* sin(0.77180) */
-  -0.9904614578, /* sin(0.77200) */
-  -0.9902875237, /* sin(0.77220) */
-  -0.9901120259, /* sin(0.77240) */
-  -0.9899349645, /* sin(0.77260) */
-  -0.9897563398, /* sin(0.77280) */
-  -0.9895761522, /* sin(0.77300) */
-  -0.9893944019, /* sin(0.77320) */
-  -0.9892110893, /* sin(0.77340) */
-  -0.9890262145, /* sin(0.77360) */
-  -0.9888397779, /* sin(0.77380) */
-  -0.9886517799, /* sin(0.77400) */
-  -0.9884622206, /* sin(0.77420) */
-  -0.9882711003, /* sin(0.77440) */
-  -0.9880784195, /* sin(0.77460) */
-  -0.9878841784, /* sin(0.77480) */
-  -0.9876883772, /* sin(0.77500) */
-  -0.9874910164, /* sin(0.77520) */
-  -0.9872920961, /* sin(0.77540) */
-  -0.9870916168, /* sin(0.77560) */
-  -0.9868895788, /* sin(0.77580) */
-  -0.9866859823, /* sin(0.77600) */
-  -0.9864808277, /* sin(0.77620) */
-  -0.9862741154, /* sin(0.77640) */
-  -0.9860658455, /* sin(0.77660) */
-  -0.9858560185, /* sin(0.77680) */
-  -0.9856446348, /* sin(0.77700) */
-  -0.9854316945, /* sin(0.77720) */
-  -0.9852171982, /* sin(0.77740) */
-  -0.9850011460, /* sin(0.77760) */
-  -0.9847835384, /* sin(0.77780) */
-  -0.9845643757, /* sin(0.77800) */
-  -0.9843436582, /* sin(0.77820) */
-  -0.9841213863, /* sin(0.77840) */
-  -0.9838975603, /* sin(0.77860) */
-  -0.9836721806, /* sin(0.77880) */
-  -0.9834452476, /* sin(0.77900) */
-  -0.9832167616, /* sin(0.77920) */
-  -0.9829867230, /* sin(0.77940) */
-  -0.9827551320, /* sin(0.77960) */
-  -0.9825219892, /* sin(0.77980) */
-  -0.9822872949, /* sin(0.78000) */
-  -0.9820510493, /* sin(0.78020) */
-  -0.9818132530, /* sin(0.78040) */
-  -0.9815739063, /* sin(0.78060) */
-  -0.9813330095, /* sin(0.78080) */
-  -0.9810905631, /* sin(0.78100) */
-  -0.9808465674, /* sin(0.78120) */
-  -0.9806010228, /* sin(0.78140) */
-  -0.9803539297, /* sin(0.78160) */
-  -0.9801052885, /* sin(0.78180) */
-  -0.9798550995, /* sin(0.78200) */
-  -0.9796033633, /* sin(0.78220) */
-  -0.9793500801, /* sin(0.78240) */
-  -0.9790952504, /* sin(0.78260) */
-  -0.9788388746, /* sin(0.78280) */
-  -0.9785809530, /* sin(0.78300) */
-  -0.9783214861, /* sin(0.78320) */
-  -0.9780604744, /* sin(0.78340) */
-  -0.9777979181, /* sin(0.78360) */
-  -0.9775338178, /* sin(0.78380) */
-  -0.9772681738, /* sin(0.78400) */
-  -0.9770009865, /* sin(0.78420) */
-  -0.9767322565, /* sin(0.78440) */
-  -0.9764619840, /* sin(0.78460) */
-  -0.9761901696, /* sin(0.78480) */
-  -0.9759168137, /* sin(0.78500) */
-  -0.9756419166, /* sin(0.78520) */
-  -0.9753654789, /* sin(0.78540) */
-  -0.9750875009, /* sin(0.78560) */
-  -0.9748079831, /* sin(0.78580) */
-  -0.9745269260, /* sin(0.78600) */
-  -0.9742443300, /* sin(0.78620) */
-  -0.9739601955, /* sin(0.78640) */
-  -0.9736745230, /* sin(0.78660) */
-  -0.9733873129, /* sin(0.78680) */
-  -0.9730985657, /* sin(0.78700) */
-  -0.9728082819, /* sin(0.78720) */
-  -0.9725164619, /* sin(0.78740) */
-  -0.9722231061, /* sin(0.78760) */
-  -0.9719282150, /* sin(0.78780) */
-  -0.9716317892, /* sin(0.78800) */
-  -0.9713338290, /* sin(0.78820) */
-  -0.9710343349, /* sin(0.78840) */
-  -0.9707333075, /* sin(0.78860) */
-  -0.9704307471, /* sin(0.78880) */
-  -0.9701266543, /* sin(0.78900) */
-  -0.9698210295, /* sin(0.78920) */
-  -0.9695138733, /* sin(0.78940) */
-  -0.9692051860, /* sin(0.78960) */
-  -0.9688949682, /* sin(0.78980) */
-  -0.9685832205, /* sin(0.79000) */
-  -0.9682699432, /* sin(0.79020) */
-  -0.9679551368, /* sin(0.79040) */
-  -0.9676388020, /* sin(0.79060) */
-  -0.9673209391, /* sin(0.79080) */
-  -0.9670015486, /* sin(0.79100) */
-  -0.9666806312, /* sin(0.79120) */
-  -0.9663581872, /* sin(0.79140) */
-  -0.9660342172, /* sin(0.79160) */
-  -0.9657087217, /* sin(0.79180) */
-  -0.9653817012, /* sin(0.79200) */
-  -0.9650531563, /* sin(0.79220) */
-  -0.9647230874, /* sin(0.79240) */
-  -0.9643914951, /* sin(0.79260) */
-  -0.9640583798, /* sin(0.79280) */
-  -0.9637237422, /* sin(0.79300) */
-  -0.9633875827, /* sin(0.79320) */
-  -0.9630499020, /* sin(0.79340) */
-  -0.9627107004, /* sin(0.79360) */
-  -0.9623699786, /* sin(0.79380) */
-  -0.9620277370, /* sin(0.79400) */
-  -0.9616839763, /* sin(0.79420) */
-  -0.9613386970, /* sin(0.79440) */
-  -0.9609918996, /* sin(0.79460) */
-  -0.9606435846, /* sin(0.79480) */
-  -0.9602937527, /* sin(0.79500) */
-  -0.9599424043, /* sin(0.79520) */
-  -0.9595895400, /* sin(0.79540) */
-  -0.9592351604, /* sin(0.79560) */
-  -0.9588792661, /* sin(0.79580) */
-  -0.9585218575, /* sin(0.79600) */
-  -0.9581629353, /* sin(0.79620) */
-  -0.9578025001, /* sin(0.79640) */
-  -0.9574405523, /* sin(0.79660) */
-  -0.9570770926, /* sin(0.79680) */
-  -0.9567121216, /* sin(0.79700) */
-  -0.9563456398, /* sin(0.79720) */
-  -0.9559776478, /* sin(0.79740) */
-  -0.9556081461, /* sin(0.79760) */
-  -0.9552371355, /* sin(0.79780) */
-  -0.9548646163, /* sin(0.79800) */
-  -0.9544905893, /* sin(0.79820) */
-  -0.9541150551, /* sin(0.79840) */
-  -0.9537380142, /* sin(0.79860) */
-  -0.9533594671, /* sin(0.79880) */
-  -0.9529794146, /* sin(0.79900) */
-  -0.9525978573, /* sin(0.79920) */
-  -0.9522147956, /* sin(0.79940) */
-  -0.9518302302, /* sin(0.79960) */
-  -0.9514441618, /* sin(0.79980) */
-  -0.9510565910, /* sin(0.80000) */
-  -0.9506675182, /* sin(0.80020) */
-  -0.9502769443, /* sin(0.80040) */
-  -0.9498848697, /* sin(0.80060) */
-  -0.9494912951, /* sin(0.80080) */
-  -0.9490962212, /* sin(0.80100) */
-  -0.9486996485, /* sin(0.80120) */
-  -0.9483015777, /* sin(0.80140) */
-  -0.9479020093, /* sin(0.80160) */
-  -0.9475009441, /* sin(0.80180) */
-  -0.9470983827, /* sin(0.80200) */
-  -0.9466943257, /* sin(0.80220) */
-  -0.9462887737, /* sin(0.80240) */
-  -0.9458817274, /* sin(0.80260) */
-  -0.9454731875, /* sin(0.80280) */
-  -0.9450631544, /* sin(0.80300) */
-  -0.9446516291, /* sin(0.80320) */
-  -0.9442386119, /* sin(0.80340) */
-  -0.9438241037, /* sin(0.80360) */
-  -0.9434081051, /* sin(0.80380) */
-  -0.9429906167, /* sin(0.80400) */
-  -0.9425716392, /* sin(0.80420) */
-  -0.9421511732, /* sin(0.80440) */
-  -0.9417292195, /* sin(0.80460) */
-  -0.9413057786, /* sin(0.80480) */
-  -0.9408808513, /* sin(0.80500) */
-  -0.9404544382, /* sin(0.80520) */
-  -0.9400265400, /* sin(0.80540) */
-  -0.9395971574, /* sin(0.80560) */
-  -0.9391662910, /* sin(0.80580) */
-  -0.9387339415, /* sin(0.80600) */
-  -0.9383001097, /* sin(0.80620) */
-  -0.9378647962, /* sin(0.80640) */
-  -0.9374280016, /* sin(0.80660) */
-  -0.9369897267, /* sin(0.80680) */
-  -0.9365499722, /* sin(0.80700) */
-  -0.9361087387, /* sin(0.80720) */
-  -0.9356660270, /* sin(0.80740) */
-  -0.9352218378, /* sin(0.80760) */
-  -0.9347761717, /* sin(0.80780) */
-  -0.9343290294, /* sin(0.80800) */
-  -0.9338804118, /* sin(0.80820) */
-  -0.9334303194, /* sin(0.80840) */
-  -0.9329787530, /* sin(0.80860) */
-  -0.9325257133, /* sin(0.80880) */
-  -0.9320712010, /* sin(0.80900) */
-  -0.9316152168, /* sin(0.80920) */
-  -0.9311577615, /* sin(0.80940) */
-  -0.9306988358, /* sin(0.80960) */
-  -0.9302384403, /* sin(0.80980) */
-  -0.9297765759, /* sin(0.81000) */
-  -0.9293132433, /* sin(0.81020) */
-  -0.9288484431, /* sin(0.81040) */
-  -0.9283821762, /* sin(0.81060) */
-  -0.9279144432, /* sin(0.81080) */
-  -0.9274452449, /* sin(0.81100) */
-  -0.9269745821, /* sin(0.81120) */
-  -0.9265024554, /* sin(0.81140) */
-  -0.9260288657, /* sin(0.81160) */
-  -0.9255538136, /* sin(0.81180) */
-  -0.9250773000, /* sin(0.81200) */
-  -0.9245993255, /* sin(0.81220) */
-  -0.9241198910, /* sin(0.81240) */
-  -0.9236389971, /* sin(0.81260) */
-  -0.9231566447, /* sin(0.81280) */
-  -0.9226728345, /* sin(0.81300) */
-  -0.9221875673, /* sin(0.81320) */
-  -0.9217008439, /* sin(0.81340) */
-  -0.9212126649, /* sin(0.81360) */
-  -0.9207230312, /* sin(0.81380) */
-  -0.9202319436, /* sin(0.81400) */
-  -0.9197394028, /* sin(0.81420) */
-  -0.9192454096, /* sin(0.81440) */
-  -0.9187499648, /* sin(0.81460) */
-  -0.9182530691, /* sin(0.81480) */
-  -0.9177547234, /* sin(0.81500) */
-  -0.9172549285, /* sin(0.81520) */
-  -0.9167536851, /* sin(0.81540) */
-  -0.9162509940, /* sin(0.81560) */
-  -0.9157468560, /* sin(0.81580) */
-  -0.9152412719, /* sin(0.81600) */
-  -0.9147342425, /* sin(0.81620) */
-  -0.9142257687, /* sin(0.81640) */
-  -0.9137158511, /* sin(0.81660) */
-  -0.9132044907, /* sin(0.81680) */
-  -0.9126916882, /* sin(0.81700) */
-  -0.9121774445, /* sin(0.81720) */
-  -0.9116617603, /* sin(0.81740) */
-  -0.9111446364, /* sin(0.81760) */
-  -0.9106260737, /* sin(0.81780) */
-  -0.9101060730, /* sin(0.81800) */
-  -0.9095846352, /* sin(0.81820) */
-  -0.9090617610, /* sin(0.81840) */
-  -0.9085374512, /* sin(0.81860) */
-  -0.9080117068, /* sin(0.81880) */
-  -0.9074845284, /* sin(0.81900) */
-  -0.9069559171, /* sin(0.81920) */
-  -0.9064258735, /* sin(0.81940) */
-  -0.9058943985, /* sin(0.81960) */
-  -0.9053614931, /* sin(0.81980) */
-  -0.9048271579, /* sin(0.82000) */
-  -0.9042913939, /* sin(0.82020) */
-  -0.9037542019, /* sin(0.82040) */
-  -0.9032155827, /* sin(0.82060) */
-  -0.9026755373, /* sin(0.82080) */
-  -0.9021340663, /* sin(0.82100) */
-  -0.9015911708, /* sin(0.82120) */
-  -0.9010468516, /* sin(0.82140) */
-  -0.9005011095, /* sin(0.82160) */
-  -0.8999539454, /* sin(0.82180) */
-  -0.8994053601, /* sin(0.82200) */
-  -0.8988553545, /* sin(0.82220) */
-  -0.8983039295, /* sin(0.82240) */
-  -0.8977510860, /* sin(0.82260) */
-  -0.8971968248, /* sin(0.82280) */
-  -0.8966411468, /* sin(0.82300) */
-  -0.8960840529, /* sin(0.82320) */
-  -0.8955255440, /* sin(0.82340) */
-  -0.8949656209, /* sin(0.82360) */
-  -0.8944042845, /* sin(0.82380) */
-  -0.8938415357, /* sin(0.82400) */
-  -0.8932773755, /* sin(0.82420) */
-  -0.8927118046, /* sin(0.82440) */
-  -0.8921448240, /* sin(0.82460) */
-  -0.8915764346, /* sin(0.82480) */
-  -0.8910066373, /* sin(0.82500) */
-  -0.8904354330, /* sin(0.82520) */
-  -0.8898628225, /* sin(0.82540) */
-  -0.8892888068, /* sin(0.82560) */
-  -0.8887133868, /* sin(0.82580) */
-  -0.8881365635, /* sin(0.82600) */
-  -0.8875583376, /* sin(0.82620) */
-  -0.8869787101, /* sin(0.82640) */
-  -0.8863976820, /* sin(0.82660) */
-  -0.8858152542, /* sin(0.82680) */
-  -0.8852314275, /* sin(0.82700) */
-  -0.8846462029, /* sin(0.82720) */
-  -0.8840595814, /* sin(0.82740) */
-  -0.8834715638, /* sin(0.82760) */
-  -0.8828821510, /* sin(0.82780) */
-  -0.8822913441, /* sin(0.82800) */
-  -0.8816991440, /* sin(0.82820) */
-  -0.8811055515, /* sin(0.82840) */
-  -0.8805105676, /* sin(0.82860) */
-  -0.8799141933, /* sin(0.82880) */
-  -0.8793164294, /* sin(0.82900) */
-  -0.8787172770, /* sin(0.82920) */
-  -0.8781167370, /* sin(0.82940) */
-  -0.8775148103, /* sin(0.82960) */
-  -0.8769114979, /* sin(0.82980) */
-  -0.8763068008, /* sin(0.83000) */
-  -0.8757007198, /* sin(0.83020) */
-  -0.8750932560, /* sin(0.83040) */
-  -0.8744844103, /* sin(0.83060) */
-  -0.8738741837, /* sin(0.83080) */
-  -0.8732625771, /* sin(0.83100) */
-  -0.8726495915, /* sin(0.83120) */
-  -0.8720352279, /* sin(0.83140) */
-  -0.8714194872, /* sin(0.83160) */
-  -0.8708023704, /* sin(0.83180) */
-  -0.8701838785, /* sin(0.83200) */
-  -0.8695640124, /* sin(0.83220) */
-  -0.8689427732, /* sin(0.83240) */
-  -0.8683201618, /* sin(0.83260) */
-  -0.8676961793, /* sin(0.83280) */
-  -0.8670708265, /* sin(0.83300) */
-  -0.8664441045, /* sin(0.83320) */
-  -0.8658160142, /* sin(0.83340) */
-  -0.8651865568, /* sin(0.83360) */
-  -0.8645557330, /* sin(0.83380) */
-  -0.8639235440, /* sin(0.83400) */
-  -0.8632899908, /* sin(0.83420) */
-  -0.8626550743, /* sin(0.83440) */
-  -0.8620187956, /* sin(0.83460) */
-  -0.8613811556, /* sin(0.83480) */
-  -0.8607421554, /* sin(0.83500) */
-  -0.8601017959, /* sin(0.83520) */
-  -0.8594600782, /* sin(0.83540) */
-  -0.8588170034, /* sin(0.83560) */
-  -0.8581725723, /* sin(0.83580) */
-  -0.8575267861, /* sin(0.83600) */
-  -0.8568796457, /* sin(0.83620) */
-  -0.8562311522, /* sin(0.83640) */
-  -0.8555813065, /* sin(0.83660) */
-  -0.8549301098, /* sin(0.83680) */
-  -0.8542775631, /* sin(0.83700) */
-  -0.8536236673, /* sin(0.83720) */
-  -0.8529684236, /* sin(0.83740) */
-  -0.8523118328, /* sin(0.83760) */
-  -0.8516538962, /* sin(0.83780) */
-  -0.8509946147, /* sin(0.83800) */
-  -0.8503339894, /* sin(0.83820) */
-  -0.8496720212, /* sin(0.83840) */
-  -0.8490087113, /* sin(0.83860) */
-  -0.8483440607, /* sin(0.83880) */
-  -0.8476780705, /* sin(0.83900) */
-  -0.8470107417, /* sin(0.83920) */
-  -0.8463420753, /* sin(0.83940) */
-  -0.8456720724, /* sin(0.83960) */
-  -0.8450007341, /* sin(0.83980) */
-  -0.8443280614, /* sin(0.84000) */
-  -0.8436540554, /* sin(0.84020) */
-  -0.8429787172, /* sin(0.84040) */
-  -0.8423020478, /* sin(0.84060) */
-  -0.8416240483, /* sin(0.84080) */
-  -0.8409447197, /* sin(0.84100) */
-  -0.8402640632, /* sin(0.84120) */
-  -0.8395820798, /* sin(0.84140) */
-  -0.8388987706, /* sin(0.84160) */
-  -0.8382141366, /* sin(0.84180) */
-  -0.8375281790, /* sin(0.84200) */
-  -0.8368408988, /* sin(0.84220) */
-  -0.8361522971, /* sin(0.84240) */
-  -0.8354623750, /* sin(0.84260) */
-  -0.8347711337, /* sin(0.84280) */
-  -0.8340785741, /* sin(0.84300) */
-  -0.8333846973, /* sin(0.84320) */
-  -0.8326895046, /* sin(0.84340) */
-  -0.8319929969, /* sin(0.84360) */
-  -0.8312951754, /* sin(0.84380) */
-  -0.8305960411, /* sin(0.84400) */
-  -0.8298955953, /* sin(0.84420) */
-  -0.8291938389, /* sin(0.84440) */
-  -0.8284907731, /* sin(0.84460) */
-  -0.8277863990, /* sin(0.84480) */
-  -0.8270807177, /* sin(0.84500) */
-  -0.8263737304, /* sin(0.84520) */
-  -0.8256654380, /* sin(0.84540) */
-  -0.8249558419, /* sin(0.84560) */
-  -0.8242449430, /* sin(0.84580) */
-  -0.8235327426, /* sin(0.84600) */
-  -0.8228192416, /* sin(0.84620) */
-  -0.8221044413, /* sin(0.84640) */
-  -0.8213883429, /* sin(0.84660) */
-  -0.8206709473, /* sin(0.84680) */
-  -0.8199522557, /* sin(0.84700) */
-  -0.8192322694, /* sin(0.84720) */
-  -0.8185109894, /* sin(0.84740) */
-  -0.8177884168, /* sin(0.84760) */
-  -0.8170645528, /* sin(0.84780) */
-  -0.8163393986, /* sin(0.84800) */
-  -0.8156129553, /* sin(0.84820) */
-  -0.8148852240, /* sin(0.84840) */
-  -0.8141562059, /* sin(0.84860) */
-  -0.8134259021, /* sin(0.84880) */
-  -0.8126943138, /* sin(0.84900) */
-  -0.8119614422, /* sin(0.84920) */
-  -0.8112272884, /* sin(0.84940) */
-  -0.8104918535, /* sin(0.84960) */
-  -0.8097551387, /* sin(0.84980) */
-  -0.8090171453, /* sin(0.85000) */
-  -0.8082778742, /* sin(0.85020) */
-  -0.8075373268, /* sin(0.85040) */
-  -0.8067955042, /* sin(0.85060) */
-  -0.8060524076, /* sin(0.85080) */
-  -0.8053080381, /* sin(0.85100) */
-  -0.8045623969, /* sin(0.85120) */
-  -0.8038154851, /* sin(0.85140) */
-  -0.8030673041, /* sin(0.85160) */
-  -0.8023178549, /* sin(0.85180) */
-  -0.8015671387, /* sin(0.85200) */
-  -0.8008151568, /* sin(0.85220) */
-  -0.8000619102, /* sin(0.85240) */
-  -0.7993074002, /* sin(0.85260) */
-  -0.7985516281, /* sin(0.85280) */
-  -0.7977945949, /* sin(0.85300) */
-  -0.7970363018, /* sin(0.85320) */
-  -0.7962767502, /* sin(0.85340) */
-  -0.7955159411, /* sin(0.85360) */
-  -0.7947538758, /* sin(0.85380) */
-  -0.7939905554, /* sin(0.85400) */
-  -0.7932259813, /* sin(0.85420) */
-  -0.7924601545, /* sin(0.85440) */
-  -0.7916930763, /* sin(0.85460) */
-  -0.7909247480, /* sin(0.85480) */
-  -0.7901551706, /* sin(0.85500) */
-  -0.7893843455, /* sin(0.85520) */
-  -0.7886122739, /* sin(0.85540) */
-  -0.7878389569, /* sin(0.85560) */
-  -0.7870643958, /* sin(0.85580) */
-  -0.7862885919, /* sin(0.85600) */
-  -0.7855115462, /* sin(0.85620) */
-  -0.7847332602, /* sin(0.85640) */
-  -0.7839537349, /* sin(0.85660) */
-  -0.7831729717, /* sin(0.85680) */
-  -0.7823909718, /* sin(0.85700) */
-  -0.7816077363, /* sin(0.85720) */
-  -0.7808232666, /* sin(0.85740) */
-  -0.7800375638, /* sin(0.85760) */
-  -0.7792506293, /* sin(0.85780) */
-  -0.7784624642, /* sin(0.85800) */
-  -0.7776730698, /* sin(0.85820) */
-  -0.7768824474, /* sin(0.85840) */
-  -0.7760905982, /* sin(0.85860) */
-  -0.7752975234, /* sin(0.85880) */
-  -0.7745032243, /* sin(0.85900) */
-  -0.7737077022, /* sin(0.85920) */
-  -0.7729109582, /* sin(0.85940) */
-  -0.7721129938, /* sin(0.85960) */
-  -0.7713138101, /* sin(0.85980) */
-  -0.7705134083, /* sin(0.86000) */
-  -0.7697117898, /* sin(0.86020) */
-  -0.7689089559, /* sin(0.86040) */
-  -0.7681049077, /* sin(0.86060) */
-  -0.7672996466, /* sin(0.86080) */
-  -0.7664931738, /* sin(0.86100) */
-  -0.7656854906, /* sin(0.86120) */
-  -0.7648765983, /* sin(0.86140) */
-  -0.7640664982, /* sin(0.86160) */
-  -0.7632551915, /* sin(0.86180) */
-  -0.7624426795, /* sin(0.86200) */
-  -0.7616289635, /* sin(0.86220) */
-  -0.7608140447, /* sin(0.86240) */
-  -0.7599979246, /* sin(0.86260) */
-  -0.7591806043, /* sin(0.86280) */
-  -0.7583620852, /* sin(0.86300) */
-  -0.7575423685, /* sin(0.86320) */
-  -0.7567214555, /* sin(0.86340) */
-  -0.7558993476, /* sin(0.86360) */
-  -0.7550760460, /* sin(0.86380) */
-  -0.7542515521, /* sin(0.86400) */
-  -0.7534258670, /* sin(0.86420) */
-  -0.7525989922, /* sin(0.86440) */
-  -0.7517709290, /* sin(0.86460) */
-  -0.7509416786, /* sin(0.86480) */
-  -0.7501112424, /* sin(0.86500) */
-  -0.7492796216, /* sin(0.86520) */
-  -0.7484468176, /* sin(0.86540) */
-  -0.7476128318, /* sin(0.86560) */
-  -0.7467776653, /* sin(0.86580) */
-  -0.7459413196, /* sin(0.86600) */
-  -0.7451037959, /* sin(0.86620) */
-  -0.7442650957, /* sin(0.86640) */
-  -0.7434252201, /* sin(0.86660) */
-  -0.7425841705, /* sin(0.86680) */
-  -0.7417419483, /* sin(0.86700) */
-  -0.7408985548, /* sin(0.86720) */
-  -0.7400539914, /* sin(0.86740) */
-  -0.7392082592, /* sin(0.86760) */
-  -0.7383613598, /* sin(0.86780) */
-  -0.7375132944, /* sin(0.86800) */
-  -0.7366640643, /* sin(0.86820) */
-  -0.7358136710, /* sin(0.86840) */
-  -0.7349621157, /* sin(0.86860) */
-  -0.7341093998, /* sin(0.86880) */
-  -0.7332555247, /* sin(0.86900) */
-  -0.7324004916, /* sin(0.86920) */
-  -0.7315443020, /* sin(0.86940) */
-  -0.7306869571, /* sin(0.86960) */
-  -0.7298284585, /* sin(0.86980) */
-  -0.7289688073, /* sin(0.87000) */
-  -0.7281080049, /* sin(0.87020) */
-  -0.7272460528, /* sin(0.87040) */
-  -0.7263829523, /* sin(0.87060) */
-  -0.7255187047, /* sin(0.87080) */
-  -0.7246533114, /* sin(0.87100) */
-  -0.7237867738, /* sin(0.87120) */
-  -0.7229190933, /* sin(0.87140) */
-  -0.7220502711, /* sin(0.87160) */
-  -0.7211803088, /* sin(0.87180) */
-  -0.7203092076, /* sin(0.87200) */
-  -0.7194369689, /* sin(0.87220) */
-  -0.7185635941, /* sin(0.87240) */
-  -0.7176890846, /* sin(0.87260) */
-  -0.7168134418, /* sin(0.87280) */
-  -0.7159366671, /* sin(0.87300) */
-  -0.7150587618, /* sin(0.87320) */
-  -0.7141797273, /* sin(0.87340) */
-  -0.7132995650, /* sin(0.87360) */
-  -0.7124182763, /* sin(0.87380) */
-  -0.7115358627, /* sin(0.87400) */
-  -0.7106523254, /* sin(0.87420) */
-  -0.7097676659, /* sin(0.87440) */
-  -0.7088818855, /* sin(0.87460) */
-  -0.7079949858, /* sin(0.87480) */
-  -0.7071069680, /* sin(0.87500) */
-  -0.7062178336, /* sin(0.87520) */
-  -0.7053275840, /* sin(0.87540) */
-  -0.7044362206, /* sin(0.87560) */
-  -0.7035437448, /* sin(0.87580) */
-  -0.7026501580, /* sin(0.87600) */
-  -0.7017554617, /* sin(0.87620) */
-  -0.7008596571, /* sin(0.87640) */
-  -0.6999627458, /* sin(0.87660) */
-  -0.6990647292, /* sin(0.87680) */
-  -0.6981656086, /* sin(0.87700) */
-  -0.6972653856, /* sin(0.87720) */
-  -0.6963640614, /* sin(0.87740) */
-  -0.6954616376, /* sin(0.87760) */
-  -0.6945581156, /* sin(0.87780) */
-  -0.6936534968, /* sin(0.87800) */
-  -0.6927477826, /* sin(0.87820) */
-  -0.6918409745, /* sin(0.87840) */
-  -0.6909330738, /* sin(0.87860) */
-  -0.6900240821, /* sin(0.87880) */
-  -0.6891140007, /* sin(0.87900) */
-  -0.6882028312, /* sin(0.87920) */
-  -0.6872905748, /* sin(0.87940) */
-  -0.6863772332, /* sin(0.87960) */
-  -0.6854628076, /* sin(0.87980) */
-  -0.6845472997, /* sin(0.88000) */
-  -0.6836307107, /* sin(0.88020) */
-  -0.6827130422, /* sin(0.88040) */
-  -0.6817942955, /* sin(0.88060) */
-  -0.6808744723, /* sin(0.88080) */
-  -0.6799535738, /* sin(0.88100) */
-  -0.6790316016, /* sin(0.88120) */
-  -0.6781085571, /* sin(0.88140) */
-  -0.6771844418, /* sin(0.88160) */
-  -0.6762592571, /* sin(0.88180) */
-  -0.6753330046, /* sin(0.88200) */
-  -0.6744056855, /* sin(0.88220) */
-  -0.6734773015, /* sin(0.88240) */
-  -0.6725478540, /* sin(0.88260) */
-  -0.6716173445, /* sin(0.88280) */
-  -0.6706857743, /* sin(0.88300) */
-  -0.6697531451, /* sin(0.88320) */
-  -0.6688194582, /* sin(0.88340) */
-  -0.6678847152, /* sin(0.88360) */
-  -0.6669489175, /* sin(0.88380) */
-  -0.6660120666, /* sin(0.88400) */
-  -0.6650741639, /* sin(0.88420) */
-  -0.6641352111, /* sin(0.88440) */
-  -0.6631952094, /* sin(0.88460) */
-  -0.6622541605, /* sin(0.88480) */
-  -0.6613120658, /* sin(0.88500) */
-  -0.6603689268, /* sin(0.88520) */
-  -0.6594247450, /* sin(0.88540) */
-  -0.6584795218, /* sin(0.88560) */
-  -0.6575332589, /* sin(0.88580) */
-  -0.6565859576, /* sin(0.88600) */
-  -0.6556376194, /* sin(0.88620) */
-  -0.6546882459, /* sin(0.88640) */
-  -0.6537378386, /* sin(0.88660) */
-  -0.6527863989, /* sin(0.88680) */
-  -0.6518339284, /* sin(0.88700) */
-  -0.6508804286, /* sin(0.88720) */
-  -0.6499259009, /* sin(0.88740) */
-  -0.6489703469, /* sin(0.88760) */
-  -0.6480137681, /* sin(0.88780) */
-  -0.6470561660, /* sin(0.88800) */
-  -0.6460975421, /* sin(0.88820) */
-  -0.6451378980, /* sin(0.88840) */
-  -0.6441772350, /* sin(0.88860) */
-  -0.6432155549, /* sin(0.88880) */
-  -0.6422528590, /* sin(0.88900) */
-  -0.6412891489, /* sin(0.88920) */
-  -0.6403244261, /* sin(0.88940) */
-  -0.6393586921, /* sin(0.88960) */
-  -0.6383919485, /* sin(0.88980) */
-  -0.6374241968, /* sin(0.89000) */
-  -0.6364554386, /* sin(0.89020) */
-  -0.6354856753, /* sin(0.89040) */
-  -0.6345149084, /* sin(0.89060) */
-  -0.6335431396, /* sin(0.89080) */
-  -0.6325703703, /* sin(0.89100) */
-  -0.6315966021, /* sin(0.89120) */
-  -0.6306218366, /* sin(0.89140) */
-  -0.6296460751, /* sin(0.89160) */
-  -0.6286693194, /* sin(0.89180) */
-  -0.6276915710, /* sin(0.89200) */
-  -0.6267128313, /* sin(0.89220) */
-  -0.6257331020, /* sin(0.89240) */
-  -0.6247523845, /* sin(0.89260) */
-  -0.6237706805, /* sin(0.89280) */
-  -0.6227879915, /* sin(0.89300) */
-  -0.6218043190, /* sin(0.89320) */
-  -0.6208196646, /* sin(0.89340) */
-  -0.6198340298, /* sin(0.89360) */
-  -0.6188474162, /* sin(0.89380) */
-  -0.6178598254, /* sin(0.89400) */
-  -0.6168712589, /* sin(0.89420) */
-  -0.6158817182, /* sin(0.89440) */
-  -0.6148912050, /* sin(0.89460) */
-  -0.6138997208, /* sin(0.89480) */
-  -0.6129072672, /* sin(0.89500) */
-  -0.6119138457, /* sin(0.89520) */
-  -0.6109194579, /* sin(0.89540) */
-  -0.6099241054, /* sin(0.89560) */
-  -0.6089277898, /* sin(0.89580) */
-  -0.6079305125, /* sin(0.89600) */
-  -0.6069322753, /* sin(0.89620) */
-  -0.6059330796, /* sin(0.89640) */
-  -0.6049329271, /* sin(0.89660) */
-  -0.6039318193, /* sin(0.89680) */
-  -0.6029297578, /* sin(0.89700) */
-  -0.6019267442, /* sin(0.89720) */
-  -0.6009227801, /* sin(0.89740) */
-  -0.5999178670, /* sin(0.89760) */
-  -0.5989120066, /* sin(0.89780) */
-  -0.5979052004, /* sin(0.89800) */
-  -0.5968974501, /* sin(0.89820) */
-  -0.5958887572, /* sin(0.89840) */
-  -0.5948791232, /* sin(0.89860) */
-  -0.5938685499, /* sin(0.89880) */
-  -0.5928570388, /* sin(0.89900) */
-  -0.5918445915, /* sin(0.89920) */
-  -0.5908312096, /* sin(0.89940) */
-  -0.5898168946, /* sin(0.89960) */
-  -0.5888016483, /* sin(0.89980) */
-  -0.5877854722, /* sin(0.90000) */
-  -0.5867683679, /* sin(0.90020) */
-  -0.5857503370, /* sin(0.90040) */
-  -0.5847313811, /* sin(0.90060) */
-  -0.5837115018, /* sin(0.90080) */
-  -0.5826907008, /* sin(0.90100) */
-  -0.5816689796, /* sin(0.90120) */
-  -0.5806463399, /* sin(0.90140) */
-  -0.5796227833, /* sin(0.90160) */
-  -0.5785983114, /* sin(0.90180) */
-  -0.5775729258, /* sin(0.90200) */
-  -0.5765466281, /* sin(0.90220) */
-  -0.5755194200, /* sin(0.90240) */
-  -0.5744913031, /* sin(0.90260) */
-  -0.5734622789, /* sin(0.90280) */
-  -0.5724323492, /* sin(0.90300) */
-  -0.5714015155, /* sin(0.90320) */
-  -0.5703697795, /* sin(0.90340) */
-  -0.5693371429, /* sin(0.90360) */
-  -0.5683036071, /* sin(0.90380) */
-  -0.5672691740, /* sin(0.90400) */
-  -0.5662338450, /* sin(0.90420) */
-  -0.5651976219, /* sin(0.90440) */
-  -0.5641605062, /* sin(0.90460) */
-  -0.5631224997, /* sin(0.90480) */
-  -0.5620836039, /* sin(0.90500) */
-  -0.5610438205, /* sin(0.90520) */
-  -0.5600031512, /* sin(0.90540) */
-  -0.5589615975, /* sin(0.90560) */
-  -0.5579191611, /* sin(0.90580) */
-  -0.5568758437, /* sin(0.90600) */
-  -0.5558316470, /* sin(0.90620) */
-  -0.5547865725, /* sin(0.90640) */
-  -0.5537406219, /* sin(0.90660) */
-  -0.5526937969, /* sin(0.90680) */
-  -0.5516460991, /* sin(0.90700) */
-  -0.5505975302, /* sin(0.90720) */
-  -0.5495480918, /* sin(0.90740) */
-  -0.5484977856, /* sin(0.90760) */
-  -0.5474466132, /* sin(0.90780) */
-  -0.5463945764, /* sin(0.90800) */
-  -0.5453416767, /* sin(0.90820) */
-  -0.5442879159, /* sin(0.90840) */
-  -0.5432332955, /* sin(0.90860) */
-  -0.5421778173, /* sin(0.90880) */
-  -0.5411214830, /* sin(0.90900) */
-  -0.5400642941, /* sin(0.90920) */
-  -0.5390062524, /* sin(0.90940) */
-  -0.5379473595, /* sin(0.90960) */
-  -0.5368876172, /* sin(0.90980) */
-  -0.5358270270, /* sin(0.91000) */
-  -0.5347655907, /* sin(0.91020) */
-  -0.5337033099, /* sin(0.91040) */
-  -0.5326401863, /* sin(0.91060) */
-  -0.5315762216, /* sin(0.91080) */
-  -0.5305114175, /* sin(0.91100) */
-  -0.5294457756, /* sin(0.91120) */
-  -0.5283792977, /* sin(0.91140) */
-  -0.5273119854, /* sin(0.91160) */
-  -0.5262438404, /* sin(0.91180) */
-  -0.5251748643, /* sin(0.91200) */
-  -0.5241050590, /* sin(0.91220) */
-  -0.5230344260, /* sin(0.91240) */
-  -0.5219629671, /* sin(0.91260) */
-  -0.5208906839, /* sin(0.91280) */
-  -0.5198175782, /* sin(0.91300) */
-  -0.5187436516, /* sin(0.91320) */
-  -0.5176689058, /* sin(0.91340) */
-  -0.5165933426, /* sin(0.91360) */
-  -0.5155169636, /* sin(0.91380) */
-  -0.5144397705, /* sin(0.91400) */
-  -0.5133617650, /* sin(0.91420) */
-  -0.5122829489, /* sin(0.91440) */
-  -0.5112033238, /* sin(0.91460) */
-  -0.5101228915, /* sin(0.91480) */
-  -0.5090416536, /* sin(0.91500) */
-  -0.5079596119, /* sin(0.91520) */
-  -0.5068767680, /* sin(0.91540) */
-  -0.5057931237, /* sin(0.91560) */
-  -0.5047086806, /* sin(0.91580) */
-  -0.5036234406, /* sin(0.91600) */
-  -0.5025374053, /* sin(0.91620) */
-  -0.5014505764, /* sin(0.91640) */
-  -0.5003629557, /* sin(0.91660) */
-  -0.4992745448, /* sin(0.91680) */
-  -0.4981853455, /* sin(0.91700) */
-  -0.4970953594, /* sin(0.91720) */
-  -0.4960045884, /* sin(0.91740) */
-  -0.4949130342, /* sin(0.91760) */
-  -0.4938206984, /* sin(0.91780) */
-  -0.4927275828, /* sin(0.91800) */
-  -0.4916336891, /* sin(0.91820) */
-  -0.4905390191, /* sin(0.91840) */
-  -0.4894435744, /* sin(0.91860) */
-  -0.4883473568, /* sin(0.91880) */
-  -0.4872503681, /* sin(0.91900) */
-  -0.4861526099, /* sin(0.91920) */
-  -0.4850540840, /* sin(0.91940) */
-  -0.4839547922, /* sin(0.91960) */
-  -0.4828547361, /* sin(0.91980) */
-  -0.4817539176, /* sin(0.92000) */
-  -0.4806523383, /* sin(0.92020) */
-  -0.4795499999, /* sin(0.92040) */
-  -0.4784469043, /* sin(0.92060) */
-  -0.4773430532, /* sin(0.92080) */
-  -0.4762384482, /* sin(0.92100) */
-  -0.4751330913, /* sin(0.92120) */
-  -0.4740269840, /* sin(0.92140) */
-  -0.4729201282, /* sin(0.92160) */
-  -0.4718125255, /* sin(0.92180) */
-  -0.4707041778, /* sin(0.92200) */
-  -0.4695950868, /* sin(0.92220) */
-  -0.4684852543, /* sin(0.92240) */
-  -0.4673746819, /* sin(0.92260) */
-  -0.4662633715, /* sin(0.92280) */
-  -0.4651513248, /* sin(0.92300) */
-  -0.4640385436, /* sin(0.92320) */
-  -0.4629250296, /* sin(0.92340) */
-  -0.4618107845, /* sin(0.92360) */
-  -0.4606958102, /* sin(0.92380) */
-  -0.4595801084, /* sin(0.92400) */
-  -0.4584636809, /* sin(0.92420) */
-  -0.4573465294, /* sin(0.92440) */
-  -0.4562286557, /* sin(0.92460) */
-  -0.4551100615, /* sin(0.92480) */
-  -0.4539907486, /* sin(0.92500) */
-  -0.4528707189, /* sin(0.92520) */
-  -0.4517499740, /* sin(0.92540) */
-  -0.4506285157, /* sin(0.92560) */
-  -0.4495063458, /* sin(0.92580) */
-  -0.4483834660, /* sin(0.92600) */
-  -0.4472598783, /* sin(0.92620) */
-  -0.4461355842, /* sin(0.92640) */
-  -0.4450105856, /* sin(0.92660) */
-  -0.4438848843, /* sin(0.92680) */
-  -0.4427584821, /* sin(0.92700) */
-  -0.4416313806, /* sin(0.92720) */
-  -0.4405035818, /* sin(0.92740) */
-  -0.4393750873, /* sin(0.92760) */
-  -0.4382458990, /* sin(0.92780) */
-  -0.4371160187, /* sin(0.92800) */
-  -0.4359854481, /* sin(0.92820) */
-  -0.4348541890, /* sin(0.92840) */
-  -0.4337222433, /* sin(0.92860) */
-  -0.4325896126, /* sin(0.92880) */
-  -0.4314562988, /* sin(0.92900) */
-  -0.4303223036, /* sin(0.92920) */
-  -0.4291876290, /* sin(0.92940) */
-  -0.4280522766, /* sin(0.92960) */
-  -0.4269162482, /* sin(0.92980) */
-  -0.4257795457, /* sin(0.93000) */
-  -0.4246421708, /* sin(0.93020) */
-  -0.4235041253, /* sin(0.93040) */
-  -0.4223654111, /* sin(0.93060) */
-  -0.4212260299, /* sin(0.93080) */
-  -0.4200859836, /* sin(0.93100) */
-  -0.4189452738, /* sin(0.93120) */
-  -0.4178039025, /* sin(0.93140) */
-  -0.4166618714, /* sin(0.93160) */
-  -0.4155191824, /* sin(0.93180) */
-  -0.4143758371, /* sin(0.93200) */
-  -0.4132318376, /* sin(0.93220) */
-  -0.4120871855, /* sin(0.93240) */
-  -0.4109418826, /* sin(0.93260) */
-  -0.4097959308, /* sin(0.93280) */
-  -0.4086493319, /* sin(0.93300) */
-  -0.4075020877, /* sin(0.93320) */
-  -0.4063541999, /* sin(0.93340) */
-  -0.4052056705, /* sin(0.93360) */
-  -0.4040565012, /* sin(0.93380) */
-  -0.4029066939, /* sin(0.93400) */
-  -0.4017562503, /* sin(0.93420) */
-  -0.4006051722, /* sin(0.93440) */
-  -0.3994534616, /* sin(0.93460) */
-  -0.3983011202, /* sin(0.93480) */
-  -0.3971481498, /* sin(0.93500) */
-  -0.3959945522, /* sin(0.93520) */
-  -0.3948403293, /* sin(0.93540) */
-  -0.3936854830, /* sin(0.93560) */
-  -0.3925300149, /* sin(0.93580) */
-  -0.3913739270, /* sin(0.93600) */
-  -0.3902172210, /* sin(0.93620) */
-  -0.3890598988, /* sin(0.93640) */
-  -0.3879019623, /* sin(0.93660) */
-  -0.3867434132, /* sin(0.93680) */
-  -0.3855842534, /* sin(0.93700) */
-  -0.3844244847, /* sin(0.93720) */
-  -0.3832641089, /* sin(0.93740) */
-  -0.3821031279, /* sin(0.93760) */
-  -0.3809415435, /* sin(0.93780) */
-  -0.3797793576, /* sin(0.93800) */
-  -0.3786165719, /* sin(0.93820) */
-  -0.3774531883, /* sin(0.93840) */
-  -0.3762892087, /* sin(0.93860) */
-  -0.3751246349, /* sin(0.93880) */
-  -0.3739594687, /* sin(0.93900) */
-  -0.3727937120, /* sin(0.93920) */
-  -0.3716273666, /* sin(0.93940) */
-  -0.3704604343, /* sin(0.93960) */
-  -0.3692929171, /* sin(0.93980) */
-  -0.3681248166, /* sin(0.94000) */
-  -0.3669561349, /* sin(0.94020) */
-  -0.3657868736, /* sin(0.94040) */
-  -0.3646170348, /* sin(0.94060) */
-  -0.3634466201, /* sin(0.94080) */
-  -0.3622756316, /* sin(0.94100) */
-  -0.3611040709, /* sin(0.94120) */
-  -0.3599319400, /* sin(0.94140) */
-  -0.3587592408, /* sin(0.94160) */
-  -0.3575859750, /* sin(0.94180) */
-  -0.3564121445, /* sin(0.94200) */
-  -0.3552377512, /* sin(0.94220) */
-  -0.3540627969, /* sin(0.94240) */
-  -0.3528872836, /* sin(0.94260) */
-  -0.3517112129, /* sin(0.94280) */
-  -0.3505345869, /* sin(0.94300) */
-  -0.3493574073, /* sin(0.94320) */
-  -0.3481796761, /* sin(0.94340) */
-  -0.3470013950, /* sin(0.94360) */
-  -0.3458225659, /* sin(0.94380) */
-  -0.3446431908, /* sin(0.94400) */
-  -0.3434632714, /* sin(0.94420) */
-  -0.3422828096, /* sin(0.94440) */
-  -0.3411018074, /* sin(0.94460) */
-  -0.3399202665, /* sin(0.94480) */
-  -0.3387381888, /* sin(0.94500) */
-  -0.3375555761, /* sin(0.94520) */
-  -0.3363724305, /* sin(0.94540) */
-  -0.3351887536, /* sin(0.94560) */
-  -0.3340045475, /* sin(0.94580) */
-  -0.3328198139, /* sin(0.94600) */
-  -0.3316345548, /* sin(0.94620) */
-  -0.3304487719, /* sin(0.94640) */
-  -0.3292624672, /* sin(0.94660) */
-  -0.3280756426, /* sin(0.94680) */
-  -0.3268882999, /* sin(0.94700) */
-  -0.3257004410, /* sin(0.94720) */
-  -0.3245120678, /* sin(0.94740) */
-  -0.3233231821, /* sin(0.94760) */
-  -0.3221337859, /* sin(0.94780) */
-  -0.3209438810, /* sin(0.94800) */
-  -0.3197534692, /* sin(0.94820) */
-  -0.3185625525, /* sin(0.94840) */
-  -0.3173711328, /* sin(0.94860) */
-  -0.3161792119, /* sin(0.94880) */
-  -0.3149867917, /* sin(0.94900) */
-  -0.3137938740, /* sin(0.94920) */
-  -0.3126004609, /* sin(0.94940) */
-  -0.3114065541, /* sin(0.94960) */
-  -0.3102121556, /* sin(0.94980) */
-  -0.3090172672, /* sin(0.95000) */
-  -0.3078218909, /* sin(0.95020) */
-  -0.3066260284, /* sin(0.95040) */
-  -0.3054296817, /* sin(0.95060) */
-  -0.3042328527, /* sin(0.95080) */
-  -0.3030355433, /* sin(0.95100) */
-  -0.3018377554, /* sin(0.95120) */
-  -0.3006394908, /* sin(0.95140) */
-  -0.2994407515, /* sin(0.95160) */
-  -0.2982415393, /* sin(0.95180) */
-  -0.2970418561, /* sin(0.95200) */
-  -0.2958417039, /* sin(0.95220) */
-  -0.2946410845, /* sin(0.95240) */
-  -0.2934399998, /* sin(0.95260) */
-  -0.2922384517, /* sin(0.95280) */
-  -0.2910364422, /* sin(0.95300) */
-  -0.2898339730, /* sin(0.95320) */
-  -0.2886310462, /* sin(0.95340) */
-  -0.2874276636, /* sin(0.95360) */
-  -0.2862238271, /* sin(0.95380) */
-  -0.2850195386, /* sin(0.95400) */
-  -0.2838148001, /* sin(0.95420) */
-  -0.2826096133, /* sin(0.95440) */
-  -0.2814039803, /* sin(0.95460) */
-  -0.2801979029, /* sin(0.95480) */
-  -0.2789913830, /* sin(0.95500) */
-  -0.2777844225, /* sin(0.95520) */
-  -0.2765770234, /* sin(0.95540) */
-  -0.2753691876, /* sin(0.95560) */
-  -0.2741609169, /* sin(0.95580) */
-  -0.2729522133, /* sin(0.95600) */
-  -0.2717430786, /* sin(0.95620) */
-  -0.2705335148, /* sin(0.95640) */
-  -0.2693235238, /* sin(0.95660) */
-  -0.2681131075, /* sin(0.95680) */
-  -0.2669022678, /* sin(0.95700) */
-  -0.2656910067, /* sin(0.95720) */
-  -0.2644793260, /* sin(0.95740) */
-  -0.2632672276, /* sin(0.95760) */
-  -0.2620547135, /* sin(0.95780) */
-  -0.2608417856, /* sin(0.95800) */
-  -0.2596284458, /* sin(0.95820) */
-  -0.2584146959, /* sin(0.95840) */
-  -0.2572005381, /* sin(0.95860) */
-  -0.2559859740, /* sin(0.95880) */
-  -0.2547710057, /* sin(0.95900) */
-  -0.2535556351, /* sin(0.95920) */
-  -0.2523398641, /* sin(0.95940) */
-  -0.2511236947, /* sin(0.95960) */
-  -0.2499071286, /* sin(0.95980) */
-  -0.2486901680, /* sin(0.96000) */
-  -0.2474728146, /* sin(0.96020) */
-  -0.2462550704, /* sin(0.96040) */
-  -0.2450369374, /* sin(0.96060) */
-  -0.2438184174, /* sin(0.96080) */
-  -0.2425995123, /* sin(0.96100) */
-  -0.2413802242, /* sin(0.96120) */
-  -0.2401605549, /* sin(0.96140) */
-  -0.2389405064, /* sin(0.96160) */
-  -0.2377200805, /* sin(0.96180) */
-  -0.2364992793, /* sin(0.96200) */
-  -0.2352781046, /* sin(0.96220) */
-  -0.2340565583, /* sin(0.96240) */
-  -0.2328346425, /* sin(0.96260) */
-  -0.2316123590, /* sin(0.96280) */
-  -0.2303897097, /* sin(0.96300) */
-  -0.2291666966, /* sin(0.96320) */
-  -0.2279433216, /* sin(0.96340) */
-  -0.2267195867, /* sin(0.96360) */
-  -0.2254954937, /* sin(0.96380) */
-  -0.2242710447, /* sin(0.96400) */
-  -0.2230462415, /* sin(0.96420) */
-  -0.2218210860, /* sin(0.96440) */
-  -0.2205955803, /* sin(0.96460) */
-  -0.2193697263, /* sin(0.96480) */
-  -0.2181435258, /* sin(0.96500) */
-  -0.2169169809, /* sin(0.96520) */
-  -0.2156900934, /* sin(0.96540) */
-  -0.2144628653, /* sin(0.96560) */
-  -0.2132352985, /* sin(0.96580) */
-  -0.2120073950, /* sin(0.96600) */
-  -0.2107791567, /* sin(0.96620) */
-  -0.2095505856, /* sin(0.96640) */
-  -0.2083216836, /* sin(0.96660) */
-  -0.2070924526, /* sin(0.96680) */
-  -0.2058628945, /* sin(0.96700) */
-  -0.2046330114, /* sin(0.96720) */
-  -0.2034028052, /* sin(0.96740) */
-  -0.2021722777, /* sin(0.96760) */
-  -0.2009414310, /* sin(0.96780) */
-  -0.1997102670, /* sin(0.96800) */
-  -0.1984787876, /* sin(0.96820) */
-  -0.1972469947, /* sin(0.96840) */
-  -0.1960148904, /* sin(0.96860) */
-  -0.1947824766, /* sin(0.96880) */
-  -0.1935497551, /* sin(0.96900) */
-  -0.1923167281, /* sin(0.96920) */
-  -0.1910833973, /* sin(0.96940) */
-  -0.1898497648, /* sin(0.96960) */
-  -0.1886158325, /* sin(0.96980) */
-  -0.1873816023, /* sin(0.97000) */
-  -0.1861470763, /* sin(0.97020) */
-  -0.1849122563, /* sin(0.97040) */
-  -0.1836771442, /* sin(0.97060) */
-  -0.1824417422, /* sin(0.97080) */
-  -0.1812060520, /* sin(0.97100) */
-  -0.1799700757, /* sin(0.97120) */
-  -0.1787338152, /* sin(0.97140) */
-  -0.1774972724, /* sin(0.97160) */
-  -0.1762604494, /* sin(0.97180) */
-  -0.1750233480, /* sin(0.97200) */
-  -0.1737859702, /* sin(0.97220) */
-  -0.1725483180, /* sin(0.97240) */
-  -0.1713103933, /* sin(0.97260) */
-  -0.1700721981, /* sin(0.97280) */
-  -0.1688337343, /* sin(0.97300) */
-  -0.1675950039, /* sin(0.97320) */
-  -0.1663560089, /* sin(0.97340) */
-  -0.1651167512, /* sin(0.97360) */
-  -0.1638772327, /* sin(0.97380) */
-  -0.1626374554, /* sin(0.97400) */
-  -0.1613974213, /* sin(0.97420) */
-  -0.1601571324, /* sin(0.97440) */
-  -0.1589165905, /* sin(0.97460) */
-  -0.1576757977, /* sin(0.97480) */
-  -0.1564347559, /* sin(0.97500) */
-  -0.1551934670, /* sin(0.97520) */
-  -0.1539519331, /* sin(0.97540) */
-  -0.1527101561, /* sin(0.97560) */
-  -0.1514681379, /* sin(0.97580) */
-  -0.1502258805, /* sin(0.97600) */
-  -0.1489833859, /* sin(0.97620) */
-  -0.1477406561, /* sin(0.97640) */
-  -0.1464976929, /* sin(0.97660) */
-  -0.1452544984, /* sin(0.97680) */
-  -0.1440110745, /* sin(0.97700) */
-  -0.1427674232, /* sin(0.97720) */
-  -0.1415235465, /* sin(0.97740) */
-  -0.1402794463, /* sin(0.97760) */
-  -0.1390351245, /* sin(0.97780) */
-  -0.1377905832, /* sin(0.97800) */
-  -0.1365458243, /* sin(0.97820) */
-  -0.1353008498, /* sin(0.97840) */
-  -0.1340556616, /* sin(0.97860) */
-  -0.1328102618, /* sin(0.97880) */
-  -0.1315646522, /* sin(0.97900) */
-  -0.1303188348, /* sin(0.97920) */
-  -0.1290728117, /* sin(0.97940) */
-  -0.1278265847, /* sin(0.97960) */
-  -0.1265801559, /* sin(0.97980) */
-  -0.1253335272, /* sin(0.98000) */
-  -0.1240867006, /* sin(0.98020) */
-  -0.1228396780, /* sin(0.98040) */
-  -0.1215924614, /* sin(0.98060) */
-  -0.1203450529, /* sin(0.98080) */
-  -0.1190974542, /* sin(0.98100) */
-  -0.1178496676, /* sin(0.98120) */
-  -0.1166016948, /* sin(0.98140) */
-  -0.1153535379, /* sin(0.98160) */
-  -0.1141051988, /* sin(0.98180) */
-  -0.1128566795, /* sin(0.98200) */
-  -0.1116079821, /* sin(0.98220) */
-  -0.1103591083, /* sin(0.98240) */
-  -0.1091100603, /* sin(0.98260) */
-  -0.1078608401, /* sin(0.98280) */
-  -0.1066114494, /* sin(0.98300) */
-  -0.1053618905, /* sin(0.98320) */
-  -0.1041121651, /* sin(0.98340) */
-  -0.1028622754, /* sin(0.98360) */
-  -0.1016122232, /* sin(0.98380) */
-  -0.1003620105, /* sin(0.98400) */
-  -0.0991116394, /* sin(0.98420) */
-  -0.0978611117, /* sin(0.98440) */
-  -0.0966104295, /* sin(0.98460) */
-  -0.0953595948, /* sin(0.98480) */
-  -0.0941086095, /* sin(0.98500) */
-  -0.0928574755, /* sin(0.98520) */
-  -0.0916061949, /* sin(0.98540) */
-  -0.0903547697, /* sin(0.98560) */
-  -0.0891032018, /* sin(0.98580) */
-  -0.0878514932, /* sin(0.98600) */
-  -0.0865996458, /* sin(0.98620) */
-  -0.0853476617, /* sin(0.98640) */
-  -0.0840955428, /* sin(0.98660) */
-  -0.0828432911, /* sin(0.98680) */
-  -0.0815909086, /* sin(0.98700) */
-  -0.0803383973, /* sin(0.98720) */
-  -0.0790857591, /* sin(0.98740) */
-  -0.0778329960, /* sin(0.98760) */
-  -0.0765801100, /* sin(0.98780) */
-  -0.0753271030, /* sin(0.98800) */
-  -0.0740739772, /* sin(0.98820) */
-  -0.0728207343, /* sin(0.98840) */
-  -0.0715673764, /* sin(0.98860) */
-  -0.0703139056, /* sin(0.98880) */
-  -0.0690603237, /* sin(0.98900) */
-  -0.0678066327, /* sin(0.98920) */
-  -0.0665528347, /* sin(0.98940) */
-  -0.0652989315, /* sin(0.98960) */
-  -0.0640449253, /* sin(0.98980) */
-  -0.0627908179, /* sin(0.99000) */
-  -0.0615366114, /* sin(0.99020) */
-  -0.0602823077, /* sin(0.99040) */
-  -0.0590279088, /* sin(0.99060) */
-  -0.0577734166, /* sin(0.99080) */
-  -0.0565188333, /* sin(0.99100) */
-  -0.0552641607, /* sin(0.99120) */
-  -0.0540094008, /* sin(0.99140) */
-  -0.0527545556, /* sin(0.99160) */
-  -0.0514996272, /* sin(0.99180) */
-  -0.0502446174, /* sin(0.99200) */
-  -0.0489895282, /* sin(0.99220) */
-  -0.0477343617, /* sin(0.99240) */
-  -0.0464791199, /* sin(0.99260) */
-  -0.0452238046, /* sin(0.99280) */
-  -0.0439684179, /* sin(0.99300) */
-  -0.0427129618, /* sin(0.99320) */
-  -0.0414574382, /* sin(0.99340) */
-  -0.0402018492, /* sin(0.99360) */
-  -0.0389461967, /* sin(0.99380) */
-  -0.0376904826, /* sin(0.99400) */
-  -0.0364347091, /* sin(0.99420) */
-  -0.0351788780, /* sin(0.99440) */
-  -0.0339229914, /* sin(0.99460) */
-  -0.0326670512, /* sin(0.99480) */
-  -0.0314110594, /* sin(0.99500) */
-  -0.0301550180, /* sin(0.99520) */
-  -0.0288989290, /* sin(0.99540) */
-  -0.0276427944, /* sin(0.99560) */
-  -0.0263866161, /* sin(0.99580) */
-  -0.0251303961, /* sin(0.99600) */
-  -0.0238741365, /* sin(0.99620) */
-  -0.0226178391, /* sin(0.99640) */
-  -0.0213615061, /* sin(0.99660) */
-  -0.0201051393, /* sin(0.99680) */
-  -0.0188487407, /* sin(0.99700) */
-  -0.0175923124, /* sin(0.99720) */
-  -0.0163358564, /* sin(0.99740) */
-  -0.0150793745, /* sin(0.99760) */
-  -0.0138228688, /* sin(0.99780) */
-  -0.0125663412, /* sin(0.99800) */
-  -0.0113097939, /* sin(0.99820) */
-  -0.0100532286, /* sin(0.99840) */
-  -0.0087966475, /* sin(0.99860) */
-  -0.0075400526, /* sin(0.99880) */
-  -0.0062834456, /* sin(0.99900) */
-  -0.0050268288, /* sin(0.99920) */
-  -0.0037702041, /* sin(0.99940) */
-  -0.0025135733, /* sin(0.99960) */
-  -0.0012569387, /* sin(0.99980) */
-};
-#define SIN(x) (isnan(x) ? NAN : sin_lut[(int) ((x) * 5000)])
-static float pow_lut[] = {
-  0.0312500000, /* pow(2, -5.00000) */
-  0.0317045417, /* pow(2, -4.97917) */
-  0.0321656949, /* pow(2, -4.95833) */
-  0.0326335557, /* pow(2, -4.93750) */
-  0.0331082217, /* pow(2, -4.91667) */
-  0.0335897919, /* pow(2, -4.89583) */
-  0.0340783666, /* pow(2, -4.87500) */
-  0.0345740479, /* pow(2, -4.85417) */
-  0.0350769390, /* pow(2, -4.83333) */
-  0.0355871448, /* pow(2, -4.81250) */
-  0.0361047718, /* pow(2, -4.79167) */
-  0.0366299278, /* pow(2, -4.77083) */
-  0.0371627223, /* pow(2, -4.75000) */
-  0.0377032666, /* pow(2, -4.72917) */
-  0.0382516732, /* pow(2, -4.70833) */
-  0.0388080566, /* pow(2, -4.68750) */
-  0.0393725328, /* pow(2, -4.66667) */
-  0.0399452195, /* pow(2, -4.64583) */
-  0.0405262361, /* pow(2, -4.62500) */
-  0.0411157038, /* pow(2, -4.60417) */
-  0.0417137454, /* pow(2, -4.58333) */
-  0.0423204858, /* pow(2, -4.56250) */
-  0.0429360515, /* pow(2, -4.54167) */
-  0.0435605707, /* pow(2, -4.52083) */
-  0.0441941738, /* pow(2, -4.50000) */
-  0.0448369929, /* pow(2, -4.47917) */
-  0.0454891620, /* pow(2, -4.45833) */
-  0.0461508171, /* pow(2, -4.43750) */
-  0.0468220962, /* pow(2, -4.41667) */
-  0.0475031392, /* pow(2, -4.39583) */
-  0.0481940883, /* pow(2, -4.37500) */
-  0.0488950875, /* pow(2, -4.35417) */
-  0.0496062829, /* pow(2, -4.33333) */
-  0.0503278229, /* pow(2, -4.31250) */
-  0.0510598579, /* pow(2, -4.29167) */
-  0.0518025406, /* pow(2, -4.27083) */
-  0.0525560260, /* pow(2, -4.25000) */
-  0.0533204710, /* pow(2, -4.22917) */
-  0.0540960351, /* pow(2, -4.20833) */
-  0.0548828800, /* pow(2, -4.18750) */
-  0.0556811699, /* pow(2, -4.16667) */
-  0.0564910711, /* pow(2, -4.14583) */
-  0.0573127527, /* pow(2, -4.12500) */
-  0.0581463859, /* pow(2, -4.10417) */
-  0.0589921445, /* pow(2, -4.08333) */
-  0.0598502050, /* pow(2, -4.06250) */
-  0.0607207463, /* pow(2, -4.04167) */
-  0.0616039499, /* pow(2, -4.02083) */
-  0.0625000000, /* pow(2, -4.00000) */
-  0.0634090834, /* pow(2, -3.97917) */
-  0.0643313898, /* pow(2, -3.95833) */
-  0.0652671114, /* pow(2, -3.93750) */
-  0.0662164434, /* pow(2, -3.91667) */
-  0.0671795837, /* pow(2, -3.89583) */
-  0.0681567333, /* pow(2, -3.87500) */
-  0.0691480958, /* pow(2, -3.85417) */
-  0.0701538780, /* pow(2, -3.83333) */
-  0.0711742897, /* pow(2, -3.81250) */
-  0.0722095436, /* pow(2, -3.79167) */
-  0.0732598556, /* pow(2, -3.77083) */
-  0.0743254447, /* pow(2, -3.75000) */
-  0.0754065332, /* pow(2, -3.72917) */
-  0.0765033465, /* pow(2, -3.70833) */
-  0.0776161133, /* pow(2, -3.68750) */
-  0.0787450656, /* pow(2, -3.66667) */
-  0.0798904390, /* pow(2, -3.64583) */
-  0.0810524722, /* pow(2, -3.62500) */
-  0.0822314075, /* pow(2, -3.60417) */
-  0.0834274909, /* pow(2, -3.58333) */
-  0.0846409717, /* pow(2, -3.56250) */
-  0.0858721030, /* pow(2, -3.54167) */
-  0.0871211415, /* pow(2, -3.52083) */
-  0.0883883476, /* pow(2, -3.50000) */
-  0.0896739858, /* pow(2, -3.47917) */
-  0.0909783239, /* pow(2, -3.45833) */
-  0.0923016341, /* pow(2, -3.43750) */
-  0.0936441923, /* pow(2, -3.41667) */
-  0.0950062784, /* pow(2, -3.39583) */
-  0.0963881766, /* pow(2, -3.37500) */
-  0.0977901749, /* pow(2, -3.35417) */
-  0.0992125657, /* pow(2, -3.33333) */
-  0.1006556457, /* pow(2, -3.31250) */
-  0.1021197158, /* pow(2, -3.29167) */
-  0.1036050813, /* pow(2, -3.27083) */
-  0.1051120519, /* pow(2, -3.25000) */
-  0.1066409419, /* pow(2, -3.22917) */
-  0.1081920701, /* pow(2, -3.20833) */
-  0.1097657600, /* pow(2, -3.18750) */
-  0.1113623398, /* pow(2, -3.16667) */
-  0.1129821423, /* pow(2, -3.14583) */
-  0.1146255054, /* pow(2, -3.12500) */
-  0.1162927718, /* pow(2, -3.10417) */
-  0.1179842891, /* pow(2, -3.08333) */
-  0.1197004101, /* pow(2, -3.06250) */
-  0.1214414926, /* pow(2, -3.04167) */
-  0.1232078998, /* pow(2, -3.02083) */
-  0.1250000000, /* pow(2, -3.00000) */
-  0.1268181669, /* pow(2, -2.97917) */
-  0.1286627796, /* pow(2, -2.95833) */
-  0.1305342228, /* pow(2, -2.93750) */
-  0.1324328868, /* pow(2, -2.91667) */
-  0.1343591675, /* pow(2, -2.89583) */
-  0.1363134666, /* pow(2, -2.87500) */
-  0.1382961916, /* pow(2, -2.85417) */
-  0.1403077560, /* pow(2, -2.83333) */
-  0.1423485793, /* pow(2, -2.81250) */
-  0.1444190871, /* pow(2, -2.79167) */
-  0.1465197111, /* pow(2, -2.77083) */
-  0.1486508894, /* pow(2, -2.75000) */
-  0.1508130664, /* pow(2, -2.72917) */
-  0.1530066929, /* pow(2, -2.70833) */
-  0.1552322265, /* pow(2, -2.68750) */
-  0.1574901312, /* pow(2, -2.66667) */
-  0.1597808779, /* pow(2, -2.64583) */
-  0.1621049443, /* pow(2, -2.62500) */
-  0.1644628150, /* pow(2, -2.60417) */
-  0.1668549818, /* pow(2, -2.58333) */
-  0.1692819434, /* pow(2, -2.56250) */
-  0.1717442059, /* pow(2, -2.54167) */
-  0.1742422829, /* pow(2, -2.52083) */
-  0.1767766953, /* pow(2, -2.50000) */
-  0.1793479715, /* pow(2, -2.47917) */
-  0.1819566479, /* pow(2, -2.45833) */
-  0.1846032682, /* pow(2, -2.43750) */
-  0.1872883846, /* pow(2, -2.41667) */
-  0.1900125569, /* pow(2, -2.39583) */
-  0.1927763532, /* pow(2, -2.37500) */
-  0.1955803498, /* pow(2, -2.35417) */
-  0.1984251315, /* pow(2, -2.33333) */
-  0.2013112915, /* pow(2, -2.31250) */
-  0.2042394317, /* pow(2, -2.29167) */
-  0.2072101626, /* pow(2, -2.27083) */
-  0.2102241038, /* pow(2, -2.25000) */
-  0.2132818838, /* pow(2, -2.22917) */
-  0.2163841403, /* pow(2, -2.20833) */
-  0.2195315200, /* pow(2, -2.18750) */
-  0.2227246795, /* pow(2, -2.16667) */
-  0.2259642846, /* pow(2, -2.14583) */
-  0.2292510108, /* pow(2, -2.12500) */
-  0.2325855435, /* pow(2, -2.10417) */
-  0.2359685782, /* pow(2, -2.08333) */
-  0.2394008202, /* pow(2, -2.06250) */
-  0.2428829853, /* pow(2, -2.04167) */
-  0.2464157997, /* pow(2, -2.02083) */
-  0.2500000000, /* pow(2, -2.00000) */
-  0.2536363337, /* pow(2, -1.97917) */
-  0.2573255592, /* pow(2, -1.95833) */
-  0.2610684456, /* pow(2, -1.93750) */
-  0.2648657736, /* pow(2, -1.91667) */
-  0.2687183350, /* pow(2, -1.89583) */
-  0.2726269332, /* pow(2, -1.87500) */
-  0.2765923832, /* pow(2, -1.85417) */
-  0.2806155121, /* pow(2, -1.83333) */
-  0.2846971587, /* pow(2, -1.81250) */
-  0.2888381742, /* pow(2, -1.79167) */
-  0.2930394222, /* pow(2, -1.77083) */
-  0.2973017788, /* pow(2, -1.75000) */
-  0.3016261327, /* pow(2, -1.72917) */
-  0.3060133858, /* pow(2, -1.70833) */
-  0.3104644530, /* pow(2, -1.68750) */
-  0.3149802625, /* pow(2, -1.66667) */
-  0.3195617559, /* pow(2, -1.64583) */
-  0.3242098887, /* pow(2, -1.62500) */
-  0.3289256301, /* pow(2, -1.60417) */
-  0.3337099635, /* pow(2, -1.58333) */
-  0.3385638867, /* pow(2, -1.56250) */
-  0.3434884119, /* pow(2, -1.54167) */
-  0.3484845659, /* pow(2, -1.52083) */
-  0.3535533906, /* pow(2, -1.50000) */
-  0.3586959431, /* pow(2, -1.47917) */
-  0.3639132957, /* pow(2, -1.45833) */
-  0.3692065365, /* pow(2, -1.43750) */
-  0.3745767692, /* pow(2, -1.41667) */
-  0.3800251138, /* pow(2, -1.39583) */
-  0.3855527064, /* pow(2, -1.37500) */
-  0.3911606996, /* pow(2, -1.35417) */
-  0.3968502630, /* pow(2, -1.33333) */
-  0.4026225830, /* pow(2, -1.31250) */
-  0.4084788633, /* pow(2, -1.29167) */
-  0.4144203252, /* pow(2, -1.27083) */
-  0.4204482076, /* pow(2, -1.25000) */
-  0.4265637676, /* pow(2, -1.22917) */
-  0.4327682805, /* pow(2, -1.20833) */
-  0.4390630401, /* pow(2, -1.18750) */
-  0.4454493591, /* pow(2, -1.16667) */
-  0.4519285692, /* pow(2, -1.14583) */
-  0.4585020216, /* pow(2, -1.12500) */
-  0.4651710871, /* pow(2, -1.10417) */
-  0.4719371563, /* pow(2, -1.08333) */
-  0.4788016403, /* pow(2, -1.06250) */
-  0.4857659706, /* pow(2, -1.04167) */
-  0.4928315993, /* pow(2, -1.02083) */
-  0.5000000000, /* pow(2, -1.00000) */
-  0.5072726675, /* pow(2, -0.97917) */
-  0.5146511183, /* pow(2, -0.95833) */
-  0.5221368912, /* pow(2, -0.93750) */
-  0.5297315472, /* pow(2, -0.91667) */
-  0.5374366700, /* pow(2, -0.89583) */
-  0.5452538663, /* pow(2, -0.87500) */
-  0.5531847664, /* pow(2, -0.85417) */
-  0.5612310242, /* pow(2, -0.83333) */
-  0.5693943174, /* pow(2, -0.81250) */
-  0.5776763484, /* pow(2, -0.79167) */
-  0.5860788444, /* pow(2, -0.77083) */
-  0.5946035575, /* pow(2, -0.75000) */
-  0.6032522654, /* pow(2, -0.72917) */
-  0.6120267717, /* pow(2, -0.70833) */
-  0.6209289060, /* pow(2, -0.68750) */
-  0.6299605249, /* pow(2, -0.66667) */
-  0.6391235118, /* pow(2, -0.64583) */
-  0.6484197773, /* pow(2, -0.62500) */
-  0.6578512602, /* pow(2, -0.60417) */
-  0.6674199271, /* pow(2, -0.58333) */
-  0.6771277735, /* pow(2, -0.56250) */
-  0.6869768237, /* pow(2, -0.54167) */
-  0.6969691317, /* pow(2, -0.52083) */
-  0.7071067812, /* pow(2, -0.50000) */
-  0.7173918862, /* pow(2, -0.47917) */
-  0.7278265914, /* pow(2, -0.45833) */
-  0.7384130730, /* pow(2, -0.43750) */
-  0.7491535384, /* pow(2, -0.41667) */
-  0.7600502276, /* pow(2, -0.39583) */
-  0.7711054127, /* pow(2, -0.37500) */
-  0.7823213992, /* pow(2, -0.35417) */
-  0.7937005260, /* pow(2, -0.33333) */
-  0.8052451660, /* pow(2, -0.31250) */
-  0.8169577266, /* pow(2, -0.29167) */
-  0.8288406504, /* pow(2, -0.27083) */
-  0.8408964153, /* pow(2, -0.25000) */
-  0.8531275353, /* pow(2, -0.22917) */
-  0.8655365610, /* pow(2, -0.20833) */
-  0.8781260802, /* pow(2, -0.18750) */
-  0.8908987181, /* pow(2, -0.16667) */
-  0.9038571384, /* pow(2, -0.14583) */
-  0.9170040432, /* pow(2, -0.12500) */
-  0.9303421742, /* pow(2, -0.10417) */
-  0.9438743127, /* pow(2, -0.08333) */
-  0.9576032807, /* pow(2, -0.06250) */
-  0.9715319412, /* pow(2, -0.04167) */
-  0.9856631986, /* pow(2, -0.02083) */
-  1.0000000000, /* pow(2, -0.00000) */
-  1.0145453349, /* pow(2, 0.02083) */
-  1.0293022366, /* pow(2, 0.04167) */
-  1.0442737824, /* pow(2, 0.06250) */
-  1.0594630944, /* pow(2, 0.08333) */
-  1.0748733399, /* pow(2, 0.10417) */
-  1.0905077327, /* pow(2, 0.12500) */
-  1.1063695329, /* pow(2, 0.14583) */
-  1.1224620483, /* pow(2, 0.16667) */
-  1.1387886348, /* pow(2, 0.18750) */
-  1.1553526969, /* pow(2, 0.20833) */
-  1.1721576888, /* pow(2, 0.22917) */
-  1.1892071150, /* pow(2, 0.25000) */
-  1.2065045308, /* pow(2, 0.27083) */
-  1.2240535433, /* pow(2, 0.29167) */
-  1.2418578121, /* pow(2, 0.31250) */
-  1.2599210499, /* pow(2, 0.33333) */
-  1.2782470236, /* pow(2, 0.35417) */
-  1.2968395547, /* pow(2, 0.37500) */
-  1.3157025203, /* pow(2, 0.39583) */
-  1.3348398542, /* pow(2, 0.41667) */
-  1.3542555469, /* pow(2, 0.43750) */
-  1.3739536475, /* pow(2, 0.45833) */
-  1.3939382634, /* pow(2, 0.47917) */
-  1.4142135624, /* pow(2, 0.50000) */
-  1.4347837723, /* pow(2, 0.52083) */
-  1.4556531828, /* pow(2, 0.54167) */
-  1.4768261459, /* pow(2, 0.56250) */
-  1.4983070769, /* pow(2, 0.58333) */
-  1.5201004551, /* pow(2, 0.60417) */
-  1.5422108254, /* pow(2, 0.62500) */
-  1.5646427984, /* pow(2, 0.64583) */
-  1.5874010520, /* pow(2, 0.66667) */
-  1.6104903319, /* pow(2, 0.68750) */
-  1.6339154532, /* pow(2, 0.70833) */
-  1.6576813008, /* pow(2, 0.72917) */
-  1.6817928305, /* pow(2, 0.75000) */
-  1.7062550705, /* pow(2, 0.77083) */
-  1.7310731220, /* pow(2, 0.79167) */
-  1.7562521604, /* pow(2, 0.81250) */
-  1.7817974363, /* pow(2, 0.83333) */
-  1.8077142768, /* pow(2, 0.85417) */
-  1.8340080864, /* pow(2, 0.87500) */
-  1.8606843483, /* pow(2, 0.89583) */
-  1.8877486254, /* pow(2, 0.91667) */
-  1.9152065614, /* pow(2, 0.93750) */
-  1.9430638823, /* pow(2, 0.95833) */
-  1.9713263973, /* pow(2, 0.97917) */
-  2.0000000000, /* pow(2, 1.00000) */
-  2.0290906699, /* pow(2, 1.02083) */
-  2.0586044733, /* pow(2, 1.04167) */
-  2.0885475649, /* pow(2, 1.06250) */
-  2.1189261887, /* pow(2, 1.08333) */
-  2.1497466798, /* pow(2, 1.10417) */
-  2.1810154653, /* pow(2, 1.12500) */
-  2.2127390658, /* pow(2, 1.14583) */
-  2.2449240966, /* pow(2, 1.16667) */
-  2.2775772695, /* pow(2, 1.18750) */
-  2.3107053937, /* pow(2, 1.20833) */
-  2.3443153776, /* pow(2, 1.22917) */
-  2.3784142300, /* pow(2, 1.25000) */
-  2.4130090616, /* pow(2, 1.27083) */
-  2.4481070866, /* pow(2, 1.29167) */
-  2.4837156241, /* pow(2, 1.31250) */
-  2.5198420998, /* pow(2, 1.33333) */
-  2.5564940471, /* pow(2, 1.35417) */
-  2.5936791093, /* pow(2, 1.37500) */
-  2.6314050407, /* pow(2, 1.39583) */
-  2.6696797083, /* pow(2, 1.41667) */
-  2.7085110939, /* pow(2, 1.43750) */
-  2.7479072949, /* pow(2, 1.45833) */
-  2.7878765269, /* pow(2, 1.47917) */
-  2.8284271247, /* pow(2, 1.50000) */
-  2.8695675446, /* pow(2, 1.52083) */
-  2.9113063657, /* pow(2, 1.54167) */
-  2.9536522919, /* pow(2, 1.56250) */
-  2.9966141538, /* pow(2, 1.58333) */
-  3.0402009103, /* pow(2, 1.60417) */
-  3.0844216508, /* pow(2, 1.62500) */
-  3.1292855968, /* pow(2, 1.64583) */
-  3.1748021039, /* pow(2, 1.66667) */
-  3.2209806639, /* pow(2, 1.68750) */
-  3.2678309065, /* pow(2, 1.70833) */
-  3.3153626015, /* pow(2, 1.72917) */
-  3.3635856610, /* pow(2, 1.75000) */
-  3.4125101410, /* pow(2, 1.77083) */
-  3.4621462440, /* pow(2, 1.79167) */
-  3.5125043207, /* pow(2, 1.81250) */
-  3.5635948726, /* pow(2, 1.83333) */
-  3.6154285536, /* pow(2, 1.85417) */
-  3.6680161728, /* pow(2, 1.87500) */
-  3.7213686966, /* pow(2, 1.89583) */
-  3.7754972507, /* pow(2, 1.91667) */
-  3.8304131228, /* pow(2, 1.93750) */
-  3.8861277646, /* pow(2, 1.95833) */
-  3.9426527946, /* pow(2, 1.97917) */
-  4.0000000000, /* pow(2, 2.00000) */
-  4.0581813398, /* pow(2, 2.02083) */
-  4.1172089466, /* pow(2, 2.04167) */
-  4.1770951297, /* pow(2, 2.06250) */
-  4.2378523774, /* pow(2, 2.08333) */
-  4.2994933597, /* pow(2, 2.10417) */
-  4.3620309307, /* pow(2, 2.12500) */
-  4.4254781316, /* pow(2, 2.14583) */
-  4.4898481932, /* pow(2, 2.16667) */
-  4.5551545390, /* pow(2, 2.18750) */
-  4.6214107875, /* pow(2, 2.20833) */
-  4.6886307553, /* pow(2, 2.22917) */
-  4.7568284600, /* pow(2, 2.25000) */
-  4.8260181232, /* pow(2, 2.27083) */
-  4.8962141732, /* pow(2, 2.29167) */
-  4.9674312483, /* pow(2, 2.31250) */
-  5.0396841996, /* pow(2, 2.33333) */
-  5.1129880942, /* pow(2, 2.35417) */
-  5.1873582186, /* pow(2, 2.37500) */
-  5.2628100813, /* pow(2, 2.39583) */
-  5.3393594167, /* pow(2, 2.41667) */
-  5.4170221877, /* pow(2, 2.43750) */
-  5.4958145898, /* pow(2, 2.45833) */
-  5.5757530538, /* pow(2, 2.47917) */
-  5.6568542495, /* pow(2, 2.50000) */
-  5.7391350892, /* pow(2, 2.52083) */
-  5.8226127314, /* pow(2, 2.54167) */
-  5.9073045838, /* pow(2, 2.56250) */
-  5.9932283075, /* pow(2, 2.58333) */
-  6.0804018206, /* pow(2, 2.60417) */
-  6.1688433016, /* pow(2, 2.62500) */
-  6.2585711936, /* pow(2, 2.64583) */
-  6.3496042079, /* pow(2, 2.66667) */
-  6.4419613278, /* pow(2, 2.68750) */
-  6.5356618130, /* pow(2, 2.70833) */
-  6.6307252031, /* pow(2, 2.72917) */
-  6.7271713220, /* pow(2, 2.75000) */
-  6.8250202821, /* pow(2, 2.77083) */
-  6.9242924880, /* pow(2, 2.79167) */
-  7.0250086415, /* pow(2, 2.81250) */
-  7.1271897451, /* pow(2, 2.83333) */
-  7.2308571071, /* pow(2, 2.85417) */
-  7.3360323456, /* pow(2, 2.87500) */
-  7.4427373932, /* pow(2, 2.89583) */
-  7.5509945015, /* pow(2, 2.91667) */
-  7.6608262456, /* pow(2, 2.93750) */
-  7.7722555292, /* pow(2, 2.95833) */
-  7.8853055891, /* pow(2, 2.97917) */
-  8.0000000000, /* pow(2, 3.00000) */
-  8.1163626795, /* pow(2, 3.02083) */
-  8.2344178931, /* pow(2, 3.04167) */
-  8.3541902594, /* pow(2, 3.06250) */
-  8.4757047549, /* pow(2, 3.08333) */
-  8.5989867194, /* pow(2, 3.10417) */
-  8.7240618613, /* pow(2, 3.12500) */
-  8.8509562631, /* pow(2, 3.14583) */
-  8.9796963865, /* pow(2, 3.16667) */
-  9.1103090781, /* pow(2, 3.18750) */
-  9.2428215750, /* pow(2, 3.20833) */
-  9.3772615106, /* pow(2, 3.22917) */
-  9.5136569200, /* pow(2, 3.25000) */
-  9.6520362464, /* pow(2, 3.27083) */
-  9.7924283464, /* pow(2, 3.29167) */
-  9.9348624966, /* pow(2, 3.31250) */
-  10.0793683992, /* pow(2, 3.33333) */
-  10.2259761885, /* pow(2, 3.35417) */
-  10.3747164372, /* pow(2, 3.37500) */
-  10.5256201627, /* pow(2, 3.39583) */
-  10.6787188334, /* pow(2, 3.41667) */
-  10.8340443755, /* pow(2, 3.43750) */
-  10.9916291797, /* pow(2, 3.45833) */
-  11.1515061076, /* pow(2, 3.47917) */
-  11.3137084990, /* pow(2, 3.50000) */
-  11.4782701785, /* pow(2, 3.52083) */
-  11.6452254627, /* pow(2, 3.54167) */
-  11.8146091675, /* pow(2, 3.56250) */
-  11.9864566150, /* pow(2, 3.58333) */
-  12.1608036412, /* pow(2, 3.60417) */
-  12.3376866033, /* pow(2, 3.62500) */
-  12.5171423873, /* pow(2, 3.64583) */
-  12.6992084157, /* pow(2, 3.66667) */
-  12.8839226556, /* pow(2, 3.68750) */
-  13.0713236259, /* pow(2, 3.70833) */
-  13.2614504061, /* pow(2, 3.72917) */
-  13.4543426441, /* pow(2, 3.75000) */
-  13.6500405642, /* pow(2, 3.77083) */
-  13.8485849761, /* pow(2, 3.79167) */
-  14.0500172830, /* pow(2, 3.81250) */
-  14.2543794902, /* pow(2, 3.83333) */
-  14.4617142143, /* pow(2, 3.85417) */
-  14.6720646913, /* pow(2, 3.87500) */
-  14.8854747864, /* pow(2, 3.89583) */
-  15.1019890029, /* pow(2, 3.91667) */
-  15.3216524912, /* pow(2, 3.93750) */
-  15.5445110585, /* pow(2, 3.95833) */
-  15.7706111782, /* pow(2, 3.97917) */
-  16.0000000000, /* pow(2, 4.00000) */
-  16.2327253590, /* pow(2, 4.02083) */
-  16.4688357863, /* pow(2, 4.04167) */
-  16.7083805188, /* pow(2, 4.06250) */
-  16.9514095097, /* pow(2, 4.08333) */
-  17.1979734387, /* pow(2, 4.10417) */
-  17.4481237226, /* pow(2, 4.12500) */
-  17.7019125262, /* pow(2, 4.14583) */
-  17.9593927730, /* pow(2, 4.16667) */
-  18.2206181561, /* pow(2, 4.18750) */
-  18.4856431500, /* pow(2, 4.20833) */
-  18.7545230211, /* pow(2, 4.22917) */
-  19.0273138400, /* pow(2, 4.25000) */
-  19.3040724928, /* pow(2, 4.27083) */
-  19.5848566929, /* pow(2, 4.29167) */
-  19.8697249932, /* pow(2, 4.31250) */
-  20.1587367983, /* pow(2, 4.33333) */
-  20.4519523770, /* pow(2, 4.35417) */
-  20.7494328744, /* pow(2, 4.37500) */
-  21.0512403253, /* pow(2, 4.39583) */
-  21.3574376667, /* pow(2, 4.41667) */
-  21.6680887510, /* pow(2, 4.43750) */
-  21.9832583593, /* pow(2, 4.45833) */
-  22.3030122152, /* pow(2, 4.47917) */
-  22.6274169980, /* pow(2, 4.50000) */
-  22.9565403570, /* pow(2, 4.52083) */
-  23.2904509255, /* pow(2, 4.54167) */
-  23.6292183350, /* pow(2, 4.56250) */
-  23.9729132300, /* pow(2, 4.58333) */
-  24.3216072824, /* pow(2, 4.60417) */
-  24.6753732065, /* pow(2, 4.62500) */
-  25.0342847745, /* pow(2, 4.64583) */
-  25.3984168315, /* pow(2, 4.66667) */
-  25.7678453112, /* pow(2, 4.68750) */
-  26.1426472519, /* pow(2, 4.70833) */
-  26.5229008123, /* pow(2, 4.72917) */
-  26.9086852881, /* pow(2, 4.75000) */
-  27.3000811284, /* pow(2, 4.77083) */
-  27.6971699522, /* pow(2, 4.79167) */
-  28.1000345660, /* pow(2, 4.81250) */
-  28.5087589805, /* pow(2, 4.83333) */
-  28.9234284285, /* pow(2, 4.85417) */
-  29.3441293825, /* pow(2, 4.87500) */
-  29.7709495729, /* pow(2, 4.89583) */
-  30.2039780058, /* pow(2, 4.91667) */
-  30.6433049824, /* pow(2, 4.93750) */
-  31.0890221169, /* pow(2, 4.95833) */
-  31.5412223565, /* pow(2, 4.97917) */
-  32.0000000000, /* pow(2, 5.00000) */
-};
-static float POW2(float n) {
-  if (isnan(n) || n < -5.000000 || n > 5.000000) {
-    return NAN;
-  }
-  return pow_lut[(int) (((n) - -5.000000) / 0.020833)];
-}
-#define LOG2(n) (logf(n) / logf(2))
-static float SQRT(float n) {
-  switch ((int) n) {
-  case 0: return 0;
-  case 1: return 1;
-  case 2: return 2;
-  case 3: return 2;
-  case 4: return 2;
-  case 5: return 2;
-  case 6: return 2;
-  case 7: return 3;
-  case 8: return 3;
-  case 9: return 3;
-  default: return 4;
-  }
-}
-#endif /* MATH_LUT_H */
@@ -0,0 +1,146 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+/*
+ * Thin layer over SSE2/AVX2 intrinsics, so that block kernels are written
+ * once for both vector widths. SIMD_LANES is left undefined if neither is
+ * targeted (or GLITCH_NO_SIMD is set) and kernels fall back to their scalar
+ * loops.
+ */
+#include <stdint.h>
+
+#if !defined(GLITCH_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+
+#define SIMD_LANES 8
+typedef __m256 simd_f;
+typedef __m256i simd_i;
+
+#define simd_set1f(x) _mm256_set1_ps(x)
+#define simd_set1i(x) _mm256_set1_epi32(x)
+#define simd_loadf(p) _mm256_loadu_ps(p)
+#define simd_storef(p, v) _mm256_storeu_ps((p), (v))
+#define simd_loadi(p) _mm256_loadu_si256((const __m256i *)(p))
+#define simd_storei(p, v) _mm256_storeu_si256((__m256i *)(p), (v))
+
+#define simd_addf(a, b) _mm256_add_ps((a), (b))
+#define simd_subf(a, b) _mm256_sub_ps((a), (b))
+#define simd_mulf(a, b) _mm256_mul_ps((a), (b))
+#define simd_divf(a, b) _mm256_div_ps((a), (b))
+#define simd_minf(a, b) _mm256_min_ps((a), (b))
+#define simd_maxf(a, b) _mm256_max_ps((a), (b))
+#define simd_sqrtf(a) _mm256_sqrt_ps(a)
+#define simd_andf(a, b) _mm256_and_ps((a), (b))
+#define simd_andnotf(a, b) _mm256_andnot_ps((a), (b))
+#define simd_orf(a, b) _mm256_or_ps((a), (b))
+#define simd_xorf(a, b) _mm256_xor_ps((a), (b))
+#define simd_ltf(a, b) _mm256_cmp_ps((a), (b), _CMP_LT_OQ)
+#define simd_lef(a, b) _mm256_cmp_ps((a), (b), _CMP_LE_OQ)
+#define simd_eqf(a, b) _mm256_cmp_ps((a), (b), _CMP_EQ_OQ)
+#define simd_ordf(a) _mm256_cmp_ps((a), (a), _CMP_ORD_Q)
+
+#define simd_addi(a, b) _mm256_add_epi32((a), (b))
+#define simd_subi(a, b) _mm256_sub_epi32((a), (b))
+#define simd_andi(a, b) _mm256_and_si256((a), (b))
+#define simd_ori(a, b) _mm256_or_si256((a), (b))
+#define simd_xori(a, b) _mm256_xor_si256((a), (b))
+#define simd_andnoti(a, b) _mm256_andnot_si256((a), (b))
+#define simd_gti(a, b) _mm256_cmpgt_epi32((a), (b))
+#define simd_eqi(a, b) _mm256_cmpeq_epi32((a), (b))
+#define simd_srli(a, n) _mm256_srli_epi32((a), (n))
+#define simd_slli(a, n) _mm256_slli_epi32((a), (n))
+/* Shifts by a count only known at run time */
+#define simd_sllci(a, n) _mm256_sll_epi32((a), _mm_cvtsi32_si128(n))
+#define simd_sraci(a, n) _mm256_sra_epi32((a), _mm_cvtsi32_si128(n))
+
+#define simd_itof(a) _mm256_cvtepi32_ps(a)
+#define simd_ftoi(a) _mm256_cvtps_epi32(a)   /* rounds to nearest */
+#define simd_ftoit(a) _mm256_cvttps_epi32(a) /* truncates */
+#define simd_castif(a) _mm256_castsi256_ps(a)
+#define simd_castfi(a) _mm256_castps_si256(a)
+#define simd_movemaskf(a) _mm256_movemask_ps(a)
+
+#define simd_gatherf(p, idx) _mm256_i32gather_ps((p), (idx), 4)
+/* Reads the 16-bit frame at idx together with the next one and keeps the
+ * first, so idx + 1 must be in bounds too */
+#define simd_gatheri16(p, idx)                                                 \
+  _mm256_srai_epi32(                                                           \
+      _mm256_slli_epi32(                                                       \
+          _mm256_i32gather_epi32((const int *)(p), (idx), 2), 16),             \
+      16)
+
+#elif !defined(GLITCH_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+
+#define SIMD_LANES 4
+typedef __m128 simd_f;
+typedef __m128i simd_i;
+
+#define simd_set1f(x) _mm_set1_ps(x)
+#define simd_set1i(x) _mm_set1_epi32(x)
+#define simd_loadf(p) _mm_loadu_ps(p)
+#define simd_storef(p, v) _mm_storeu_ps((p), (v))
+#define simd_loadi(p) _mm_loadu_si128((const __m128i *)(p))
+#define simd_storei(p, v) _mm_storeu_si128((__m128i *)(p), (v))
+
+#define simd_addf(a, b) _mm_add_ps((a), (b))
+#define simd_subf(a, b) _mm_sub_ps((a), (b))
+#define simd_mulf(a, b) _mm_mul_ps((a), (b))
+#define simd_divf(a, b) _mm_div_ps((a), (b))
+#define simd_minf(a, b) _mm_min_ps((a), (b))
+#define simd_maxf(a, b) _mm_max_ps((a), (b))
+#define simd_sqrtf(a) _mm_sqrt_ps(a)
+#define simd_andf(a, b) _mm_and_ps((a), (b))
+#define simd_andnotf(a, b) _mm_andnot_ps((a), (b))
+#define simd_orf(a, b) _mm_or_ps((a), (b))
+#define simd_xorf(a, b) _mm_xor_ps((a), (b))
+#define simd_ltf(a, b) _mm_cmplt_ps((a), (b))
+#define simd_lef(a, b) _mm_cmple_ps((a), (b))
+#define simd_eqf(a, b) _mm_cmpeq_ps((a), (b))
+#define simd_ordf(a) _mm_cmpord_ps((a), (a))
+
+#define simd_addi(a, b) _mm_add_epi32((a), (b))
+#define simd_subi(a, b) _mm_sub_epi32((a), (b))
+#define simd_andi(a, b) _mm_and_si128((a), (b))
+#define simd_ori(a, b) _mm_or_si128((a), (b))
+#define simd_xori(a, b) _mm_xor_si128((a), (b))
+#define simd_andnoti(a, b) _mm_andnot_si128((a), (b))
+#define simd_gti(a, b) _mm_cmpgt_epi32((a), (b))
+#define simd_eqi(a, b) _mm_cmpeq_epi32((a), (b))
+#define simd_srli(a, n) _mm_srli_epi32((a), (n))
+#define simd_slli(a, n) _mm_slli_epi32((a), (n))
+/* Shifts by a count only known at run time */
+#define simd_sllci(a, n) _mm_sll_epi32((a), _mm_cvtsi32_si128(n))
+#define simd_sraci(a, n) _mm_sra_epi32((a), _mm_cvtsi32_si128(n))
+
+#define simd_itof(a) _mm_cvtepi32_ps(a)
+#define simd_ftoi(a) _mm_cvtps_epi32(a)   /* rounds to nearest */
+#define simd_ftoit(a) _mm_cvttps_epi32(a) /* truncates */
+#define simd_castif(a) _mm_castsi128_ps(a)
+#define simd_castfi(a) _mm_castps_si128(a)
+#define simd_movemaskf(a) _mm_movemask_ps(a)
+
+/* No gathers before AVX2, lanes are loaded one at a time */
+static inline __m128 simd_gatherf(const float *p, __m128i idx) {
+  int32_t i[4];
+  _mm_storeu_si128((__m128i *)i, idx);
+  return _mm_setr_ps(p[i[0]], p[i[1]], p[i[2]], p[i[3]]);
+}
+
+static inline __m128i simd_gatheri16(const int16_t *p, __m128i idx) {
+  int32_t i[4];
+  _mm_storeu_si128((__m128i *)i, idx);
+  return _mm_setr_epi32(p[i[0]], p[i[1]], p[i[2]], p[i[3]]);
+}
+#endif
+
+#ifdef SIMD_LANES
+/* Lanes where the mask is set take a, the others take b */
+#define simd_selectf(mask, a, b)                                               \
+  simd_orf(simd_andf((mask), (a)), simd_andnotf((mask), (b)))
+#define simd_selecti(mask, a, b)                                               \
+  simd_ori(simd_andi((mask), (a)), simd_andnoti((mask), (b)))
+#define simd_absf(a) simd_andf((a), simd_castif(simd_set1i(0x7fffffff)))
+#endif
+
+#endif /* SIMD_H */
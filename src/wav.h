@@ -26,66 +26,433 @@ struct wav_header {
   struct subchunk_header data;
 };
 
-static FILE *wav_open(const char *path, size_t *datasz) {
-  struct riff_header riff = {0};
-  struct subchunk_header header = {0};
+static void wav_header_init(struct wav_header *header, int rate,
+                            uint32_t datasz) {
+  memset(header, 0, sizeof(*header));
+  memcpy(header->riff.riff_tag, "RIFF", 4);
+  memcpy(header->riff.wave_tag, "WAVE", 4);
+  memcpy(header->fmt.tag, "fmt ", 4);
+  memcpy(header->data.tag, "data", 4);
 
-  FILE *f = fopen(path, "rb");
-  if (f == NULL) {
+  header->fmt.length = 16;
+  header->wave.audio_format = 1;
+  header->wave.num_channels = 1;
+  header->wave.sample_rate = rate;
+  header->wave.byte_rate = rate * 2;
+  header->wave.block_align = 2;
+  header->wave.bits_per_sample = 16;
+  header->data.length = datasz;
+}
+
+#define WAV_FORMAT_PCM 1
+#define WAV_FORMAT_FLOAT 3
+#define WAV_FORMAT_EXTENSIBLE 0xfffe
+
+/* Converted samples keep their frames on a page boundary of the sidecar */
+#define WAV_PAGE 4096
+
+/* Resampling kernel, a Kaiser windowed sinc tabulated at WAV_SRC_PHASES points
+ * between zero crossings and linearly interpolated between them */
+#define WAV_SRC_ZEROS 16
+#define WAV_SRC_PHASES 256
+#define WAV_SRC_BETA 9.0
+#define WAV_SRC_CUTOFF 0.95 /* of the lower Nyquist frequency */
+
+/*
+ * Mono 16-bit frames of a WAV file. Files in that format and at the wanted
+ * rate are mapped and used in place, so processes playing the same library
+ * share the page cache and nothing is read before it is played. Other files
+ * are converted once into a hidden sidecar file next to the original, named
+ * after a hash of its contents and the rate, which is mapped the same way
+ * from then on.
+ */
+struct wav_map {
+  void *addr;
+  size_t size;
+  int mapped; /* addr is a file mapping, otherwise it is malloc'd */
+  const int16_t *data;
+  size_t len;
+  uint32_t rate;
+};
+
+/* Finds the format and the data chunk of a WAV file image */
+static const uint8_t *wav_parse(const uint8_t *p, size_t size,
+                                struct fmt_data *fmt, size_t *datasz) {
+  struct riff_header riff;
+  struct subchunk_header header;
+  int has_fmt = 0;
+
+  if (size < sizeof(riff)) {
     return NULL;
   }
-  fread(&riff, sizeof(riff), 1, f);
+  memcpy(&riff, p, sizeof(riff));
   if (memcmp(riff.riff_tag, "RIFF", 4) != 0 ||
       memcmp(riff.wave_tag, "WAVE", 4) != 0) {
-    fclose(f);
     return NULL;
   }
-  do {
-    size_t sz;
-    sz = fread(&header, sizeof(header), 1, f);
-    if (sz != 1) {
-      break;
-    }
+  for (size_t off = sizeof(riff); off + sizeof(header) <= size;) {
+    memcpy(&header, p + off, sizeof(header));
+    off += sizeof(header);
+    size_t len = header.length < size - off ? header.length : size - off;
     if (memcmp(header.tag, "fmt ", 4) == 0) {
-      struct fmt_data fmt = {0};
-      sz = fread(&fmt, sizeof(fmt), 1, f);
-      if (sz != 1) {
-	break;
+      if (len < sizeof(*fmt)) {
+        return NULL;
       }
-      if (fmt.num_channels != 1 || fmt.bits_per_sample != 16) {
-	break;
+      memcpy(fmt, p + off, sizeof(*fmt));
+      /* The real format is the first field of the sub-format GUID */
+      if (fmt->audio_format == WAV_FORMAT_EXTENSIBLE && len >= 26) {
+        memcpy(&fmt->audio_format, p + off + 24, sizeof(fmt->audio_format));
       }
-      fseek(f, header.length - sizeof(fmt), SEEK_CUR);
+      has_fmt = 1;
     } else if (memcmp(header.tag, "data", 4) == 0) {
-      if (datasz != NULL) {
-	*datasz = header.length / 2;
+      if (!has_fmt) {
+        return NULL;
       }
-      return f;
-    } else {
-      fseek(f, header.length, SEEK_CUR);
+      *datasz = len;
+      return p + off;
     }
-  } while (true);
-  fclose(f);
+    off += len + (len & 1);
+  }
   return NULL;
 }
 
+static int wav_supported(const struct fmt_data *fmt) {
+  int bits = fmt->bits_per_sample;
+  if (fmt->num_channels == 0 ||
+      fmt->block_align < fmt->num_channels * (bits / 8)) {
+    return 0;
+  } else if (fmt->audio_format == WAV_FORMAT_PCM) {
+    return bits == 8 || bits == 16 || bits == 24 || bits == 32;
+  } else if (fmt->audio_format == WAV_FORMAT_FLOAT) {
+    return bits == 32 || bits == 64;
+  }
+  return 0;
+}
+
+static float wav_decode(const uint8_t *p, const struct fmt_data *fmt) {
+  if (fmt->audio_format == WAV_FORMAT_FLOAT) {
+    if (fmt->bits_per_sample == 64) {
+      double d;
+      memcpy(&d, p, sizeof(d));
+      return (float)d;
+    }
+    float f;
+    memcpy(&f, p, sizeof(f));
+    return f;
+  }
+  switch (fmt->bits_per_sample) {
+  case 8:
+    return (p[0] - 128) / 128.f;
+  case 16:
+    return (int16_t)(p[0] | p[1] << 8) / 32768.f;
+  case 24:
+    return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 |
+                     (uint32_t)p[2] << 24) /
+           2147483648.f;
+  default:
+    return (int32_t)((uint32_t)p[0] | (uint32_t)p[1] << 8 |
+                     (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24) /
+           2147483648.f;
+  }
+}
+
+/* Mixes a frame down to mono */
+static float wav_decode_frame(const uint8_t *p, const struct fmt_data *fmt) {
+  float sum = 0;
+  for (int c = 0; c < fmt->num_channels; c++) {
+    sum = sum + wav_decode(p + c * (fmt->bits_per_sample / 8), fmt);
+  }
+  return sum / fmt->num_channels;
+}
+
+static void *wav_map_file(const char *path, size_t *size, int *mapped) {
+#ifdef _WIN32
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  long len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  void *p = len > 0 ? malloc(len) : NULL;
+  if (p != NULL && fread(p, 1, len, f) != (size_t)len) {
+    free(p);
+    p = NULL;
+  }
+  fclose(f);
+  *size = len;
+  *mapped = 0;
+  return p;
+#else
+  struct stat st;
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return NULL;
+  }
+  void *p = NULL;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    p = (p == MAP_FAILED ? NULL : p);
+  }
+  close(fd);
+  *size = (p != NULL ? (size_t)st.st_size : 0);
+  *mapped = 1;
+  return p;
+#endif
+}
+
+static void wav_map_close(struct wav_map *map) {
+  if (map->addr != NULL) {
+#ifndef _WIN32
+    if (map->mapped) {
+      munmap(map->addr, map->size);
+    } else
+#endif
+      free(map->addr);
+  }
+  memset(map, 0, sizeof(*map));
+}
+
+/* Maps a file, using its frames in place if they are mono 16-bit */
+static int wav_map_native(const char *path, struct wav_map *map,
+                          struct fmt_data *fmt, const uint8_t **data,
+                          size_t *datasz) {
+  memset(map, 0, sizeof(*map));
+  map->addr = wav_map_file(path, &map->size, &map->mapped);
+  if (map->addr == NULL) {
+    return -1;
+  }
+  *data = wav_parse((const uint8_t *)map->addr, map->size, fmt, datasz);
+  if (*data == NULL || !wav_supported(fmt) || fmt->sample_rate == 0) {
+    wav_map_close(map);
+    return -1;
+  }
+  map->rate = fmt->sample_rate;
+  if (fmt->audio_format == WAV_FORMAT_PCM && fmt->num_channels == 1 &&
+      fmt->bits_per_sample == 16 && ((uintptr_t)*data & 1) == 0) {
+    map->data = (const int16_t *)*data;
+    map->len = *datasz / 2;
+  }
+  return 0;
+}
+
+/* Reads every page of the frames, so that playing them never waits for disk */
+static void wav_map_prefetch(const struct wav_map *map) {
+  volatile int16_t sink = 0;
+#ifndef _WIN32
+  if (map->mapped) {
+    madvise(map->addr, map->size, MADV_WILLNEED);
+  }
+#endif
+  for (size_t i = 0; i < map->len; i += WAV_PAGE / sizeof(int16_t)) {
+    sink = sink + map->data[i];
+  }
+  (void)sink;
+}
+
+static uint64_t wav_hash(const uint8_t *p, size_t size) {
+  uint64_t h = 0xcbf29ce484222325ull ^ size;
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t w;
+    memcpy(&w, p + i, sizeof(w));
+    h = (h ^ w) * 0x100000001b3ull;
+    h = h ^ (h >> 29);
+  }
+  for (; i < size; i++) {
+    h = (h ^ p[i]) * 0x100000001b3ull;
+  }
+  return h;
+}
+
+/* samples/bass/bass0.wav at 48 kHz is kept as
+ * samples/bass/.bass0.wav.<hash>.48000.s16 */
+static void wav_sidecar_path(const char *path, const struct wav_map *map,
+                             uint32_t rate, char *out, size_t n) {
+  const char *base = strrchr(path, '/');
+  base = (base == NULL ? path : base + 1);
+  snprintf(out, n, "%.*s.%s.%016llx.%u.s16", (int)(base - path), path, base,
+           (unsigned long long)wav_hash((const uint8_t *)map->addr, map->size),
+           (unsigned int)rate);
+}
+
+static double wav_bessel_i0(double x) {
+  double sum = 1, term = 1;
+  for (int k = 1; k < 32; k++) {
+    term = term * (x / (2 * k)) * (x / (2 * k));
+    sum = sum + term;
+  }
+  return sum;
+}
+
+/* Right half of the kernel, h[0] is the centre */
+static void wav_src_kernel(float *h) {
+  const double pi = 3.14159265358979323846;
+  int n = WAV_SRC_ZEROS * WAV_SRC_PHASES;
+  for (int i = 0; i < n; i++) {
+    double u = pi * i / WAV_SRC_PHASES;
+    double r = (double)i / n;
+    double w = wav_bessel_i0(WAV_SRC_BETA * sqrt(1 - r * r)) /
+               wav_bessel_i0(WAV_SRC_BETA);
+    h[i] = (float)((i == 0 ? 1 : sin(u) / u) * w);
+  }
+  h[n] = h[n + 1] = 0;
+}
+
+/*
+ * Band-limited interpolation from rate in to rate out. Every output frame is
+ * a sum over the input frames within WAV_SRC_ZEROS zero crossings of the
+ * kernel, stretched when downsampling so that it also filters out what the
+ * lower rate can not represent. Returns the number of frames written to y,
+ * which must have room for len * out / in + 1 frames.
+ */
+static size_t wav_resample(const float *x, size_t len, uint32_t in,
+                           uint32_t out, float *y) {
+  static float h[WAV_SRC_ZEROS * WAV_SRC_PHASES + 2];
+  if (h[0] == 0) {
+    wav_src_kernel(h);
+  }
+  double cutoff = WAV_SRC_CUTOFF * (out < in ? (double)out / in : 1);
+  double reach = WAV_SRC_ZEROS / cutoff;
+  size_t n = (size_t)((double)len * out / in);
+  for (size_t j = 0; j < n; j++) {
+    double t = (double)j * in / out;
+    double lo = ceil(t - reach), hi = floor(t + reach);
+    size_t first = (lo < 0 ? 0 : (size_t)lo);
+    size_t last = (hi > len - 1 ? len - 1 : (size_t)hi);
+    double sum = 0;
+    for (size_t i = first; i <= last; i++) {
+      double u = fabs(t - (double)i) * cutoff * WAV_SRC_PHASES;
+      size_t k = (size_t)u;
+      float c = h[k] + (h[k + 1] - h[k]) * (float)(u - (double)k);
+      sum = sum + x[i] * c;
+    }
+    y[j] = (float)(sum * cutoff);
+  }
+  return n;
+}
+
+static int16_t wav_quantize(float v) {
+  v = v * 32768.f;
+  if (!(v > -32768.f)) {
+    return v != v ? 0 : -32768;
+  } else if (v > 32767.f) {
+    return 32767;
+  }
+  return (int16_t)lrintf(v);
+}
+
+/*
+ * Converts the frames into the image of a mono 16-bit WAV file at the given
+ * rate whose data starts on a page boundary, padded by a JUNK chunk, and
+ * stores it as the sidecar. If it can not be stored the image is kept in
+ * memory.
+ */
+static int wav_convert(const char *sidecar, const struct fmt_data *fmt,
+                       const uint8_t *data, size_t datasz, uint32_t rate,
+                       struct wav_map *map) {
+  struct wav_header header;
+  struct subchunk_header junk;
+  size_t len = datasz / fmt->block_align;
+  size_t maxlen = (size_t)((double)len * rate / fmt->sample_rate) + 1;
+  float *x = (float *)malloc((len + maxlen) * sizeof(float));
+  if (x == NULL) {
+    return -1;
+  }
+  for (size_t i = 0; i < len; i++) {
+    x[i] = wav_decode_frame(data + i * fmt->block_align, fmt);
+  }
+  float *y = x;
+  if (rate != fmt->sample_rate) {
+    y = x + len;
+    len = wav_resample(x, len, fmt->sample_rate, rate, y);
+  }
+
+  size_t size = WAV_PAGE + len * sizeof(int16_t);
+  uint8_t *p = (uint8_t *)calloc(1, size);
+  if (p == NULL) {
+    free(x);
+    return -1;
+  }
+  wav_header_init(&header, rate, len * sizeof(int16_t));
+  header.riff.riff_length = size - 8;
+  memcpy(junk.tag, "JUNK", 4);
+  junk.length = WAV_PAGE - sizeof(header) - sizeof(junk);
+  memcpy(p, &header, offsetof(struct wav_header, data));
+  memcpy(p + offsetof(struct wav_header, data), &junk, sizeof(junk));
+  memcpy(p + WAV_PAGE - sizeof(header.data), &header.data,
+         sizeof(header.data));
+  int16_t *frames = (int16_t *)(p + WAV_PAGE);
+  for (size_t i = 0; i < len; i++) {
+    frames[i] = wav_quantize(y[i]);
+  }
+  free(x);
+
+  /* Written under a temporary name, so other processes never map a part */
+  char tmp[PATH_MAX + 16];
+  int n = snprintf(tmp, sizeof(tmp), "%s.%d", sidecar, (int)getpid());
+  FILE *f = (n > 0 && (size_t)n < sizeof(tmp) ? fopen(tmp, "wb") : NULL);
+  int ok = (f != NULL && fwrite(p, 1, size, f) == size);
+  ok = (f != NULL && fclose(f) == 0 && ok);
+  if (ok && rename(tmp, sidecar) == 0) {
+    struct fmt_data sidefmt;
+    const uint8_t *sidedata;
+    size_t sidesz;
+    if (wav_map_native(sidecar, map, &sidefmt, &sidedata, &sidesz) == 0 &&
+        map->data != NULL) {
+      free(p);
+      return 0;
+    }
+    wav_map_close(map);
+  } else if (f != NULL) {
+    remove(tmp);
+  }
+  map->addr = p;
+  map->size = size;
+  map->mapped = 0;
+  map->data = frames;
+  map->len = len;
+  map->rate = rate;
+  return 0;
+}
+
+/* Maps the mono 16-bit frames of a WAV file at the given rate, or at its own
+ * rate if it is 0, converting it if needed */
+static int wav_map_open(const char *path, uint32_t rate, struct wav_map *map) {
+  struct fmt_data fmt;
+  const uint8_t *data;
+  size_t datasz;
+  char sidecar[PATH_MAX];
+
+  if (wav_map_native(path, map, &fmt, &data, &datasz) < 0) {
+    return -1;
+  }
+  rate = (rate == 0 ? map->rate : rate);
+  if (map->data != NULL && map->rate == rate) {
+    return 0;
+  }
+  wav_sidecar_path(path, map, rate, sidecar, sizeof(sidecar));
+  struct wav_map side;
+  struct fmt_data sidefmt;
+  const uint8_t *sidedata;
+  size_t sidesz;
+  if (wav_map_native(sidecar, &side, &sidefmt, &sidedata, &sidesz) == 0 &&
+      side.data != NULL && side.rate == rate) {
+    wav_map_close(map);
+    *map = side;
+    return 0;
+  }
+  wav_map_close(&side);
+  struct wav_map src = *map;
+  int r = wav_convert(sidecar, &fmt, data, datasz, rate, map);
+  wav_map_close(&src);
+  return r;
+}
+
 static FILE *wav_create(const char *path, int rate) {
-  struct wav_header header = {0};
-
-  memcpy(header.riff.riff_tag, "RIFF", 4);
-  memcpy(header.riff.wave_tag, "WAVE", 4);
-  memcpy(header.fmt.tag, "fmt ", 4);
-  memcpy(header.data.tag, "data", 4);
-
-  header.riff.riff_length = 0;
-  header.fmt.length = 16;
-  header.wave.audio_format = 1;
-  header.wave.num_channels = 1;
-  header.wave.sample_rate = rate;
-  header.wave.byte_rate = rate * 2;
-  header.wave.block_align = 2;
-  header.wave.bits_per_sample = 16;
-  header.data.length = 0;
+  struct wav_header header;
+
+  wav_header_init(&header, rate, 0);
 
   FILE *f = fopen(path, "wb+");
   if (f == NULL) {
@@ -100,10 +467,6 @@ static size_t wav_write(FILE *f, int16_t *data, size_t len) {
   return fwrite(data, sizeof(int16_t), len, f);
 }
 
-static size_t wav_read(FILE *f, int16_t *data, size_t len) {
-  return fread(data, sizeof(int16_t), len, f);
-}
-
 static void wav_flush(FILE *file) {
   int file_length = ftell(file);
 
@@ -116,6 +479,4 @@ static void wav_flush(FILE *file) {
   fwrite(&riff_length, sizeof(riff_length), 1, file);
 }
 
-static void wav_close(FILE *f) { fclose(f); }
-
 #endif /* WAV_H */